@@ -101,6 +101,11 @@ data::termcap_string data::strings[] =
   { "t_restore_cursor", fc::t_restore_cursor },
   { "t_scroll_forward", fc::t_scroll_forward },
   { "t_scroll_reverse", fc::t_scroll_reverse },
+  { "t_change_scroll_region", fc::t_change_scroll_region },
+  { "t_parm_index", fc::t_parm_index },
+  { "t_parm_rindex", fc::t_parm_rindex },
+  { "t_set_lr_margin", fc::t_set_lr_margin },
+  { "t_clear_margins", fc::t_clear_margins },
   { "t_enter_ca_mode", fc::t_enter_ca_mode },
   { "t_exit_ca_mode", fc::t_exit_ca_mode },
   { "t_enable_acs", fc::t_enable_acs },
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Generates the column width table in fcharmap.cpp
+# from the Unicode character database of Python
+#
+# The value 3 marks characters with the width 0 that extend the
+# previous character (combining marks and the zero width joiner)
+#
+# Usage: ./char_width_table.py > table.txt
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+BLOCK_SIZE = 256  # Code points per block (2 bits each)
+EXTENDING = 3     # Width 0, part of the previous grapheme cluster
+ZERO_WIDTH_JOINER = 0x200d
+
+# Format characters that are printed (Prepended_Concatenation_Mark)
+PREPENDED_MARKS = ( 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605
+                  , 0x06dd, 0x070f, 0x0890, 0x0891, 0x08e2, 0x110bd
+                  , 0x110cd )
+
+# Characters of East Asian blocks that are wide like in glibc
+WIDE = ( (0x3248, 0x324f), (0x4dc0, 0x4dff) )
+
+
+def width (cp):
+    if cp == 0 or cp < 0x20 or 0x7f <= cp < 0xa0:
+        return 0  # Control character
+
+    ch = chr(cp)
+    category = unicodedata.category(ch)
+
+    if cp == 0x00ad or cp in PREPENDED_MARKS:
+        return 1  # Soft hyphen or prepended concatenation mark
+
+    if category in ("Mn", "Me") or cp == ZERO_WIDTH_JOINER:
+        return EXTENDING  # Combining mark or zero width joiner
+
+    if category in ("Cf", "Cs", "Zl", "Zp") \
+       or 0x1160 <= cp <= 0x11ff or 0xd7b0 <= cp <= 0xd7ff:
+        return 0  # Format, separator, surrogate or Hangul medial/final jamo
+
+    if category == "Cn":
+        return 0  # Unassigned, wcwidth() returns -1
+
+    for first, last in WIDE:
+        if first <= cp <= last:
+            return 2
+
+    if unicodedata.east_asian_width(ch) in ("W", "F"):
+        return 2
+
+    return 1
+
+
+def main():
+    blocks = []
+    block_index = {}
+    index = []
+
+    for base in range(0, MAX_CODE_POINT, BLOCK_SIZE):
+        data = bytearray(BLOCK_SIZE // 4)
+
+        for n in range(BLOCK_SIZE):
+            data[n // 4] |= width(base + n) << ((n % 4) * 2)
+
+        data = bytes(data)
+
+        if data not in block_index:
+            block_index[data] = len(blocks)
+            blocks.append(data)
+
+        index.append(block_index[data])
+
+    out = sys.stdout
+    out.write("// Generated by scripts/char_width_table.py (Unicode %s)\n"
+              % unicodedata.unidata_version)
+    out.write("const uInt8 char_width_index[] =\n{\n")
+
+    for i in range(0, len(index), 16):
+        row = ", ".join("%3d" % n for n in index[i:i + 16])
+        sep = "," if i + 16 < len(index) else ""
+        out.write("  %s%s\n" % (row, sep))
+
+    out.write("};\n\n")
+    out.write("const uInt8 char_width_table[][%d] =\n{\n" % (BLOCK_SIZE // 4))
+
+    for b, data in enumerate(blocks):
+        out.write("  {  // %d\n" % b)
+
+        for i in range(0, len(data), 16):
+            row = ", ".join("0x%02x" % n for n in data[i:i + 16])
+            sep = "," if i + 16 < len(data) else ""
+            out.write("    %s%s\n" % (row, sep))
+
+        out.write("  }%s\n" % ("," if b + 1 < len(blocks) else ""))
+
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
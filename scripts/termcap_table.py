@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Generates the built-in terminal capability table in ftermcap.cpp
+# from the local terminfo database (via the termcap functions of tinfo)
+#
+# Usage: ./termcap_table.py > table.txt
+
+import ctypes
+import ctypes.util
+import os
+import re
+import sys
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+
+# Terminals with padding (e.g. vt100) need the baud rate handling of
+# tputs and an initialized database, so they are not built in
+TERMINALS = ( "xterm", "xterm-16color", "xterm-88color", "xterm-256color"
+            , "gnome", "gnome-256color", "vte", "vte-256color"
+            , "konsole", "konsole-256color", "putty", "putty-256color"
+            , "rxvt", "rxvt-16color", "rxvt-256color"
+            , "screen", "screen-256color", "tmux", "tmux-256color"
+            , "linux", "ansi" )
+
+# Booleans and numerics of FTermcap::termcapBoleans/termcapNumerics
+FLAGS = ("ut", "cc", "bw", "am", "xn", "AX", "XT")
+NUMERICS = ("Co", "it", "NC", "U8")
+
+
+def capability_names (filename, array):
+    # Returns the termcap names of the given table in filename
+    text = open(os.path.join(SRC_DIR, filename)).read()
+    start = text.index(array)
+    table = text[start:text.index("};", start)]
+    names = []
+
+    # tgetstr compares only the first two characters
+    for name in re.findall(r'"([^"]*)" *\}', table):
+        if name[:2] not in names:
+            names.append(name[:2])
+
+    return names
+
+
+def escape (value):
+    out = []
+
+    for byte in value:
+        if byte < 0x20 or byte >= 0x7f or chr(byte) in '"\\?':
+            out.append("\\%03o" % byte)  # Octal escapes have a fixed length
+        else:
+            out.append(chr(byte))
+
+    return "".join(out)
+
+
+def main():
+    tinfo = ctypes.CDLL(ctypes.util.find_library("tinfo")
+                        or ctypes.util.find_library("ncursesw"))
+    tinfo.tgetstr.restype = ctypes.c_char_p
+    tinfo.tgetstr.argtypes = (ctypes.c_char_p, ctypes.POINTER(ctypes.c_char_p))
+    strings = capability_names("ftermcap.cpp", "FTermcap::strings[]")
+    strings += [name for name in capability_names("fkey_map.cpp", "fkey[]")
+                if name not in strings]
+    terminals = []
+
+    for term in TERMINALS:
+        buffer = ctypes.create_string_buffer(4096)
+
+        if tinfo.tgetent(buffer, term.encode()) != 1:
+            sys.exit("Unknown terminal: " + term)
+
+        caps = {}
+
+        for name in FLAGS:
+            if tinfo.tgetflag(name.encode()) > 0:
+                caps[name] = ""
+
+        for name in NUMERICS:
+            number = tinfo.tgetnum(name.encode())
+
+            if number >= 0:
+                caps[name] = "#%d" % number
+
+        area = ctypes.create_string_buffer(8192)
+        area_ptr = ctypes.c_char_p(ctypes.addressof(area))
+
+        for name in strings:
+            value = tinfo.tgetstr(name.encode(), ctypes.byref(area_ptr))
+
+            if value and b"$<" in value:
+                sys.exit("Padding in %s of %s" % (name, term))
+
+            if value:
+                caps[name] = "=" + escape(value)
+
+        terminals.append((term, caps))
+
+    out = sys.stdout
+    out.write("// Generated by scripts/termcap_table.py\n")
+    table = []
+
+    for term, caps in terminals:
+        # Stores only the differences to the most similar previous entry
+        base = None
+        entries = [name + value for name, value in caps.items()]
+
+        for base_term, base_caps in terminals:
+            if base_term == term:
+                break
+
+            diff = [name + value for name, value in caps.items()
+                    if base_caps.get(name) != value]
+            diff += [name + "@" for name in base_caps if name not in caps]
+
+            if len(diff) < len(entries):
+                base, entries = base_term, diff
+
+        identifier = re.sub(r"\W", "_", term) + "_caps"
+        table.append((term, base, identifier))
+
+        if base:
+            out.write("constexpr char %s[] =  // Based on %s\n"
+                      % (identifier, base))
+        else:
+            out.write("constexpr char %s[] =\n" % identifier)
+
+        for entry in entries:
+            out.write('  "%s\\0"\n' % entry)
+
+        if not entries:
+            out.write('  ""\n')
+
+        out.write(";\n\n")
+
+    out.write("const FTermcap::builtin_entry FTermcap::builtin[] =\n{\n")
+
+    for term, base, identifier in table:
+        out.write('  { "%s", %s, %s },\n'
+                  % (term, '"%s"' % base if base else "nullptr", identifier))
+
+    out.write("  { nullptr, nullptr, nullptr }\n};\n")
+
+
+if __name__ == "__main__":
+    main()
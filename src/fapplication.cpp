@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,7 @@
 #include "final/fstatusbar.h"
 #include "final/ftermdata.h"
 #include "final/ftermios.h"
+#include "final/ftermoutput.h"
 #include "final/fwidgetcolors.h"
 #include "final/fwindow.h"
 
@@ -320,6 +322,8 @@ void FApplication::showParameterUsage()
     << "     Disable cursor optimization\n"
     << "  --no-terminal-detection"
     << "     Disable terminal detection\n"
+    << "  --terminal-cache       "
+    << "     Reuse the detected terminal replies\n"
     << "  --no-color-change      "
     << "     Do not redefine the color palette\n"
     << "  --no-sgr-optimizer     "
@@ -328,6 +332,12 @@ void FApplication::showParameterUsage()
     << "     Set the standard vga 8x16 font\n"
     << "  --newfont              "
     << "     Enables the graphical font\n"
+    << "  --headless             "
+    << "     Run in a virtual terminal without a tty\n"
+    << "  --vcsa[=<device>]      "
+    << "     Write directly into the Linux console memory\n"
+    << "  --no-async-output      "
+    << "     Write the terminal output with blocking calls\n"
 
 #if defined(__FreeBSD__) || defined(__DragonFly__)
     << "\n"
@@ -418,10 +428,14 @@ void FApplication::cmd_options (const int& argc, char* argv[])
       {C_STR("no-mouse"),              no_argument,       0,  0 },
       {C_STR("no-optimized-cursor"),   no_argument,       0,  0 },
       {C_STR("no-terminal-detection"), no_argument,       0,  0 },
+      {C_STR("terminal-cache"),        no_argument,       0,  0 },
       {C_STR("no-color-change"),       no_argument,       0,  0 },
       {C_STR("no-sgr-optimizer"),      no_argument,       0,  0 },
       {C_STR("vgafont"),               no_argument,       0,  0 },
       {C_STR("newfont"),               no_argument,       0,  0 },
+      {C_STR("headless"),              no_argument,       0,  0 },
+      {C_STR("vcsa"),                  optional_argument, 0,  0 },
+      {C_STR("no-async-output"),       no_argument,       0,  0 },
 
     #if defined(__FreeBSD__) || defined(__DragonFly__)
       {C_STR("no-esc-for-alt-meta"),   no_argument,       0,  0 },
@@ -471,6 +485,9 @@ void FApplication::cmd_options (const int& argc, char* argv[])
       if ( std::strcmp(long_options[idx].name, "no-terminal-detection")  == 0 )
         getStartOptions().terminal_detection = false;
 
+      if ( std::strcmp(long_options[idx].name, "terminal-cache")  == 0 )
+        getStartOptions().terminal_cache = true;
+
       if ( std::strcmp(long_options[idx].name, "no-color-change")  == 0 )
         getStartOptions().color_change = false;
 
@@ -483,6 +500,20 @@ void FApplication::cmd_options (const int& argc, char* argv[])
       if ( std::strcmp(long_options[idx].name, "newfont")  == 0 )
         getStartOptions().newfont = true;
 
+      if ( std::strcmp(long_options[idx].name, "headless")  == 0 )
+        getStartOptions().headless = true;
+
+      if ( std::strcmp(long_options[idx].name, "vcsa")  == 0 )
+      {
+        getStartOptions().vcsa = true;
+
+        if ( optarg )
+          getStartOptions().vcsa_device = optarg;
+      }
+
+      if ( std::strcmp(long_options[idx].name, "no-async-output")  == 0 )
+        getStartOptions().async_output = false;
+
     #if defined(__FreeBSD__) || defined(__DragonFly__)
       if ( std::strcmp(long_options[idx].name, "no-esc-for-alt-meta")  == 0 )
         getStartOptions().meta_sends_escape = false;
@@ -536,7 +567,19 @@ inline bool FApplication::isKeyPressed()
   if ( mouse && mouse->isGpmMouseEnabled() )
     return mouse->getGpmKeyPressed(keyboard->unprocessedInput());
 
-  return keyboard->isKeyPressed();
+  // A pending terminal update shortens the waiting time
+  static constexpr uInt64 max_wait = 100000;  // 100 ms
+  static constexpr uInt64 output_wait = 10000;  // 10 ms
+  uInt64 wait_time = std::min(getFrameWaitTime(), max_wait);
+
+  // Unsent output is continued after a short time. A due frame
+  // has to wait for it if the terminal does not take any more data.
+  if ( FTermOutput::isOverloaded() )
+    wait_time = output_wait;
+  else if ( FTermOutput::hasPendingData() )
+    wait_time = std::min(wait_time, output_wait);
+
+  return keyboard->isKeyPressed (wait_time);
 }
 
 //----------------------------------------------------------------------
@@ -82,16 +82,20 @@ void FButton::setBackgroundColor (FColor color)
 //----------------------------------------------------------------------
 void FButton::setHotkeyForegroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     button_hotkey_fg = color;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
 void FButton::setFocusForegroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     button_focus_fg = color;
 
   updateButtonColor();
@@ -100,8 +104,9 @@ void FButton::setFocusForegroundColor (FColor color)
 //----------------------------------------------------------------------
 void FButton::setFocusBackgroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     button_focus_bg = color;
 
   updateButtonColor();
@@ -110,8 +115,9 @@ void FButton::setFocusBackgroundColor (FColor color)
 //----------------------------------------------------------------------
 void FButton::setInactiveForegroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     button_inactive_fg = color;
 
   updateButtonColor();
@@ -120,8 +126,9 @@ void FButton::setInactiveForegroundColor (FColor color)
 //----------------------------------------------------------------------
 void FButton::setInactiveBackgroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     button_inactive_bg = color;
 
   updateButtonColor();
@@ -201,6 +208,7 @@ void FButton::setText (const FString& txt)
     text.setString(txt);
 
   detectHotkey();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -689,6 +697,8 @@ void FButton::updateButtonColor()
     button_fg = button_inactive_fg;
     button_bg = button_inactive_bg;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -124,6 +124,8 @@ void FButtonGroup::setText (const FString& txt)
     delAccelerator();
     setHotkeyAccelerator();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -241,6 +243,8 @@ void FButtonGroup::insert (FToggleButton* button)
     "toggled",
     F_METHOD_CALLBACK (this, &FButtonGroup::cb_buttonToggled)
   );
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -265,6 +269,8 @@ void FButtonGroup::remove (FToggleButton* button)
     else
       ++iter;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
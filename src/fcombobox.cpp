@@ -247,6 +247,7 @@ bool FComboBox::setEditable (bool enable)
     setVisibleCursor();
 
   input_field.setReadOnly(! enable);
+  invalidate();
   return (is_editable = enable);
 }
 
@@ -265,6 +266,7 @@ void FComboBox::setCurrentItem (std::size_t index)
   input_field = list_window.list.getItem(index).getText();
   input_field.redraw();
   processChanged();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -285,6 +287,8 @@ void FComboBox::insert (FListBoxItem listItem)
 
   if ( getCount() == 1 )
     input_field = list_window.list.getItem(1).getText();
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -305,6 +309,8 @@ void FComboBox::remove (std::size_t item)
     hideDropDown();
     showDropDown();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -315,6 +321,7 @@ void FComboBox::clear()
 
   list_window.list.clear();
   input_field.clear();
+  invalidate();
   redraw();
 }
 
@@ -25,6 +25,8 @@
   #include <strings.h>    // need for strcasecmp
 #endif
 
+#include <algorithm>
+#include <cctype>
 #include <vector>
 
 #include "final/fevent.h"
@@ -40,6 +42,9 @@ bool sortByName ( const FFileDialog::dir_entry& lhs
                 , const FFileDialog::dir_entry& rhs )
 {
   // lhs < rhs
+  if ( lhs.sort_key != rhs.sort_key )
+    return bool( lhs.sort_key < rhs.sort_key );
+
   return bool( strcasecmp(lhs.name, rhs.name) < 0 );
 }
 
@@ -54,6 +59,26 @@ bool sortDirFirst ( const FFileDialog::dir_entry& lhs
     return false;
 }
 
+//----------------------------------------------------------------------
+bool sortDirEntries ( const FFileDialog::dir_entry& lhs
+                    , const FFileDialog::dir_entry& rhs )
+{
+  // ".." first, then directories and files sorted by name
+
+  static const uInt64 parent_key = FFileDialog::getSortKey("..");
+
+  if ( rhs.sort_key == parent_key )  // Only ".." has this key
+    return false;
+
+  if ( lhs.sort_key == parent_key )
+    return true;
+
+  if ( lhs.directory != rhs.directory )
+    return sortDirFirst(lhs, rhs);
+
+  return sortByName(lhs, rhs);
+}
+
 //----------------------------------------------------------------------
 const FString fileChooser ( FWidget* parent
                           , const FString& dirname
@@ -132,6 +157,7 @@ FFileDialog::FFileDialog ( const FString& dirname
 //----------------------------------------------------------------------
 FFileDialog::~FFileDialog()  // destructor
 {
+  stopReadDir();
   clear();
 }
 
@@ -209,7 +235,7 @@ void FFileDialog::setPath (const FString& dir)
   else
     r_dir.setString(dir);
 
-  if ( r_dir[r_dir.getLength() - 1] != '/' )
+  if ( r_dir.back() != '/' )
     directory = r_dir + "/";
   else
     directory = r_dir;
@@ -259,6 +285,25 @@ void FFileDialog::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FFileDialog::onTimer (FTimerEvent* ev)
+{
+  if ( ev->getTimerId() != scan_timer_id )
+    return;
+
+  // Read the next part of the directory
+  if ( readDirEntries() )
+    finishReadDir();
+  else if ( scan_entries.size() >= dir_entries.size() )
+    showDirEntries();  // The list grows geometrically
+  else
+    return;
+
+  filebrowser.redraw();
+  updateTerminal();
+  flush();
+}
+
 //----------------------------------------------------------------------
 const FString FFileDialog::fileOpenChooser ( FWidget* parent
                                            , const FString& dirname
@@ -417,7 +462,7 @@ void FFileDialog::initCallbacks()
 
 //----------------------------------------------------------------------
 inline bool FFileDialog::pattern_match ( const char* const pattern
-                                       , char fname[] )
+                                       , const char fname[] )
 {
   char search[128]{};
 
@@ -439,62 +484,108 @@ inline bool FFileDialog::pattern_match ( const char* const pattern
 }
 
 //----------------------------------------------------------------------
-void FFileDialog::clear()
+void FFileDialog::compileFilter()
 {
-  if ( dir_entries.empty() )
-    return;
+  // Convert the filter pattern only once per directory scan
 
-  // delete all directory entries;
-  for (auto&& entry : dir_entries)
-    std::free (entry.name);
+  const char* const pattern = filter_pattern.c_str();
+  filter_glob = ( pattern ) ? pattern : "";
 
-  dir_entries.clear();
-  dir_entries.shrink_to_fit();
+  // "*" or "*<suffix>" patterns can be matched without fnmatch
+  const auto wildcard = filter_glob.find_first_of("*?[\\", 1);
+  filter_is_suffix = filter_glob[0] == '*' && wildcard == std::string::npos;
 }
 
 //----------------------------------------------------------------------
-sInt64 FFileDialog::numOfDirs()
+inline bool FFileDialog::matchFilter (const char fname[])
 {
-  if ( dir_entries.empty() )
-    return 0;
+  if ( ! filter_is_suffix )
+    return pattern_match (filter_glob.c_str(), fname);
 
-  sInt64 n = std::count_if ( std::begin(dir_entries)
-                           , std::end(dir_entries)
-                           , [] (dir_entry& entry)
-                             {
-                               return entry.directory
-                                   && std::strcmp(entry.name, ".") != 0;
-                             }
-                           );
-  return n;
+  const char* name = fname;
+
+  if ( name[0] == '.' )  // A leading period must match explicitly
+  {
+    if ( ! show_hidden || name[1] == '\0' )
+      return false;
+
+    name++;
+  }
+
+  const std::size_t length = std::strlen(name);
+  const std::size_t suffix_length = filter_glob.length() - 1;
+
+  if ( length < suffix_length )
+    return false;
+
+  return std::memcmp ( name + length - suffix_length
+                     , filter_glob.c_str() + 1
+                     , suffix_length ) == 0;
+}
+
+//----------------------------------------------------------------------
+uInt64 FFileDialog::getSortKey (const char* const name)
+{
+  // Packs the first eight case-folded bytes of the name
+  // in the order of strcasecmp()
+
+  uInt64 key{0};
+  std::size_t i{0};
+
+  for (; i < sizeof(key) && name[i] != '\0'; i++)
+    key = (key << 8) | uChar(std::tolower(uChar(name[i])));
+
+  for (; i < sizeof(key); i++)
+    key <<= 8;
+
+  return key;
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::clear()
+{
+  // delete all directory entries;
+  for (auto&& entry : dir_entries)
+    std::free (entry.name);
+
+  for (auto&& entry : scan_entries)
+    std::free (entry.name);
+
+  dir_entries.clear();
+  dir_entries.shrink_to_fit();
+  scan_entries.clear();
+  scan_entries.shrink_to_fit();
 }
 
 //----------------------------------------------------------------------
 void FFileDialog::sortDir()
 {
-  sInt64 start{0};
+  // Sort the newly read entries and merge them into the sorted list
 
-  if ( std::strcmp((*dir_entries.begin()).name, "..") == 0 )
-    start = 1;
+  if ( scan_entries.empty() )
+    return;
 
-  sInt64 dir_num = numOfDirs();
-  // directories first
-  std::sort ( dir_entries.begin() + start
-            , dir_entries.end()
-            , sortDirFirst );
-  // sort directories by name
-  std::sort ( dir_entries.begin() + start
-            , dir_entries.begin() + dir_num
-            , sortByName );
-  // sort files by name
-  std::sort ( dir_entries.begin() + dir_num
-            , dir_entries.end()
-            , sortByName );
+  std::sort ( scan_entries.begin()
+            , scan_entries.end()
+            , sortDirEntries );
+  const auto middle = dir_entries.size();
+  dir_entries.insert ( dir_entries.end()
+                     , scan_entries.begin()
+                     , scan_entries.end() );
+  scan_entries.clear();
+  std::inplace_merge ( dir_entries.begin()
+                     , dir_entries.begin() + dirEntries::difference_type(middle)
+                     , dir_entries.end()
+                     , sortDirEntries );
 }
 
 //----------------------------------------------------------------------
 int FFileDialog::readDir()
 {
+  // Cancel a directory scan that is still running
+  stopReadDir();
+  compileFilter();
+
   const char* const dir = directory.c_str();
   directory_stream = opendir(dir);
 
@@ -505,6 +596,28 @@ int FFileDialog::readDir()
   }
 
   clear();
+  select_entry.clear();
+
+  if ( readDirEntries() )
+    return finishReadDir();
+
+  // Show the first entries and read the rest in the background
+  showDirEntries();
+  static constexpr int scan_interval = 10;  // 10 ms
+  scan_timer_id = addTimer(scan_interval);
+  return 0;
+}
+
+//----------------------------------------------------------------------
+bool FFileDialog::readDirEntries()
+{
+  // Reads directory entries for one time slice
+  // and returns true when the end of the directory is reached
+
+  static constexpr uInt64 time_slice = 50000;  // 50 ms
+  const char* const dir = directory.c_str();
+  timeval start{};
+  getCurrentTime (&start);
 
   while ( true )
   {
@@ -530,6 +643,9 @@ int FFileDialog::readDir()
         continue;
 
       getEntry(dir, next);
+
+      if ( isTimeout(&start, time_slice) )
+        return false;
     }
     else if ( errno != 0 )
     {
@@ -542,39 +658,96 @@ int FFileDialog::readDir()
       break;
   }  // end while
 
-  if ( closedir(directory_stream) != 0 )
+  return true;
+}
+
+//----------------------------------------------------------------------
+int FFileDialog::finishReadDir()
+{
+  if ( scan_timer_id )
+  {
+    delTimer(scan_timer_id);
+    scan_timer_id = 0;
+  }
+
+  int ret = closedir(directory_stream);
+  directory_stream = nullptr;
+
+  if ( ret != 0 )
   {
     FMessageBox::error (this, "Closing directory\n" + directory);
     return -2;
   }
 
-  sortDir();
-
   // Insert directory entries into the list
-  dirEntriesToList();
-
+  showDirEntries();
+  select_entry.clear();
   return 0;
 }
 
+//----------------------------------------------------------------------
+void FFileDialog::stopReadDir()
+{
+  if ( scan_timer_id )
+  {
+    delTimer(scan_timer_id);
+    scan_timer_id = 0;
+  }
+
+  if ( directory_stream )
+  {
+    closedir(directory_stream);
+    directory_stream = nullptr;
+  }
+}
+
 //----------------------------------------------------------------------
 void FFileDialog::getEntry (const char* const dir, struct dirent* d_entry)
 {
-  const char* const filter = filter_pattern.c_str();
   dir_entry entry{};
 
-  entry.name = strdup(d_entry->d_name);
+  // The name is copied only if the entry is kept
+  entry.name = d_entry->d_name;
 
 #if defined _DIRENT_HAVE_D_TYPE || defined HAVE_STRUCT_DIRENT_D_TYPE
-  entry.fifo             = (d_entry->d_type & DT_FIFO) == DT_FIFO;
-  entry.character_device = (d_entry->d_type & DT_CHR ) == DT_CHR;
-  entry.directory        = (d_entry->d_type & DT_DIR ) == DT_DIR;
-  entry.block_device     = (d_entry->d_type & DT_BLK ) == DT_BLK;
-  entry.regular_file     = (d_entry->d_type & DT_REG ) == DT_REG;
-  entry.symbolic_link    = (d_entry->d_type & DT_LNK ) == DT_LNK;
-  entry.socket           = (d_entry->d_type & DT_SOCK) == DT_SOCK;
-#else
+  if ( d_entry->d_type != DT_UNKNOWN )
+  {
+    entry.fifo             = d_entry->d_type == DT_FIFO;
+    entry.character_device = d_entry->d_type == DT_CHR;
+    entry.directory        = d_entry->d_type == DT_DIR;
+    entry.block_device     = d_entry->d_type == DT_BLK;
+    entry.regular_file     = d_entry->d_type == DT_REG;
+    entry.symbolic_link    = d_entry->d_type == DT_LNK;
+    entry.socket           = d_entry->d_type == DT_SOCK;
+  }
+  else
+#endif
+    getEntryType (dir, entry);  // stat only without a usable d_type
+
+  followSymLink (dir, entry);
+
+  if ( ! entry.directory && ! matchFilter(entry.name) )
+    return;
+
+  entry.name = strdup(entry.name);
+  entry.sort_key = getSortKey(entry.name);
+  scan_entries.push_back (entry);
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::getEntryType (const char* const dir, dir_entry& entry)
+{
+  char path[MAXPATHLEN]{};
   struct stat s{};
-  stat (entry.name, &s);
+
+  std::strncpy (path, dir, sizeof(path));
+  path[sizeof(path) - 1] = '\0';
+  std::strncat (path, entry.name, sizeof(path) - std::strlen(path) - 1);
+  path[sizeof(path) - 1] = '\0';
+
+  if ( lstat(path, &s) == -1 )
+    return;  // Cannot get file status
+
   entry.fifo             = S_ISFIFO (s.st_mode);
   entry.character_device = S_ISCHR (s.st_mode);
   entry.directory        = S_ISDIR (s.st_mode);
@@ -582,16 +755,6 @@ void FFileDialog::getEntry (const char* const dir, struct dirent* d_entry)
   entry.regular_file     = S_ISREG (s.st_mode);
   entry.symbolic_link    = S_ISLNK (s.st_mode);
   entry.socket           = S_ISSOCK (s.st_mode);
-#endif
-
-  followSymLink (dir, entry);
-
-  if ( entry.directory )
-    dir_entries.push_back (entry);
-  else if ( pattern_match(filter, entry.name) )
-    dir_entries.push_back (entry);
-  else
-    std::free(entry.name);
 }
 
 //----------------------------------------------------------------------
@@ -624,6 +787,47 @@ void FFileDialog::followSymLink (const char* const dir, dir_entry& entry)
     entry.directory = true;
 }
 
+//----------------------------------------------------------------------
+void FFileDialog::showDirEntries()
+{
+  // Merges the newly read entries into the list
+  // and keeps the selected entry
+
+  const std::size_t n = filebrowser.currentItem();
+  dir_entry current{};
+
+  if ( n > 0 && n <= dir_entries.size() )
+    current = dir_entries[n - 1];
+
+  sortDir();
+  dirEntriesToList();
+
+  if ( ! select_entry.isEmpty() )
+  {
+    const FString name(select_entry);
+    selectDirectoryEntry (name.c_str());
+    return;
+  }
+
+  if ( ! current.name )
+    return;
+
+  auto range = std::equal_range ( dir_entries.begin()
+                                , dir_entries.end()
+                                , current
+                                , sortDirEntries );
+  auto iter = std::find_if ( range.first
+                           , range.second
+                           , [&current] (const dir_entry& entry)
+                             {
+                               return entry.name == current.name;
+                             }
+                           );
+
+  if ( iter != range.second )
+    filebrowser.setCurrentItem(std::size_t(iter - dir_entries.begin()) + 1);
+}
+
 //----------------------------------------------------------------------
 void FFileDialog::dirEntriesToList()
 {
@@ -634,21 +838,23 @@ void FFileDialog::dirEntriesToList()
   if ( dir_entries.empty() )
     return;
 
+  FListBox::listBoxItems items{};
+  items.reserve(dir_entries.size());
+
   for (auto&& entry : dir_entries)
   {
+    items.emplace_back(FString(entry.name));
+
     if ( entry.directory )
-      filebrowser.insert(FString(entry.name), fc::SquareBrackets);
-    else
-      filebrowser.insert(FString(entry.name));
+      items.back().setBrackets(fc::SquareBrackets);
   }
+
+  filebrowser.insert(items.begin(), items.end());
 }
 
 //----------------------------------------------------------------------
 void FFileDialog::selectDirectoryEntry (const char* const name)
 {
-  if ( dir_entries.empty() )
-    return;
-
   std::size_t i{1};
 
   for (auto&& entry : dir_entries)
@@ -657,11 +863,16 @@ void FFileDialog::selectDirectoryEntry (const char* const name)
     {
       filebrowser.setCurrentItem(i);
       filename.setText(FString(name) + '/');
-      break;
+      select_entry.clear();
+      return;
     }
 
     i++;
   }
+
+  // Not read yet - try again with the next entries
+  if ( directory_stream )
+    select_entry.setString(name);
 }
 
 //----------------------------------------------------------------------
@@ -676,7 +887,7 @@ int FFileDialog::changeDir (const FString& dirname)
   if ( newdir.includes('~') )
     newdir = newdir.replace('~', getHomeDir());
 
-  if ( newdir[0] == '/' )
+  if ( ! newdir.isEmpty() && newdir.front() == '/' )
     setPath(newdir);
   else
     setPath(directory + newdir);
@@ -703,7 +914,7 @@ int FFileDialog::changeDir (const FString& dirname)
           selectDirectoryEntry (baseName);
         }
       }
-      else
+      else if ( ! dir_entries.empty() )
       {
         FString firstname(dir_entries[0].name);
 
@@ -782,23 +993,22 @@ void FFileDialog::cb_processActivate (FWidget*, FDataPtr)
   }
   else
   {
-    bool found{false};
     const auto& input = filename.getText().trim();
-
-    if ( ! dir_entries.empty() )
-    {
-      found = std::any_of ( std::begin(dir_entries)
-                          , std::end(dir_entries)
-                          , [&input] (dir_entry& entry)
-                            {
-                              return entry.name
-                                  && input
-                                  && ! input.isNull()
-                                  && std::strcmp(entry.name, input) == 0
-                                  && entry.directory;
-                            }
-                          );
-    }
+    auto is_input_dir = [&input] (dir_entry& entry)
+                        {
+                          return entry.name
+                              && input
+                              && ! input.isNull()
+                              && std::strcmp(entry.name, input) == 0
+                              && entry.directory;
+                        };
+    // Entries of a running directory scan are not yet in dir_entries
+    bool found = std::any_of ( std::begin(dir_entries)
+                             , std::end(dir_entries)
+                             , is_input_dir )
+              || std::any_of ( std::begin(scan_entries)
+                             , std::end(scan_entries)
+                             , is_input_dir );
 
     if ( found )
       changeDir(input);
@@ -0,0 +1,222 @@
+/***********************************************************************
+* fglyphstore.cpp - Interned storage for grapheme clusters             *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cwchar>
+#include <string>
+#include <utility>
+
+#include "final/fglyphstore.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr uInt                   FGlyphStore::FIRST_ID;
+constexpr uInt                   FGlyphStore::MAX_COUNT;
+constexpr wchar_t                FGlyphStore::ZERO_WIDTH_JOINER;
+FGlyphStore::FGlyphStorage       FGlyphStore::storage{};
+FGlyphStore::FGlyphStorage       FGlyphStore::old_storage{};
+uInt                             FGlyphStore::generation{0};
+
+
+//----------------------------------------------------------------------
+// class FGlyphStore
+//----------------------------------------------------------------------
+
+// public methods of FGlyphStore
+//----------------------------------------------------------------------
+wchar_t FGlyphStore::getBaseCharacter (wchar_t glyph)
+{
+  if ( ! isCluster(glyph) )
+    return glyph;
+
+  std::size_t length{0};
+  const wchar_t* code_points = getCodePoints(glyph, length);
+
+  if ( ! code_points )
+    return L'\xfffd';  // Replacement character
+
+  return code_points[0];
+}
+
+//----------------------------------------------------------------------
+std::wstring FGlyphStore::getString (wchar_t glyph)
+{
+  if ( ! isCluster(glyph) )
+    return std::wstring(1, glyph);
+
+  std::size_t length{0};
+  const wchar_t* code_points = getCodePoints(glyph, length);
+
+  if ( ! code_points )
+    return std::wstring(1, L'\xfffd');  // Replacement character
+
+  return std::wstring(code_points, length);
+}
+
+//----------------------------------------------------------------------
+bool FGlyphStore::extendsGlyph (wchar_t glyph, wchar_t ch)
+{
+  // Is ch a part of the grapheme cluster of glyph?
+
+  if ( glyph < L' ' )  // Control characters are not extendable
+    return false;
+
+  if ( isCluster(glyph) )
+  {
+    std::size_t length{0};
+    const wchar_t* code_points = getCodePoints(glyph, length);
+
+    // The character after a zero width joiner belongs to the cluster
+    if ( code_points && code_points[length - 1] == ZERO_WIDTH_JOINER )
+      return ch >= L' ';
+  }
+
+  return isExtendingCharacter(ch);
+}
+
+//----------------------------------------------------------------------
+wchar_t FGlyphStore::intern (const wchar_t s[], std::size_t length)
+{
+  // Returns the glyph for the code point sequence s
+
+  if ( ! s || length == 0 )
+    return L'\0';
+
+  if ( length == 1 )  // Single code points are stored inline
+    return s[0];
+
+  const std::size_t key = hash(s, length);
+  const auto range = storage.lookup.equal_range(key);
+
+  for (auto iter = range.first; iter != range.second; ++iter)
+  {
+    const auto& entry = storage.entries[iter->second];
+
+    if ( entry.length == length
+      && std::wmemcmp(&storage.arena[entry.offset], s, length) == 0 )
+      return wchar_t(FIRST_ID + iter->second);
+  }
+
+  // Append the new cluster to the arena
+  const std::size_t index = storage.entries.size();
+
+  if ( index >= MAX_COUNT )  // No more ids: keep the base character
+    return s[0];
+
+  const FGlyphEntry entry = { storage.arena.size(), length };
+  storage.arena.insert (storage.arena.end(), s, s + length);
+  storage.entries.push_back(entry);
+  storage.lookup.insert ({key, index});
+  return wchar_t(FIRST_ID + index);
+}
+
+//----------------------------------------------------------------------
+wchar_t FGlyphStore::combine (wchar_t glyph, wchar_t ch)
+{
+  // Appends the code point ch to glyph
+
+  std::wstring cluster(getString(glyph));
+  cluster.push_back(ch);
+  return intern (cluster.data(), cluster.length());
+}
+
+//----------------------------------------------------------------------
+void FGlyphStore::startCompaction()
+{
+  // Starts with an empty arena. Glyphs still in use must be
+  // transferred with relocate() before finishCompaction() is called.
+
+  std::swap (storage, old_storage);
+  storage = FGlyphStorage{};
+  generation++;
+}
+
+//----------------------------------------------------------------------
+wchar_t FGlyphStore::relocate (wchar_t glyph)
+{
+  if ( ! isCluster(glyph) )
+    return glyph;
+
+  std::size_t length{0};
+  const wchar_t* code_points = getCodePoints(old_storage, glyph, length);
+
+  if ( ! code_points )
+    return L'\xfffd';  // Replacement character
+
+  return intern (code_points, length);
+}
+
+//----------------------------------------------------------------------
+void FGlyphStore::finishCompaction()
+{
+  old_storage = FGlyphStorage{};  // Releases the old arena
+}
+
+//----------------------------------------------------------------------
+void FGlyphStore::clear()
+{
+  storage = FGlyphStorage{};
+  generation++;
+}
+
+
+// private methods of FGlyphStore
+//----------------------------------------------------------------------
+std::size_t FGlyphStore::hash (const wchar_t s[], std::size_t length)
+{
+  // FNV-1a hash over the code points
+
+  std::size_t value{2166136261u};
+
+  for (std::size_t i{0}; i < length; i++)
+  {
+    value ^= std::size_t(s[i]);
+    value *= 16777619u;
+  }
+
+  return value;
+}
+
+//----------------------------------------------------------------------
+const wchar_t* FGlyphStore::getCodePoints ( const FGlyphStorage& glyph_storage
+                                          , wchar_t glyph
+                                          , std::size_t& length )
+{
+  // Returns the code points of a cluster or nullptr
+
+  length = 0;
+
+  if ( ! isCluster(glyph) )
+    return nullptr;
+
+  const std::size_t index = uInt(glyph) - FIRST_ID;
+
+  if ( index >= glyph_storage.entries.size() )
+    return nullptr;
+
+  const auto& entry = glyph_storage.entries[index];
+  length = entry.length;
+  return &glyph_storage.arena[entry.offset];
+}
+
+}  // namespace finalcut
@@ -114,16 +114,18 @@ bool& FKeyboard::unprocessedInput()
 }
 
 //----------------------------------------------------------------------
-bool FKeyboard::isKeyPressed()
+bool FKeyboard::isKeyPressed (uInt64 blocking_time)
 {
+  // Waits up to blocking_time microseconds (default: 100 ms) for input
+
   fd_set ifds{};
   struct timeval tv{};
   int stdin_no = FTermios::getStdIn();
 
   FD_ZERO(&ifds);
   FD_SET(stdin_no, &ifds);
-  tv.tv_sec  = 0;
-  tv.tv_usec = 100000;  // 100 ms
+  tv.tv_sec  = time_t(blocking_time / 1000000);
+  tv.tv_usec = suseconds_t(blocking_time % 1000000);
   int result = select (stdin_no + 1, &ifds, 0, 0, &tv);
 
   if ( result > 0 && FD_ISSET(stdin_no, &ifds) )
@@ -112,6 +112,8 @@ void FLabel::setAlignment (fc::text_alignment align)
     alignment = fc::alignLeft;
   else
     alignment = align;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -143,6 +145,8 @@ void FLabel::setText (const FString& txt)
     delAccelerator();
     setHotkeyAccelerator();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -377,7 +381,7 @@ void FLabel::drawSingleLine()
 }
 
 //----------------------------------------------------------------------
-void FLabel::printLine (FString&& line)
+void FLabel::printLine (const FString& line)
 {
   std::size_t to_char{};
   std::size_t to_column{};
@@ -402,12 +406,14 @@ void FLabel::printLine (FString&& line)
 
   for (std::size_t z{0}; z < to_char; z++)
   {
-    if ( ! std::iswprint(std::wint_t(line[z])) )
+    wchar_t ch = line[z];
+
+    if ( ! std::iswprint(std::wint_t(ch)) )
     {
-      if ( ! isNewFont() && ( line[z] < fc::NF_rev_left_arrow2
-                           || line[z] > fc::NF_check_mark ) )
+      if ( ! isNewFont() && ( ch < fc::NF_rev_left_arrow2
+                           || ch > fc::NF_check_mark ) )
       {
-        line[z] = L' ';
+        ch = L' ';
       }
     }
 
@@ -419,7 +425,7 @@ void FLabel::printLine (FString&& line)
       if ( ! getFlags().no_underline )
         setUnderline();
 
-      print (line[z]);
+      print (ch);
 
       if ( ! getFlags().no_underline )
         unsetUnderline();
@@ -430,7 +436,7 @@ void FLabel::printLine (FString&& line)
         setColor();
     }
     else
-      print (line[z]);
+      print (ch);
   }
 
   if ( column_width > width )
@@ -174,6 +174,7 @@ bool FLineEdit::setReadOnly (bool enable)
   else
     setVisibleCursor();
 
+  invalidate();
   return (read_only = enable);
 }
 
@@ -199,6 +200,8 @@ void FLineEdit::setText (const FString& txt)
 
     adjustTextOffset();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -219,6 +222,8 @@ void FLineEdit::setMaxLength (std::size_t max)
 
     adjustTextOffset();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -237,6 +242,8 @@ void FLineEdit::setCursorPosition (std::size_t pos)
 
   if ( isShown() )
     adjustTextOffset();
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -245,6 +252,7 @@ void FLineEdit::setLabelText (const FString& ltxt)
   label_text.setString(ltxt);
   label->setText(label_text);
   adjustLabel();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -252,6 +260,7 @@ void FLineEdit::setLabelOrientation (const label_o o)
 {
   label_orientation = o;
   adjustLabel();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -294,6 +303,7 @@ void FLineEdit::clear()
   char_width_offset = 0;
   text.clear();
   print_text.clear();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -840,7 +850,7 @@ inline bool FLineEdit::isPasswordField() const
 }
 
 //----------------------------------------------------------------------
-inline FLineEdit::offsetPair FLineEdit::endPosToOffset (std::size_t pos)
+inline FLineEdit::offsetPair FLineEdit::endPosToOffset (std::size_t pos) const
 {
   std::size_t input_width = getWidth() - 2;
   std::size_t fullwidth_char_offset{0};
@@ -884,7 +894,7 @@ inline FLineEdit::offsetPair FLineEdit::endPosToOffset (std::size_t pos)
 }
 
 //----------------------------------------------------------------------
-std::size_t FLineEdit::clickPosToCursorPos (std::size_t pos)
+std::size_t FLineEdit::clickPosToCursorPos (std::size_t pos) const
 {
   std::size_t click_width{0};
   std::size_t idx = text_offset;
@@ -907,6 +917,7 @@ std::size_t FLineEdit::clickPosToCursorPos (std::size_t pos)
 //----------------------------------------------------------------------
 void FLineEdit::adjustTextOffset()
 {
+  const FString& txt = print_text;  // Read-only access
   std::size_t input_width = getWidth() - 2;
   std::size_t len = print_text.getLength();
   std::size_t len_column = getColumnWidth (print_text);
@@ -920,7 +931,7 @@ void FLineEdit::adjustTextOffset()
   {
     try
     {
-      cursor_char_width = getColumnWidth(print_text[cursor_pos]);
+      cursor_char_width = getColumnWidth(txt[cursor_pos]);
     }
     catch (const std::out_of_range& ex)
     {
@@ -929,7 +940,7 @@ void FLineEdit::adjustTextOffset()
   }
 
   if ( len > 0 )
-    first_char_width = getColumnWidth(print_text[0]);
+    first_char_width = getColumnWidth(txt[0]);
 
   // Text alignment right for long lines
   while ( text_offset > 0 && len_column - text_offset_column < input_width )
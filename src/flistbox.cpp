@@ -51,6 +51,14 @@ FListBoxItem::FListBoxItem (const FListBoxItem& item)
   , selected(item.selected)
 { }
 
+//----------------------------------------------------------------------
+FListBoxItem::FListBoxItem (FListBoxItem&& item) noexcept
+  : text(std::move(item.text))
+  , data_pointer(item.data_pointer)
+  , brackets(item.brackets)
+  , selected(item.selected)
+{ }
+
 //----------------------------------------------------------------------
 FListBoxItem::FListBoxItem (const FString& txt, FDataPtr data)
   : text(txt)
@@ -79,6 +87,23 @@ FListBoxItem& FListBoxItem::operator = (const FListBoxItem& item)
   }
 }
 
+//----------------------------------------------------------------------
+FListBoxItem& FListBoxItem::operator = (FListBoxItem&& item) noexcept
+{
+  if ( &item == this )
+  {
+    return *this;
+  }
+  else
+  {
+    text         = std::move(item.text);
+    data_pointer = item.data_pointer;
+    brackets     = item.brackets;
+    selected     = item.selected;
+    return *this;
+  }
+}
+
 
 //----------------------------------------------------------------------
 // class FListBox
@@ -100,6 +125,23 @@ FListBox::~FListBox()  // destructor
 
 
 // public methods of FListBox
+//----------------------------------------------------------------------
+FListBoxItem FListBox::getRowItem (std::size_t index) const
+{
+  // Returns a copy of an item. In virtual mode, it comes from
+  // the row provider and does not change the loaded page.
+
+  if ( conv_type == virtual_rows )
+  {
+    FListBoxItem item{};
+    row_provider (item, index - 1);
+    item.selected = selected_rows.count(index - 1) > 0;
+    return item;
+  }
+
+  return *index2iterator(index - 1);
+}
+
 //----------------------------------------------------------------------
 void FListBox::setCurrentItem (std::size_t index)
 {
@@ -119,13 +161,15 @@ void FListBox::setCurrentItem (std::size_t index)
   yoffset = 0;
   adjustSize();
   vbar->setValue(yoffset);
+  invalidate();
   redraw();
 }
 
 //----------------------------------------------------------------------
 void FListBox::setCurrentItem (listBoxItems::iterator iter)
 {
-  std::size_t index = std::size_t(std::distance(itemlist.begin(), iter)) + 1;
+  std::size_t index = std::size_t(std::distance(itemlist.begin(), iter))
+                    + row_offset + 1;
   setCurrentItem(index);
 }
 
@@ -179,6 +223,32 @@ void FListBox::setGeometry ( const FPoint& pos, const FSize& size
 void FListBox::setText (const FString& txt)
 {
   text.setString(txt);
+  invalidate();
+}
+
+//----------------------------------------------------------------------
+void FListBox::setRowCount (std::size_t count)
+{
+  // Sets the number of rows of the row provider
+
+  if ( conv_type != virtual_rows )
+    return;
+
+  row_count = count;
+  itemlist.clear();  // Fetch the visible rows again
+  selected_rows.erase (selected_rows.lower_bound(count), selected_rows.end());
+  last_yoffset = -1;
+
+  if ( current > count )
+    current = count;
+  else if ( current == 0 && count > 0 )
+    current = 1;
+
+  if ( yoffset > int(count) - int(getHeight()) + 2 )
+    yoffset = std::max(0, int(count) - int(getHeight()) + 2);
+
+  recalculateVerticalBar (count);
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -191,6 +261,9 @@ void FListBox::hide()
 //----------------------------------------------------------------------
 void FListBox::insert (FListBoxItem listItem)
 {
+  if ( conv_type == virtual_rows )  // The rows come from the provider
+    return;
+
   std::size_t column_width = getColumnWidth(listItem.text);
   bool has_brackets(listItem.brackets);
   recalculateHorizontalBar (column_width, has_brackets);
@@ -202,12 +275,47 @@ void FListBox::insert (FListBoxItem listItem)
 
   std::size_t element_count = getCount();
   recalculateVerticalBar (element_count);
+  invalidate();
+}
+
+//----------------------------------------------------------------------
+void FListBox::insert ( listBoxItems::iterator first
+                      , listBoxItems::iterator last )
+{
+  // Moves the items into the list
+
+  if ( conv_type == virtual_rows )  // The rows come from the provider
+    return;
+
+  itemlist.reserve (itemlist.size() + std::size_t(std::distance(first, last)));
+  std::size_t max_width{0};
+
+  while ( first != last )
+  {
+    std::size_t column_width = getColumnWidth(first->text);
+
+    if ( first->brackets != fc::NoBrackets )
+      column_width += 2;
+
+    if ( column_width > max_width )
+      max_width = column_width;
+
+    itemlist.push_back (std::move(*first));
+    ++first;
+  }
+
+  if ( current == 0 && ! itemlist.empty() )
+    current = 1;
+
+  recalculateHorizontalBar (max_width, false);
+  recalculateVerticalBar (getCount());
+  invalidate();
 }
 
 //----------------------------------------------------------------------
 void FListBox::remove (std::size_t item)
 {
-  if ( item > getCount() )
+  if ( item > getCount() || conv_type == virtual_rows )
     return;
 
   itemlist.erase (itemlist.begin() + int(item) - 1);
@@ -251,6 +359,8 @@ void FListBox::remove (std::size_t item)
 
   if ( yoffset < 0 )
     yoffset = 0;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -258,6 +368,16 @@ void FListBox::clear()
 {
   itemlist.clear();
   itemlist.shrink_to_fit();
+
+  if ( conv_type == virtual_rows )
+  {
+    conv_type = no_convert;
+    row_provider = nullptr;
+    row_count = 0;
+    row_offset = 0;
+    selected_rows.clear();
+  }
+
   current = 0;
   xoffset = 0;
   yoffset = 0;
@@ -287,6 +407,8 @@ void FListBox::clear()
   {
     print() << FPoint(2, 2 + y) << FString(size, L' ');
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -812,7 +934,7 @@ void FListBox::drawHeadline()
 //----------------------------------------------------------------------
 void FListBox::drawList()
 {
-  if ( itemlist.empty() || getHeight() <= 2 || getWidth() <= 4 )
+  if ( getCount() == 0 || getHeight() <= 2 || getWidth() <= 4 )
     return;
 
   std::size_t start{};
@@ -831,7 +953,23 @@ void FListBox::drawList()
     start = std::min(last_pos, current_pos);
     num = std::max(last_pos, current_pos) + 1;
   }
+  else if ( last_yoffset >= 0
+         && last_yoffset != yoffset
+         && num == getHeight() - 2 )
+  {
+    // speed up: let the terminal scroll the unchanged rows
+    int distance = yoffset - last_yoffset;
+    FRect box ( FPoint(getTermX() + 1, getTermY() + 1)
+              , FSize(getWidth() - nf_offset - 2, num) );
 
+    if ( distance > 0 )
+      scrollAreaForward (getPrintArea(), box, std::size_t(distance));
+    else
+      scrollAreaReverse (getPrintArea(), box, std::size_t(-distance));
+  }
+
+  // Fetch the visible rows in virtual mode
+  loadRows (std::size_t(yoffset));
   auto iter = index2iterator(start + std::size_t(yoffset));
 
   for (std::size_t y = start; y < num && iter != itemlist.end() ; y++)
@@ -874,7 +1012,7 @@ inline void FListBox::drawListLine ( int y
   bool isCurrentLine( y + yoffset + 1 == int(current) );
   std::size_t first = std::size_t(xoffset) + 1;
   std::size_t max_width = getWidth() - nf_offset - 4;
-  FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(iter), first, max_width));
   std::size_t column_width = getColumnWidth(element);
 
   if ( isMonochron() && isCurrentLine && getFlags().focus )
@@ -941,7 +1079,7 @@ inline void FListBox::drawListBracketsLine ( int y
 
   std::size_t first = std::size_t(xoffset);
   std::size_t max_width = getWidth() - nf_offset - 4 - b;
-  FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(iter), first, max_width));
   std::size_t column_width = getColumnWidth(element);
   std::size_t text_width = getColumnWidth(getString(iter));
   std::size_t i{0};
@@ -1405,6 +1543,8 @@ void FListBox::scrollToX (int val)
 
   if ( xoffset < 0 )
     xoffset = 0;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -1432,6 +1572,8 @@ void FListBox::scrollToY (int val)
 
   if ( current > element_count )
     current = element_count;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -1555,24 +1697,11 @@ inline bool FListBox::spacebarProcessing()
   if ( inc_len > 0 )  // Enter a spacebar for incremental search
   {
     inc_search += L' ';
-    bool inc_found{false};
-    auto iter = itemlist.begin();
+    std::size_t index = findIncSearchItem();
 
-    while ( iter != itemlist.end() )
-    {
-      if ( ! inc_found
-        && inc_search.toLower()
-        == iter->getText().left(inc_len + 1).toLower() )
-      {
-        setCurrentItem(iter);
-        inc_found = true;
-        break;
-      }
-
-      ++iter;
-    }
-
-    if ( ! inc_found )
+    if ( index > 0 )
+      setCurrentItem(index);
+    else
     {
       inc_search.remove(inc_len, 1);
       return false;
@@ -1631,19 +1760,10 @@ inline bool FListBox::deletePreviousCharacter()
 
     if ( inc_len > 1 )
     {
-      auto iter = itemlist.begin();
-
-      while ( iter != itemlist.end() )
-      {
-        if ( inc_search.toLower()
-             == iter->getText().left(inc_len - 1).toLower() )
-        {
-          setCurrentItem(iter);
-          break;
-        }
+      std::size_t index = findIncSearchItem();
 
-        ++iter;
-      }
+      if ( index > 0 )
+        setCurrentItem(index);
     }
 
     return true;
@@ -1665,24 +1785,11 @@ inline bool FListBox::keyIncSearchInput (FKey key)
     inc_search += wchar_t(key);
 
   std::size_t inc_len = inc_search.getLength();
-  bool inc_found{false};
-  auto iter = itemlist.begin();
+  std::size_t index = findIncSearchItem();
 
-  while ( iter != itemlist.end() )
-  {
-    if ( ! inc_found
-      && inc_search.toLower()
-      == iter->getText().left(inc_len).toLower() )
-    {
-      setCurrentItem(iter);
-      inc_found = true;
-      break;
-    }
-
-    ++iter;
-  }
-
-  if ( ! inc_found )
+  if ( index > 0 )
+    setCurrentItem(index);
+  else
   {
     inc_search.remove(inc_len - 1, 1);
 
@@ -1742,6 +1849,128 @@ void FListBox::lazyConvert(listBoxItems::iterator iter, int y)
     hbar->redraw();
 }
 
+//----------------------------------------------------------------------
+std::size_t FListBox::findIncSearchItem()
+{
+  // Returns the number of the first item that starts with
+  // the search text (or 0 if there is none)
+
+  const FString search = inc_search.toLower();
+  const std::size_t len = search.getLength();
+
+  if ( conv_type == virtual_rows )
+  {
+    // Searches all rows of the provider, not only the loaded page
+    for (std::size_t index{0}; index < row_count; index++)
+    {
+      FListBoxItem row{};
+      row_provider (row, index);
+
+      if ( search == row.getText().left(len).toLower() )
+        return index + 1;
+    }
+
+    return 0;
+  }
+
+  for (std::size_t index{0}; index < itemlist.size(); index++)
+  {
+    if ( search == itemlist[index].getText().left(len).toLower() )
+      return index + 1;
+  }
+
+  return 0;
+}
+
+//----------------------------------------------------------------------
+void FListBox::loadRows (std::size_t first)
+{
+  std::size_t max_width = loadPage(first);
+
+  if ( max_width == 0 )
+    return;
+
+  std::size_t max_line_width_before = max_line_width;
+  recalculateHorizontalBar (max_width, false);
+
+  if ( max_line_width != max_line_width_before && hbar->isShown() )
+    hbar->redraw();
+}
+
+//----------------------------------------------------------------------
+std::size_t FListBox::loadPage (std::size_t first) const
+{
+  // Fills the page with the rows from first on and
+  // returns the width of the widest loaded row
+
+  if ( conv_type != virtual_rows || first >= row_count )
+    return 0;
+
+  std::size_t page_height = ( getHeight() > 2 ) ? getHeight() - 2 : 1;
+  std::size_t num = std::min(page_height, row_count - first);
+
+  if ( row_offset == first && itemlist.size() == num )
+    return 0;  // Rows are already loaded
+
+  std::size_t max_width{0};
+  itemlist.clear();
+  itemlist.resize(num);
+  row_offset = first;
+
+  for (std::size_t n{0}; n < num; n++)
+  {
+    auto& item = itemlist[n];
+    row_provider (item, first + n);
+    item.selected = selected_rows.count(first + n) > 0;
+    std::size_t column_width = getColumnWidth(item.text);
+
+    if ( item.brackets != fc::NoBrackets )
+      column_width += 2;
+
+    if ( column_width > max_width )
+      max_width = column_width;
+  }
+
+  return max_width;
+}
+
+//----------------------------------------------------------------------
+FListBoxItem& FListBox::getRow (std::size_t index) const
+{
+  // Returns a copy of a row in virtual mode. Page loads do not
+  // touch the copy, it is replaced by the next getRow() call.
+
+  if ( index >= row_offset && index < row_offset + itemlist.size() )
+    row_item = itemlist[index - row_offset];
+  else
+  {
+    row_item = FListBoxItem();
+    row_provider (row_item, index);
+    row_item.selected = selected_rows.count(index) > 0;
+  }
+
+  return row_item;
+}
+
+//----------------------------------------------------------------------
+void FListBox::setRowSelection (std::size_t index, bool enable)
+{
+  if ( conv_type != virtual_rows )
+  {
+    index2iterator(index)->selected = enable;
+    return;
+  }
+
+  // The selection of a virtual row outlives the loaded page
+  if ( enable )
+    selected_rows.insert(index);
+  else
+    selected_rows.erase(index);
+
+  if ( index >= row_offset && index < row_offset + itemlist.size() )
+    itemlist[index - row_offset].selected = enable;
+}
+
 //----------------------------------------------------------------------
 void FListBox::cb_VBarChange (FWidget*, FDataPtr)
 {
@@ -270,11 +270,16 @@ void FListViewItem::setText (int column, const FString& text)
       int column_width = int(getColumnWidth(text));
 
       if ( column_width > listview->header[index].width )
+      {
         listview->header[index].width = column_width;
+        listview->header_revision++;
+      }
     }
   }
 
   column_list[index] = text;
+  revision++;
+  invalidateListView();
 }
 
 //----------------------------------------------------------------------
@@ -320,6 +325,8 @@ void FListViewItem::expand()
     return;
 
   is_expand = true;
+  resetVisibleLineCounter();
+  invalidateListView();
 }
 
 //----------------------------------------------------------------------
@@ -329,7 +336,8 @@ void FListViewItem::collapse()
     return;
 
   is_expand = false;
-  visible_lines = 1;
+  resetVisibleLineCounter();
+  invalidateListView();
 }
 
 // private methods of FListView
@@ -373,6 +381,8 @@ void FListViewItem::replaceControlCodes()
     *iter = iter->replaceControlCodes();
     ++iter;
   }
+
+  revision++;
 }
 
 //----------------------------------------------------------------------
@@ -381,11 +391,10 @@ std::size_t FListViewItem::getVisibleLines()
   if ( visible_lines > 1 )
     return visible_lines;
 
+  visible_lines = 1;  // The item itself
+
   if ( ! isExpand() || ! hasChildren() )
-  {
-    visible_lines = 1;
     return visible_lines;
-  }
 
   auto iter = FObject::begin();
 
@@ -411,6 +420,8 @@ void FListViewItem::setCheckable (bool enable)
     if ( ! root_obj->hasCheckableItems() && isCheckable() )
       root_obj->has_checkable_items = true;
   }
+
+  invalidateListView();
 }
 
 //----------------------------------------------------------------------
@@ -424,6 +435,28 @@ void FListViewItem::resetVisibleLineCounter()
     auto parent_item = static_cast<FListViewItem*>(parent);
     return parent_item->resetVisibleLineCounter();
   }
+
+  if ( parent && parent->isInstanceOf("FListView") )
+  {
+    // The visible rows are rebuilt
+    auto listview = static_cast<FListView*>(parent);
+    listview->visible_line_count = 0;
+    listview->last_first_line_position = -1;
+  }
+}
+
+//----------------------------------------------------------------------
+void FListViewItem::invalidateListView() const
+{
+  // The changed item is drawn by the list view
+
+  auto parent = getParent();
+
+  while ( parent && parent->isInstanceOf("FListViewItem") )
+    parent = parent->getParent();
+
+  if ( parent && parent->isInstanceOf("FListView") )
+    static_cast<FListView*>(parent)->invalidate();
 }
 
 
@@ -594,15 +627,18 @@ FListView::~FListView()  // destructor
 //----------------------------------------------------------------------
 std::size_t FListView::getCount()
 {
-  int n{0};
+  // The lines are only counted again after an expansion change
+
+  if ( visible_line_count > 0 )
+    return visible_line_count;
 
   for (auto&& item : itemlist)
   {
     auto listitem = static_cast<FListViewItem*>(item);
-    n += listitem->getVisibleLines();
+    visible_line_count += listitem->getVisibleLines();
   }
 
-  return std::size_t(n);
+  return visible_line_count;
 }
 
 //----------------------------------------------------------------------
@@ -675,6 +711,8 @@ void FListView::setColumnAlignment (int column, fc::text_alignment align)
   // Convert column position to address offset (index)
   std::size_t index = std::size_t(column - 1);
   header[index].alignment = align;
+  header_revision++;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -693,10 +731,14 @@ void FListView::setColumnText (int column, const FString& label)
     int column_width = int(getColumnWidth(label));
 
     if ( column_width > header[index].width )
+    {
       header[index].width = column_width;
+      header_revision++;
+    }
   }
 
   header[index].name = label;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -725,6 +767,7 @@ void FListView::setColumnSort (int column, fc::sorting_order order)
 
   sort_column = column;
   sort_order = order;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -740,6 +783,8 @@ int FListView::addColumn (const FString& label, int width)
     new_column.fixed_width = true;
 
   header.push_back (new_column);
+  header_revision++;
+  invalidate();
   return int(std::distance(header.begin(), header.end()));
 }
 
@@ -748,6 +793,7 @@ void FListView::hide()
 {
   FWidget::hide();
   hideArea (getSize());
+  last_first_line_position = -1;
 }
 
 //----------------------------------------------------------------------
@@ -786,6 +832,8 @@ FObject::iterator FListView::insert ( FListViewItem* item
     item_iter = FListView::null_iter;
 
   afterInsertion();  // post-processing
+  last_first_line_position = -1;
+  invalidate();
   return item_iter;
 }
 
@@ -863,6 +911,8 @@ void FListView::sort()
 
   current_iter = itemlist.begin();
   first_visible_line = itemlist.begin();
+  last_first_line_position = -1;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -1262,6 +1312,7 @@ void FListView::adjustSize()
   std::size_t element_count = getCount();
   std::size_t width = getClientWidth();
   std::size_t height = getClientHeight();
+  last_first_line_position = -1;  // The rows are drawn again
 
   adjustViewport (int(element_count));
 
@@ -1465,6 +1516,8 @@ void FListView::drawScrollbars()
 //----------------------------------------------------------------------
 void FListView::drawHeadlines()
 {
+  headerline.clear();
+
   if ( header.empty()
     || getHeight() <= 2
     || getWidth() <= 4
@@ -1472,7 +1525,6 @@ void FListView::drawHeadlines()
     return;
 
   headerItems::const_iterator iter = header.begin();
-  headerline.clear();
 
   if ( hasCheckableItems() )
     drawHeaderBorder(4);  // Draw into FTermBuffer object
@@ -1504,6 +1556,23 @@ void FListView::drawList()
   uInt y{0};
   uInt page_height = uInt(getHeight()) - 2;
   auto iter = first_visible_line;
+  int first_line_position = first_visible_line.getPosition();
+
+  if ( last_first_line_position >= 0
+    && last_first_line_position != first_line_position )
+  {
+    // speed up: let the terminal scroll the unchanged rows
+    int distance = first_line_position - last_first_line_position;
+    FRect box ( FPoint(getTermX() + 1, getTermY() + 1)
+              , FSize(getWidth() - nf_offset - 2, page_height) );
+
+    if ( distance > 0 )
+      scrollAreaForward (getPrintArea(), box, std::size_t(distance));
+    else
+      scrollAreaReverse (getPrintArea(), box, std::size_t(-distance));
+  }
+
+  last_first_line_position = first_line_position;
 
   while ( iter != itemlist.end() && y < page_height )
   {
@@ -1556,7 +1625,84 @@ void FListView::drawListLine ( const FListViewItem* item
   setLineAttributes (is_current, is_focus);
 
   // Print the entry
-  std::size_t indent = item->getDepth() << 1;  // indent = 2 * depth
+  print (getLineText(item));
+}
+
+//----------------------------------------------------------------------
+inline void FListView::setLineAttributes ( bool is_current
+                                         , bool is_focus )
+{
+  const auto& wc = getFWidgetColors();
+  setColor (wc.list_fg, wc.list_bg);
+
+  if ( is_current )
+  {
+    if ( is_focus && getMaxColor() < 16 )
+      setBold();
+
+    if ( isMonochron() )
+      unsetBold();
+
+    if ( is_focus )
+    {
+      setColor ( wc.current_element_focus_fg
+               , wc.current_element_focus_bg );
+    }
+    else
+      setColor ( wc.current_element_fg
+               , wc.current_element_bg );
+
+    if ( isMonochron() )
+      setReverse(false);
+  }
+  else
+  {
+    if ( isMonochron() )
+      setReverse(true);
+    else if ( is_focus && getMaxColor() < 16 )
+      unsetBold();
+  }
+}
+
+//----------------------------------------------------------------------
+const FString& FListView::getLineText (const FListViewItem* item)
+{
+  // Returns the visible part of the item line. The line layout
+  // is cached in the item and only recreated if the column layout,
+  // the horizontal scroll position, the item text or its state
+  // has changed.
+
+  auto& layout = item->line_layout;
+  std::size_t width = getWidth() - nf_offset - 2;
+  uInt depth = item->getDepth();
+  uInt8 state = getLineState(item);
+
+  if ( layout.valid
+    && layout.xoffset == std::size_t(xoffset)
+    && layout.width == width
+    && layout.header_revision == header_revision
+    && layout.revision == item->revision
+    && layout.depth == depth
+    && layout.state == state )
+    return layout.text;
+
+  layout.text = createLineText (item, depth);
+  layout.xoffset = std::size_t(xoffset);
+  layout.width = width;
+  layout.header_revision = header_revision;
+  layout.revision = item->revision;
+  layout.depth = depth;
+  layout.state = state;
+  layout.valid = true;
+  return layout.text;
+}
+
+//----------------------------------------------------------------------
+FString FListView::createLineText ( const FListViewItem* item
+                                  , std::size_t depth )
+{
+  // Lay out the columns and cut out the visible part of the line
+  std::size_t indent = depth << 1;  // indent = 2 * depth
   FString line(getLinePrefix (item, indent));
 
   // Print columns
@@ -1613,53 +1759,40 @@ void FListView::drawListLine ( const FListViewItem* item
 
   std::size_t width = getWidth() - nf_offset - 2;
   line = getColumnSubString ( line, std::size_t(xoffset) + 1, width );
-  std::size_t len = line.getLength();
-  std::size_t char_width{0};
+  std::size_t char_width = getColumnWidth(line);
 
-  for (std::size_t i{0}; i < len; i++)
-  {
-    char_width += getColumnWidth(line[i]);
-    print() << line[i];
-  }
+  // Fill the rest of the line with spaces
+  if ( char_width < width )
+    line += FString(width - char_width, L' ');
 
-  for (std::size_t i = char_width; i < width; i++)
-    print (' ');
+  return line;
 }
 
 //----------------------------------------------------------------------
-inline void FListView::setLineAttributes ( bool is_current
-                                         , bool is_focus )
+inline uInt8 FListView::getLineState (const FListViewItem* item)
 {
-  const auto& wc = getFWidgetColors();
-  setColor (wc.list_fg, wc.list_bg);
+  // Returns the flags that change the line prefix
+  uInt8 state{0};
 
-  if ( is_current )
-  {
-    if ( is_focus && getMaxColor() < 16 )
-      setBold();
+  if ( tree_view )
+    state |= 0x01;
 
-    if ( isMonochron() )
-      unsetBold();
+  if ( isNewFont() )
+    state |= 0x02;
 
-    if ( is_focus )
-    {
-      setColor ( wc.current_element_focus_fg
-               , wc.current_element_focus_bg );
-    }
-    else
-      setColor ( wc.current_element_fg
-               , wc.current_element_bg );
+  if ( item->isExpandable() )
+    state |= 0x04;
 
-    if ( isMonochron() )
-      setReverse(false);
-  }
-  else
-  {
-    if ( isMonochron() )
-      setReverse(true);
-    else if ( is_focus && getMaxColor() < 16 )
-      unsetBold();
-  }
+  if ( item->isExpand() )
+    state |= 0x08;
+
+  if ( item->isCheckable() )
+    state |= 0x10;
+
+  if ( item->isChecked() )
+    state |= 0x20;
+
+  return state;
 }
 
 //----------------------------------------------------------------------
@@ -1677,7 +1810,7 @@ inline FString FListView::getCheckBox (const FListViewItem* item)
     checkbox.setString("[ ] ");
 
     if ( item->isChecked() )
-      checkbox[1] = fc::Times;  // Times ×
+      checkbox.overwrite (fc::Times, 1);  // Times ×
   }
 
   return checkbox;
@@ -1842,9 +1975,9 @@ void FListView::drawBufferedHeadline()
     if ( left_truncated_fullwidth )
       column_width++;
 
-    for (auto&& tc : FTermBuffer(first, last))
+    for (auto iter = first; iter != last; ++iter)
     {
-      uInt8 char_width = tc.attr.bit.char_width;
+      uInt8 char_width = iter->attr.bit.char_width;
 
       if ( column_width + char_width > getClientWidth() )
       {
@@ -1947,7 +2080,10 @@ std::size_t FListView::determineLineWidth (FListViewItem* item)
         len = getColumnWidth(item->column_list[column_idx]);
 
       if ( len > width )
+      {
         header_item.width = int(len);
+        header_revision++;
+      }
     }
 
     // width + trailing space
@@ -2217,6 +2353,10 @@ FObject::iterator FListView::appendItem (FListViewItem* item)
   item->root = root;
   addChild (item);
   itemlist.push_back (item);
+
+  if ( visible_line_count > 0 )
+    visible_line_count += item->getVisibleLines();
+
   return --itemlist.end();
 }
 
@@ -2536,6 +2676,8 @@ void FListView::scrollToX (int x)
 
   if ( xoffset < 0 )
     xoffset = 0;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -2565,6 +2707,8 @@ void FListView::scrollToY (int y)
     first_visible_line += differenz;
     last_visible_line += differenz;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -2690,7 +2834,9 @@ void FListView::cb_HBarChange (FWidget*, FDataPtr)
 
   if ( isShown() )
   {
-    drawHeadlines();
+    // The header line is unchanged, only its visible part is shifted
+    setColor();
+    drawBufferedHeadline();
     drawList();
     updateTerminal();
     flush();
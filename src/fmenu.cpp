@@ -1333,20 +1333,22 @@ inline void FMenu::drawCheckMarkPrefix (FMenuItem* m_item)
 }
 
 //----------------------------------------------------------------------
-inline void FMenu::drawMenuText (menuText& data)
+inline void FMenu::drawMenuText (const menuText& data)
 {
   // Print menu text
 
   for (std::size_t z{0}; z < data.text.getLength(); z++)
   {
-    if ( ! std::iswprint(std::wint_t(data.text[z])) )
+    wchar_t ch = data.text[z];
+
+    if ( ! std::iswprint(std::wint_t(ch)) )
     {
       if ( ! isNewFont()
-        && ( data.text[z] < fc::NF_rev_left_arrow2
-          || data.text[z] > fc::NF_check_mark )
-        && ! charEncodable(wchar_t(data.text[z])) )
+        && ( ch < fc::NF_rev_left_arrow2
+          || ch > fc::NF_check_mark )
+        && ! charEncodable(ch) )
       {
-        data.text[z] = L' ';
+        ch = L' ';
       }
     }
 
@@ -1358,7 +1360,7 @@ inline void FMenu::drawMenuText (menuText& data)
       if ( ! data.no_underline )
         setUnderline();
 
-      print (data.text[z]);
+      print (ch);
 
       if ( ! data.no_underline )
         unsetUnderline();
@@ -1366,7 +1368,7 @@ inline void FMenu::drawMenuText (menuText& data)
       setColor();
     }
     else
-      print (data.text[z]);
+      print (ch);
   }
 }
 
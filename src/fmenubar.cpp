@@ -587,7 +587,7 @@ inline void FMenuBar::setCursorToHotkeyPosition ( FMenuItem* menuitem
 }
 
 //----------------------------------------------------------------------
-inline void FMenuBar::drawMenuText (menuText& data)
+inline void FMenuBar::drawMenuText (const menuText& data)
 {
   // Print menu text
 
@@ -596,13 +596,15 @@ inline void FMenuBar::drawMenuText (menuText& data)
     if ( data.startpos > screenWidth - z )
       break;
 
-    if ( ! std::iswprint(std::wint_t(data.text[z])) )
+    wchar_t ch = data.text[z];
+
+    if ( ! std::iswprint(std::wint_t(ch)) )
     {
       if ( ! isNewFont()
-        && ( data.text[z] < fc::NF_rev_left_arrow2
-          || data.text[z] > fc::NF_check_mark ) )
+        && ( ch < fc::NF_rev_left_arrow2
+          || ch > fc::NF_check_mark ) )
       {
-        data.text[z] = L' ';
+        ch = L' ';
       }
     }
 
@@ -614,7 +616,7 @@ inline void FMenuBar::drawMenuText (menuText& data)
       if ( ! data.no_underline )
         setUnderline();
 
-      print (data.text[z]);
+      print (ch);
 
       if ( ! data.no_underline )
         unsetUnderline();
@@ -622,7 +624,7 @@ inline void FMenuBar::drawMenuText (menuText& data)
       setColor();
     }
     else
-      print (data.text[z]);
+      print (ch);
   }
 }
 
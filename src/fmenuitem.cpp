@@ -155,6 +155,8 @@ void FMenuItem::setSelected()
     selected = true;
     processActivate();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -163,6 +165,7 @@ void FMenuItem::unsetSelected()
   selected = false;
   unsetCursorPos();
   processDeactivate();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -180,6 +183,7 @@ void FMenuItem::setText (const FString& txt)
   }
 
   updateSuperMenuDimensions();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -20,11 +20,13 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <cstdio>
 #include <cstring>
 
 #include "final/fc.h"
 #include "final/foptiattr.h"
 #include "final/fstartoptions.h"
+#include "final/ftruecolor.h"
 
 namespace finalcut
 {
@@ -552,6 +554,7 @@ char* FOptiAttr::changeAttribute (FChar*& term, FChar*& next)
   if ( ! (term && next) )
     return attr_buf;
 
+  quantize_direct_color (next);
   prevent_no_color_video_attributes (term, next_has_color);
   prevent_no_color_video_attributes (next);
   detectSwitchOn (term, next);
@@ -1407,10 +1410,12 @@ void FOptiAttr::change_color (FChar*& term, FChar*& next)
     return;
   }
 
-  if ( next->fg_color != fc::Default )
+  if ( next->fg_color != fc::Default
+    && ! FTrueColor::isDirectColor(next->fg_color) )
     next->fg_color %= max_color;
 
-  if ( next->bg_color != fc::Default )
+  if ( next->bg_color != fc::Default
+    && ! FTrueColor::isDirectColor(next->bg_color) )
     next->bg_color %= max_color;
 
   FColor fg = next->fg_color;
@@ -1498,10 +1503,12 @@ inline void FOptiAttr::change_current_color ( FChar*& term
     auto ansi_bg = vga2ansi(bg);
 
     if ( (term->fg_color != fg || frev)
+      && ! append_direct_color (38, fg)
       && (color_str = tparm(AF, ansi_fg, 0, 0, 0, 0, 0, 0, 0, 0)) )
       append_sequence (color_str);
 
     if ( (term->bg_color != bg || frev)
+      && ! append_direct_color (48, bg)
       && (color_str = tparm(AB, ansi_bg, 0, 0, 0, 0, 0, 0, 0, 0)) )
       append_sequence (color_str);
   }
@@ -1525,6 +1532,37 @@ inline void FOptiAttr::change_current_color ( FChar*& term
   }
 }
 
+//----------------------------------------------------------------------
+inline void FOptiAttr::quantize_direct_color (FChar*& attr)
+{
+  // Replaces direct colors by the nearest palette color if
+  // the terminal cannot display 24-bit colors. Neighboring cells
+  // with the same approximation need no further color sequence.
+
+  if ( true_color && F_set_a_foreground.cap && F_set_a_background.cap )
+    return;
+
+  attr->fg_color = FTrueColor::quantize(attr->fg_color, max_color);
+  attr->bg_color = FTrueColor::quantize(attr->bg_color, max_color);
+}
+
+//----------------------------------------------------------------------
+inline bool FOptiAttr::append_direct_color (int sgr, FColor color)
+{
+  // SGR 38 (foreground) or SGR 48 (background) with a 24-bit color
+
+  if ( ! FTrueColor::isDirectColor(color) )
+    return false;
+
+  char color_str[32]{};
+  std::snprintf ( color_str, sizeof(color_str), CSI "%d;2;%d;%d;%dm"
+                , sgr, FTrueColor::getRed(color)
+                , FTrueColor::getGreen(color)
+                , FTrueColor::getBlue(color) );
+  append_sequence (color_str);
+  return true;
+}
+
 //----------------------------------------------------------------------
 inline void FOptiAttr::resetAttribute (FChar*& attr)
 {
@@ -67,6 +67,7 @@ void FProgressbar::setPercentage (std::size_t percentage_value)
   }
 
   updateTerminal();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -129,6 +130,7 @@ void FProgressbar::reset()
   }
 
   updateTerminal();
+  invalidate();
 }
 
 
@@ -65,6 +65,7 @@ void FScrollbar::setMinimum (int minimum)
 {
   min = minimum;
   calculateSliderValues();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -72,6 +73,7 @@ void FScrollbar::setMaximum (int maximum)
 {
   max = maximum;
   calculateSliderValues();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -80,6 +82,7 @@ void FScrollbar::setRange (int minimum, int maximum)
   min = minimum;
   max = maximum;
   calculateSliderValues();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -93,6 +96,7 @@ void FScrollbar::setValue (int value)
     val = value;
 
   calculateSliderValues();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -105,6 +109,8 @@ void FScrollbar::setSteps (double st)
 
   if ( pagesize == 0 )
     pagesize = int(double(max)/steps);
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -124,6 +130,8 @@ void FScrollbar::setPageSize (int document_size, int page_size)
     else
       steps = double(double(document_size) / double(page_size));
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -144,6 +152,7 @@ void FScrollbar::setOrientation (fc::orientation o)
 
   calculateSliderValues();
   bar_orientation = o;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
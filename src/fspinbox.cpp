@@ -118,6 +118,7 @@ void FSpinBox::setValue (sInt64 n)
     value = n;
 
   updateInputField();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -125,6 +126,8 @@ void FSpinBox::setMinValue (sInt64 n)
 {
   if ( n <= max )
     value = min = n;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -132,6 +135,8 @@ void FSpinBox::setMaxValue (sInt64 n)
 {
   if ( n >= min )
     max = n;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -142,6 +147,8 @@ void FSpinBox::setRange (sInt64 m, sInt64 n)
     value = min = m;
     max = n;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -149,6 +156,7 @@ void FSpinBox::setPrefix (const FString& text)
 {
   pfix = text;
   updateInputField();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -156,6 +164,7 @@ void FSpinBox::setSuffix (const FString& text)
 {
   sfix = text;
   updateInputField();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -423,7 +432,8 @@ void FSpinBox::cb_inputFieldChange (finalcut::FWidget* w, FDataPtr)
   {
     std::wregex regex(L"[-]?[[:xdigit:]]+");
     std::wsmatch match;
-    std::wstring text = lineedit->getText().wc_str();
+    const FString input(lineedit->getText());
+    std::wstring text = input.wc_str();
 
     if ( std::regex_search(text, match, regex) )
     {
@@ -42,7 +42,12 @@ FStartOptions::FStartOptions()
   , sgr_optimizer{true}
   , vgafont{false}
   , newfont{false}
+  , terminal_cache{false}
+  , headless{false}
+  , vcsa{false}
+  , async_output{true}
   , encoding{fc::UNKNOWN}
+  , vcsa_device{}
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
   , meta_sends_escape{true}
   , change_cursorstyle{true}
@@ -91,7 +96,12 @@ void FStartOptions::setDefault()
   color_change = true;
   vgafont = false;
   newfont = false;
+  terminal_cache = false;
+  headless = false;
+  vcsa = false;
+  async_output = true;
   encoding = fc::UNKNOWN;
+  vcsa_device.clear();
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
   meta_sends_escape = true;
@@ -85,6 +85,7 @@ void FStatusKey::setActive()
 {
   active = true;
   processActivate();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -93,6 +94,7 @@ bool FStatusKey::setMouseFocus(bool enable)
   if ( mouse_focus == enable )
     return true;
 
+  invalidate();
   return (mouse_focus = enable);
 }
 
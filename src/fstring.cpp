@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "final/fstring.h"
+#include "final/fstringview.h"
 
 namespace finalcut
 {
@@ -69,14 +70,16 @@ FString::FString (std::size_t len, wchar_t c)
 FString::FString (const FString& s)  // copy constructor
 {
   if ( ! s.isNull() )
+  {
     _assign (s.string);
+    column_width = s.column_width;
+  }
 }
 
 //----------------------------------------------------------------------
-FString::FString (FString&& s)  // move constructor
+FString::FString (FString&& s) noexcept  // move constructor
 {
-  if ( ! s.isNull() )
-    _assign (std::move(s.string));
+  _move (std::move(s));
 }
 
 //----------------------------------------------------------------------
@@ -97,22 +100,14 @@ FString::FString (const wchar_t s[])
 FString::FString (const std::string& s)
 {
   if ( ! s.empty() )
-  {
-    const wchar_t* wc_string = c_to_wc_str(s.c_str());
-    _assign(wc_string);
-    delete[] wc_string;
-  }
+    _assign (s.c_str());
 }
 
 //----------------------------------------------------------------------
 FString::FString (const char s[])
 {
   if ( s )
-  {
-    const wchar_t* wc_string = c_to_wc_str(s);
-    _assign( wc_string );
-    delete[] wc_string;
-  }
+    _assign (s);
 }
 
 //----------------------------------------------------------------------
@@ -151,11 +146,35 @@ FString::FString (const char c)
   }
 }
 
+//----------------------------------------------------------------------
+FString::FString (const FStringView& s)
+{
+  if ( s.isNull() )
+    return;
+
+  // A code unit never results in more than one wide character
+  if ( ! allocateBuffer(s.getSize()) )
+    return;
+
+  std::size_t n{0};
+
+  for (auto&& ch : s)
+  {
+    if ( ch == L'\0' )
+      break;
+
+    string[n] = ch;
+    n++;
+  }
+
+  string[n] = L'\0';
+  length = n;
+}
+
 //----------------------------------------------------------------------
 FString::~FString()  // destructor
 {
-  if ( string )
-    delete[](string);
+  releaseBuffer();
 
   if ( c_string )
     delete[](c_string);
@@ -171,9 +190,18 @@ FString& FString::operator = (const FString& s)
 }
 
 //----------------------------------------------------------------------
-FString& FString::operator = (FString&& s)
+FString& FString::operator = (FString&& s) noexcept
 {
-  _assign (std::move(s.string));
+  if ( &s != this )
+  {
+    releaseBuffer();
+
+    if ( c_string )
+      delete[](c_string);
+
+    _move (std::move(s));
+  }
+
   return *this;
 }
 
@@ -184,35 +212,28 @@ const FString& FString::operator += (const FString& s)
   return *this;
 }
 
-
 //----------------------------------------------------------------------
-const FString FString::operator + (const FString& s)
+const FString& FString::operator += (fc::SpecialCharacter c)
 {
-  FString tmp(string);
-  tmp._insert (length, s.length, s.string);
-  return tmp;
+  *this << c;
+  return *this;
 }
 
 //----------------------------------------------------------------------
-const FString FString::operator + (const wchar_t c)
+const FString& FString::operator += (const wchar_t c)
 {
-  wchar_t s[2]{};
-  s[0] = c;
-  FString tmp(string);
-  tmp._insert (length, 1, s);
-  return tmp;
+  *this << c;
+  return *this;
 }
 
 //----------------------------------------------------------------------
-const FString FString::operator + (const char c)
+const FString& FString::operator += (const char c)
 {
-  wchar_t s[2]{};
-  s[0] = wchar_t(c & 0xff);
-  FString tmp(string);
-  tmp._insert (length, 1, s);
-  return tmp;
+  *this << c;
+  return *this;
 }
 
+
 //----------------------------------------------------------------------
 FString& FString::operator << (const FString& s)
 {
@@ -223,24 +244,31 @@ FString& FString::operator << (const FString& s)
 //----------------------------------------------------------------------
 FString& FString::operator << (fc::SpecialCharacter c)
 {
-  FString s(static_cast<wchar_t>(c));
-  _insert (length, s.length, s.string);
+  const wchar_t wc = static_cast<wchar_t>(c);
+
+  if ( wc )
+    _insert (length, 1, &wc);
+
   return *this;
 }
 
 //----------------------------------------------------------------------
 FString& FString::operator << (const wchar_t c)
 {
-  FString s(c);
-  _insert (length, s.length, s.string);
+  if ( c )
+    _insert (length, 1, &c);
+
   return *this;
 }
 
 //----------------------------------------------------------------------
 FString& FString::operator << (const char c)
 {
-  FString s(c);
-  _insert (length, s.length, s.string);
+  const wchar_t wc = wchar_t(c & 0xff);
+
+  if ( wc )
+    _insert (length, 1, &wc);
+
   return *this;
 }
 
@@ -362,12 +390,9 @@ std::size_t FString::getUTF8length() const
 //----------------------------------------------------------------------
 FString FString::clear()
 {
-  if ( string )
-    delete[](string);
-
-  length  = 0;
-  bufsize = 0;
-  string  = nullptr;
+  releaseBuffer();
+  length = 0;
+  invalidateCache();
   return *this;
 }
 
@@ -384,6 +409,7 @@ wchar_t* FString::wc_str()
 {
   // Returns a wide character string
 
+  exposeBuffer();  // The string can be changed
   return string;
 }
 
@@ -393,7 +419,7 @@ const char* FString::c_str() const
   // Returns a constant c-string
 
   if ( length > 0 )
-    return wc_to_c_str (string);
+    return ( c_string_valid && ! exposed ) ? c_string : wc_to_c_str (string);
   else if ( string )
     return const_cast<char*>("");
   else
@@ -406,7 +432,7 @@ char* FString::c_str()
   // Returns a c-string
 
   if ( length > 0 )
-    return wc_to_c_str (string);
+    return ( c_string_valid && ! exposed ) ? c_string : wc_to_c_str (string);
   else if ( string )
     return const_cast<char*>("");
   else
@@ -427,7 +453,7 @@ FString FString::toLower() const
                   {
                     c = wchar_t(std::towlower(std::wint_t(c)));
                   };
-  std::for_each (s.begin(), s.end(), to_lower);
+  std::for_each (s.string, s.string + s.length, to_lower);
   return s;
 }
 
@@ -439,7 +465,7 @@ FString FString::toUpper() const
                   {
                     c = wchar_t(std::towupper(std::wint_t(c)));
                   };
-  std::for_each (s.begin(), s.end(), to_upper);
+  std::for_each (s.string, s.string + s.length, to_upper);
   return s;
 }
 
@@ -635,41 +661,32 @@ double FString::toDouble() const
 //----------------------------------------------------------------------
 FString FString::ltrim() const
 {
-  FString s(string);
-
   // handle NULL and empty string
   if ( ! (string && *string) )
-    return s;
+    return *this;
 
-  const wchar_t* p = s.string;
+  const wchar_t* p = string;
 
   while ( std::iswspace(std::wint_t(*p)) )
     p++;
 
-  return FString(p);
+  return FStringView(p, length - std::size_t(p - string));
 }
 
 //----------------------------------------------------------------------
 FString FString::rtrim() const
 {
-  FString s(string);
-
   // handle NULL and empty string
   if ( ! (string && *string) )
-    return s;
-
-  wchar_t* p = s.string;
-  wchar_t* last = p + length;
+    return *this;
 
-  while ( std::iswspace(std::wint_t(*--last)) && last > p )
-    s.length--;
+  const wchar_t* p = string;
+  const wchar_t* last = p + length;
 
-  if ( last == p && std::iswspace(std::wint_t(*last)) )
-    s = L"";
-  else
-    *(last + 1) = '\0';
+  while ( last > p && std::iswspace(std::wint_t(*(last - 1))) )
+    last--;
 
-  return s;
+  return FStringView(p, std::size_t(last - p));
 }
 
 //----------------------------------------------------------------------
@@ -686,46 +703,35 @@ FString FString::trim() const
 //----------------------------------------------------------------------
 FString FString::left (std::size_t len) const
 {
-  FString s(string);
-
   // handle NULL and empty string
   if ( ! (string && *string) )
-    return s;
+    return *this;
 
   if ( len > length )
-    return s;
+    return *this;
 
-  wchar_t* p = s.string;
-  s.length = len;
-  *(p + len) = '\0';
-  return s;
+  return FStringView(string, len);
 }
 
 //----------------------------------------------------------------------
 FString FString::right (std::size_t len) const
 {
-  FString s(string);
-
   // handle NULL and empty string
   if ( ! (string && *string) )
-    return s;
+    return *this;
 
   if ( len > length )
-    return s;
+    return *this;
 
-  const wchar_t* p = s.string;
-  p += (length - len);
-  return FString(p);
+  return FStringView(string + length - len, len);
 }
 
 //----------------------------------------------------------------------
 FString FString::mid (std::size_t pos, std::size_t len) const
 {
-  FString s(string);
-
   // handle NULL and empty string
   if ( ! (string && *string) )
-    return s;
+    return *this;
 
   if ( pos == 0 )
     pos = 1;
@@ -736,10 +742,7 @@ FString FString::mid (std::size_t pos, std::size_t len) const
   if ( pos > length || pos + len - 1 > length || len == 0 )
     return FString(L"");
 
-  wchar_t* p = s.string;
-  wchar_t* first = p + pos - 1;
-  *(first + len) = '\0';
-  return FString(first);
+  return FStringView(string + pos - 1, len);
 }
 
 //----------------------------------------------------------------------
@@ -947,6 +950,25 @@ bool FString::operator == (const FString& s) const
   return ( std::wcscmp(string, s.string) == 0 );
 }
 
+//----------------------------------------------------------------------
+bool FString::operator == (const FStringView& s) const
+{
+  if ( ! string || s.isNull() )
+    return ! string && s.isNull();
+
+  std::size_t n{0};
+
+  for (auto&& ch : s)
+  {
+    if ( n >= length || string[n] != ch )
+      return false;
+
+    n++;
+  }
+
+  return n == length;
+}
+
 //----------------------------------------------------------------------
 bool FString::operator != (const FString& s) const
 {
@@ -959,6 +981,12 @@ bool FString::operator != (const FString& s) const
   return ( std::wcscmp(string, s.string) != 0 );
 }
 
+//----------------------------------------------------------------------
+bool FString::operator != (const FStringView& s) const
+{
+  return ! (*this == s);
+}
+
 //----------------------------------------------------------------------
 bool FString::operator >= (const FString& s) const
 {
@@ -1052,25 +1080,24 @@ FString FString::replace (const FString& from, const FString& to)
 FString FString::replaceControlCodes() const
 {
   FString s(string);
-
-  for (auto&& c : s)
-  {
-    if ( c <= L'\x1f' )
-    {
-      c += L'\x2400';
-    }
-    else if ( c == L'\x7f' )
-    {
-      c = L'\x2421';
-    }
-    else if ( c >= L'\x80' && c <= L'\x9f' )
-    {
-      c = L' ';
-    }
-    else if ( ! std::iswprint(std::wint_t(c)) )
-      c = L' ';
-  }
-
+  auto replace = [] (wchar_t& c)
+                 {
+                   if ( c <= L'\x1f' )
+                   {
+                     c += L'\x2400';
+                   }
+                   else if ( c == L'\x7f' )
+                   {
+                     c = L'\x2421';
+                   }
+                   else if ( c >= L'\x80' && c <= L'\x9f' )
+                   {
+                     c = L' ';
+                   }
+                   else if ( ! std::iswprint(std::wint_t(c)) )
+                     c = L' ';
+                 };
+  std::for_each (s.string, s.string + s.length, replace);
   return s;
 }
 
@@ -1107,7 +1134,7 @@ FString FString::removeDel() const
   std::size_t i{0};
   std::size_t count{0};
 
-  for (auto&& c : s)
+  for (auto&& c : *this)
   {
     if ( c == 0x7f )
     {
@@ -1136,7 +1163,7 @@ FString FString::removeBackspaces() const
   FString s(string);
   std::size_t i{0};
 
-  for (auto&& c : s)
+  for (auto&& c : *this)
   {
     if ( c != L'\b' )
     {
@@ -1169,6 +1196,8 @@ const FString& FString::overwrite (const FString& s, std::size_t pos)
   if ( pos > length )
     pos = length;
 
+  invalidateCache();
+
   if ( length >= (pos + s.length) )
   {
     std::wcsncpy (string + pos, s.string, s.length);
@@ -1211,23 +1240,58 @@ bool FString::includes (const FString& s) const
 
 // private methods of FString
 //----------------------------------------------------------------------
-inline void FString::initLength (std::size_t len)
+bool FString::allocateBuffer (std::size_t len)
 {
-  if ( len == 0 )
-    return;
+  // Provides a buffer for len characters and the terminating '\0'.
+  // Short strings are stored inside the object without allocation.
+  // The previous buffer is not released.
 
-  length  = len;
-  bufsize = FWDBUFFER + len + 1;
+  if ( len < SSOBUFFER )
+  {
+    string  = sso_buffer;
+    bufsize = SSOBUFFER;
+    return true;
+  }
+
+  wchar_t* sptr{};
 
   try
   {
-    string = new wchar_t[bufsize]();
-    std::wmemset (string, L'\0', bufsize);
+    sptr = new wchar_t[FWDBUFFER + len + 1]();
   }
   catch (const std::bad_alloc& ex)
   {
-    std::cerr << bad_alloc_str << ex.what() << std::endl;
+    std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
+    return false;
   }
+
+  string  = sptr;
+  bufsize = FWDBUFFER + len + 1;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FString::releaseBuffer()
+{
+  if ( isHeapAllocated() )
+    delete[](string);
+
+  string  = nullptr;
+  bufsize = 0;
+}
+
+//----------------------------------------------------------------------
+inline void FString::initLength (std::size_t len)
+{
+  if ( len == 0 )
+    return;
+
+  if ( ! allocateBuffer(len) )
+    return;
+
+  length = len;
+  invalidateCache();
+  std::wmemset (string, L'\0', bufsize);
 }
 
 //----------------------------------------------------------------------
@@ -1242,29 +1306,58 @@ void FString::_assign (const wchar_t s[])
   if ( string && std::wcscmp(string, s) == 0 )
     return;  // string == s
 
-  uInt new_length = uInt(std::wcslen(s));
+  invalidateCache();
+  std::size_t new_length = std::wcslen(s);
+  wchar_t* old_string{nullptr};
 
-  if ( ! string || new_length > capacity() )
+  if ( ! string || new_length >= bufsize )
   {
-    if ( string )
-      delete[](string);
+    if ( isHeapAllocated() )
+      old_string = string;  // s can point into the old buffer
 
-    bufsize = FWDBUFFER + new_length + 1;
+    if ( ! allocateBuffer(new_length) )
+      return;
+  }
 
-    try
-    {
-      string = new wchar_t[bufsize]();
-    }
-    catch (const std::bad_alloc& ex)
+  std::wmemmove (string, s, new_length + 1);
+  length = new_length;
+  delete[] old_string;
+}
+
+//----------------------------------------------------------------------
+void FString::_assign (const char s[])
+{
+  std::size_t len{0};
+
+  while ( s[len] && uChar(s[len]) < 0x80 )
+    len++;
+
+  if ( s[len] != '\0' )  // Multibyte character found
+  {
+    const wchar_t* wc_string = c_to_wc_str(s);
+    _assign (wc_string);
+    delete[] wc_string;
+    return;
+  }
+
+  // 7-bit ASCII characters have the same value in UCS-4
+  invalidateCache();
+
+  if ( ! string || len >= bufsize )
+  {
+    releaseBuffer();
+
+    if ( ! allocateBuffer(len) )
     {
-      std::cerr << bad_alloc_str << ex.what() << std::endl;
+      length = 0;
       return;
     }
   }
 
-  std::wcsncpy (string, s, bufsize);
-  length = new_length;
-  string[capacity()] = L'\0';
+  for (std::size_t i{0}; i <= len; i++)  // incl. '\0'
+    string[i] = wchar_t(uChar(s[i]));
+
+  length = len;
 }
 
 //----------------------------------------------------------------------
@@ -1273,24 +1366,16 @@ void FString::_insert (std::size_t len, const wchar_t s[])
   if ( len == 0 )  // String s is a null or a empty string
     return;
 
-  if ( string )
-    delete[](string);
-
-  length = len;
-  bufsize = FWDBUFFER + length + 1;
+  invalidateCache();
+  releaseBuffer();
+  length = 0;
 
-  try
-  {
-    string = new wchar_t[bufsize]();
-  }
-  catch (const std::bad_alloc& ex)
-  {
-    std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
+  if ( ! allocateBuffer(len) )
     return;
-  }
 
-  std::wcsncpy (string, s, bufsize);
-  string[capacity()] = L'\0';
+  std::wmemcpy (string, s, len);
+  string[len] = L'\0';
+  length = len;
 }
 
 //----------------------------------------------------------------------
@@ -1304,150 +1389,171 @@ void FString::_insert ( std::size_t pos
   if ( ! string )  // string is null
   {
     _insert (len, s);
+    return;
+  }
+
+  if ( length + len < bufsize )
+  {
+    if ( s >= string && s < string + bufsize )
+    {
+      // s is a part of this string and would be overwritten
+      const std::wstring tmp(s, len);
+      _insert (pos, len, tmp.c_str());
+      return;
+    }
+
+    // output string <= bufsize
+    invalidateCache();
+    std::wmemmove (string + pos + len, string + pos, length - pos + 1);
+    std::wmemcpy (string + pos, s, len);
   }
   else
   {
-    std::size_t x{};
+    // output string > bufsize
+    wchar_t* old_string = string;
+    const bool old_on_heap = isHeapAllocated();
 
-    if ( length + len <= capacity() )
-    {
-      // output string <= bufsize
-      for (x = length; x + 1 > pos; x--)  // shifting right side + '\0'
-        string[x + len] = string[x];
+    // Grow geometrically to keep repeated appends linear
+    if ( ! allocateBuffer(std::max(length + len, 2 * length)) )
+      return;
 
-      for (x = 0; x < len; x++)           // insert string
-        string[x + pos] = s[x];
+    invalidateCache();
+    std::wmemcpy (string, old_string, pos);                // left side
+    std::wmemcpy (string + pos, s, len);                   // insert string
+    std::wmemcpy ( string + pos + len, old_string + pos    // right side
+                 , length - pos + 1 );                     // + '\0'
 
-      length += len;
-    }
-    else
-    {
-      // output string > bufsize
-      bufsize = FWDBUFFER + length + len + 1;
-      wchar_t* sptr{};
-
-      try
-      {
-        sptr = new wchar_t[bufsize]();  // generate new string
-      }
-      catch (const std::bad_alloc& ex)
-      {
-        std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
-        return;
-      }
-
-      std::size_t y{0};
-
-      for (x = 0; x < pos; x++)           // left side
-        sptr[y++] = string[x];
-
-      for (x = 0 ; x < len; x++)          // insert string
-        sptr[y++] = s[x];
-
-      for (x = pos; x < length + 1; x++)  // right side + '\0'
-        sptr[y++] = string[x];
-
-      length += len;
-      delete[](string);                   // delete old string
-      string = sptr;
-    }
+    if ( old_on_heap )
+      delete[](old_string);                                // delete old string
   }
+
+  length += len;
 }
 
 //----------------------------------------------------------------------
 void FString::_remove (std::size_t pos, std::size_t len)
 {
-  if ( capacity() - length + len <= FWDBUFFER )
-  {
-    // shifting left side to pos
-    for (std::size_t i = pos; i + len < length + 1; i++)
-      string[i] = string[i + len];
+  if ( ! string || len == 0 )
+    return;
 
-    length -= len;
-  }
-  else
+  invalidateCache();
+  const std::size_t new_length = length - len;
+
+  // A heap buffer that would be less than a quarter used is reduced
+  if ( isHeapAllocated() && (new_length + 1) * 4 < bufsize )
   {
-    bufsize = length + 1 - len + FWDBUFFER;
-    wchar_t* sptr{};
+    wchar_t* old_string = string;
 
-    try
-    {
-      sptr = new wchar_t[bufsize]();    // generate new string
-    }
-    catch (const std::bad_alloc& ex)
+    if ( allocateBuffer(new_length) )
     {
-      std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
+      std::wmemcpy (string, old_string, pos);
+      std::wmemcpy ( string + pos, old_string + pos + len
+                   , length - pos - len + 1 );
+      length = new_length;
+      delete[](old_string);
       return;
     }
+  }
 
-    std::size_t x{}, y{};
-
-    for (x = 0; x < pos; x++)             // left side
-      sptr[y++] = string[x];
+  // shifting the right side + '\0' to pos (the buffer is kept)
+  std::wmemmove (string + pos, string + pos + len, length - pos - len + 1);
+  length = new_length;
+}
 
-    for (x = pos + len; x < length + 1; x++)  // right side + '\0'
-      sptr[y++] = string[x];
+//----------------------------------------------------------------------
+void FString::_move (FString&& s) noexcept
+{
+  // Takes over the buffers of s and leaves s as a null string
 
-    delete[](string);                   // delete old string
-    string = sptr;
-    length -= len;
+  if ( s.isHeapAllocated() )
+    string = s.string;
+  else if ( s.string )
+  {
+    string = sso_buffer;
+    std::wmemcpy (sso_buffer, s.sso_buffer, SSOBUFFER);
   }
+  else
+    string = nullptr;
+
+  length         = s.length;
+  bufsize        = s.bufsize;
+  column_width   = s.column_width;
+  c_string       = s.c_string;
+  c_string_size  = s.c_string_size;
+  c_string_valid = s.c_string_valid;
+  exposed        = s.exposed;
+
+  s.string         = nullptr;
+  s.length         = 0;
+  s.bufsize        = 0;
+  s.column_width   = UNKNOWN_WIDTH;
+  s.c_string       = nullptr;
+  s.c_string_size  = 0;
+  s.c_string_valid = false;
+  s.exposed        = false;
 }
 
 //----------------------------------------------------------------------
 inline char* FString::wc_to_c_str (const wchar_t s[]) const
 {
+  // The converted string stays valid until the next modification
+
   if ( ! s )  // handle NULL string
     return 0;
 
-  if ( ! *s )  // handle empty string
+  const std::size_t len = std::wcslen(s);
+  const std::size_t dest_size = (len + 1) * CHAR_SIZE;
+
+  if ( dest_size > c_string_size )
   {
+    if ( c_string )
+      delete[](c_string);
+
     try
     {
-      // Generate a empty string ("")
-      c_string = new char[1]();
+      c_string = new char[dest_size]();
+      c_string_size = dest_size;
     }
     catch (const std::bad_alloc& ex)
     {
       std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
+      c_string = nullptr;
+      c_string_size = 0;
       return 0;
     }
-
-    return c_string;
   }
 
-  if ( c_string )
-    delete[](c_string);
-
-  int size = int(std::wcslen(s)) + 1;
-  int dest_size = size * int(CHAR_SIZE);
-  const wchar_t* src = s;
-  std::mbstate_t state{};
-  std::memset (&state, '\0', sizeof(mbstate_t));
+  std::size_t i{0};
 
-  try
+  // 7-bit ASCII characters have the same value in all locales
+  while ( i < len && uInt(s[i]) < 0x80 )
   {
-    c_string = new char[std::size_t(dest_size)]();
-
-    // pre-initialiaze the whole string with '\0'
-    std::memset (c_string, '\0', std::size_t(dest_size));
+    c_string[i] = char(s[i]);
+    i++;
   }
-  catch (const std::bad_alloc& ex)
+
+  if ( i < len )  // Multibyte conversion of the rest
   {
-    std::cerr << bad_alloc_str << " " << ex.what() << std::endl;
-    return 0;
-  }
+    const wchar_t* src = s + i;
+    std::mbstate_t state{};
 
-  int mblength = \
-      int(std::wcsrtombs (c_string, &src, std::size_t(dest_size), &state));
+    // pre-initialiaze the rest of the string with '\0'
+    std::memset (c_string + i, '\0', dest_size - i);
+    int mblength = \
+        int(std::wcsrtombs (c_string + i, &src, dest_size - i, &state));
 
-  if ( mblength == -1 && errno != EILSEQ )
-  {
-    delete[](c_string);
-    c_string = nullptr;
-    return const_cast<char*>("");
+    if ( mblength == -1 && errno != EILSEQ )
+    {
+      delete[](c_string);
+      c_string = nullptr;
+      c_string_size = 0;
+      return const_cast<char*>("");
+    }
   }
+  else
+    c_string[len] = '\0';
 
+  c_string_valid = ( s == string );
   return c_string;
 }
 
@@ -1541,81 +1647,86 @@ inline wchar_t* FString::extractToken ( wchar_t* rest[]
 
 // FString non-member operators
 //----------------------------------------------------------------------
-const FString operator + (const FString& s1, const FString& s2)
+FString operator + (const FString& s1, const FString& s2)
 {
   FString tmp(s1);
-  tmp._insert ( uInt(std::wcslen(s1.wc_str()))
-              , uInt(std::wcslen(s2.wc_str()))
-              , s2.wc_str() );
+  tmp._insert (s1.length, s2.length, s2.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const FString& s, const wchar_t c)
+FString operator + (FString&& s1, const FString& s2)
+{
+  // Appends to the buffer of the temporary s1
+  s1._insert (s1.length, s2.length, s2.string);
+  return std::move(s1);
+}
+
+//----------------------------------------------------------------------
+FString operator + (const FString& s, const wchar_t c)
 {
   FString tmp(s);
-  tmp._insert ( uInt(std::wcslen(s.wc_str())), 1, &c);
+  tmp._insert (s.length, 1, &c);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const std::wstring& s1, const FString& s2)
+FString operator + (FString&& s, const wchar_t c)
+{
+  s._insert (s.length, 1, &c);
+  return std::move(s);
+}
+
+//----------------------------------------------------------------------
+FString operator + (const std::wstring& s1, const FString& s2)
 {
   FString tmp(s1);
-  tmp._insert ( uInt(std::wcslen(s1.c_str()))
-              , uInt(std::wcslen(s2.wc_str()))
-              , s2.wc_str() );
+  tmp._insert (tmp.length, s2.length, s2.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const wchar_t s1[], const FString& s2)
+FString operator + (const wchar_t s1[], const FString& s2)
 {
   FString tmp(s1);
-  tmp._insert ( uInt(std::wcslen(s1))
-              , uInt(std::wcslen(s2.wc_str()))
-              , s2.wc_str() );
+  tmp._insert (tmp.length, s2.length, s2.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const std::string& s1, const FString& s2)
+FString operator + (const std::string& s1, const FString& s2)
 {
   FString tmp(s1);
-  tmp._insert ( tmp.getLength()
-              , uInt(std::wcslen(s2.wc_str()))
-              , s2.wc_str() );
+  tmp._insert (tmp.length, s2.length, s2.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const char s1[], const FString& s2)
+FString operator + (const char s1[], const FString& s2)
 {
   FString tmp(s1);
-  tmp._insert ( tmp.getLength()
-              , uInt(std::wcslen(s2.wc_str()))
-              , s2.wc_str() );
+  tmp._insert (tmp.length, s2.length, s2.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const wchar_t c, const FString& s)
+FString operator + (const wchar_t c, const FString& s)
 {
   FString tmp(c);
-  tmp._insert (1, uInt(std::wcslen(s.wc_str())), s.wc_str());
+  tmp._insert (1, s.length, s.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const char c, const FString& s)
+FString operator + (const char c, const FString& s)
 {
   FString tmp(c);
-  tmp._insert (1, uInt(std::wcslen(s.wc_str())), s.wc_str());
+  tmp._insert (1, s.length, s.string);
   return tmp;
 }
 
 //----------------------------------------------------------------------
-const FString operator + (const FString& s, const char c)
+FString operator + (const FString& s, const char c)
 {
   FString tmp1(s);
   wchar_t tmp2[2];
@@ -1625,6 +1736,14 @@ const FString operator + (const FString& s, const char c)
   return tmp1;
 }
 
+//----------------------------------------------------------------------
+FString operator + (FString&& s, const char c)
+{
+  const wchar_t wc = wchar_t(c & 0xff);
+  s._insert (s.length, 1, &wc);
+  return std::move(s);
+}
+
 //----------------------------------------------------------------------
 std::ostream& operator << (std::ostream& outstr, const FString& s)
 {
@@ -1632,12 +1751,12 @@ std::ostream& operator << (std::ostream& outstr, const FString& s)
 
   if ( s.length > 0 )
   {
-    outstr << s.wc_to_c_str(s.string);
+    outstr << s.c_str();
   }
   else if ( width > 0 )
   {
     FString fill_str(width, outstr.fill());
-    outstr << s.wc_to_c_str(fill_str.string);
+    outstr << fill_str.c_str();
   }
 
   return outstr;
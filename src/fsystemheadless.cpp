@@ -0,0 +1,96 @@
+/***********************************************************************
+* fsystemheadless.cpp - FSystem implementation for the virtual         *
+*                       terminal                                       *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include "final/fsystemheadless.h"
+#include "final/ftermheadless.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSystemHeadless
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FSystemHeadless::FSystemHeadless()
+{ }
+
+//----------------------------------------------------------------------
+FSystemHeadless::~FSystemHeadless()  // destructor
+{ }
+
+
+// public methods of FSystemHeadless
+//----------------------------------------------------------------------
+int FSystemHeadless::isTTY (int fd)
+{
+  // stdin and stdout belong to the virtual terminal
+
+  if ( fd == STDIN_FILENO || fd == STDOUT_FILENO )
+    return 1;
+
+  return ::isatty(fd);
+}
+
+//----------------------------------------------------------------------
+int FSystemHeadless::ioctl (int fd, uLong request, ...)
+{
+  va_list args{};
+  va_start (args, request);
+  void* argp = va_arg (args, void*);
+  va_end (args);
+
+  if ( fd != STDIN_FILENO && fd != STDOUT_FILENO )
+    return ::ioctl (fd, request, argp);
+
+  if ( request == TIOCGWINSZ )  // Size of the virtual terminal
+  {
+    const auto& emulator = FTermHeadless::getEmulator();
+    auto win_size = static_cast<struct winsize*>(argp);
+    win_size->ws_col = uShort(emulator.getWidth());
+    win_size->ws_row = uShort(emulator.getHeight());
+    win_size->ws_xpixel = 0;
+    win_size->ws_ypixel = 0;
+    return 0;
+  }
+
+#if defined(TIOCOUTQ)
+  if ( request == TIOCOUTQ )  // The output is never queued
+  {
+    *static_cast<int*>(argp) = 0;
+    return 0;
+  }
+#endif
+
+  return ::ioctl (fd, request, argp);
+}
+
+//----------------------------------------------------------------------
+int FSystemHeadless::putchar (int c)
+{
+  FTermHeadless::write (char(c));
+  return c;
+}
+
+}  // namespace finalcut
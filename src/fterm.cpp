@@ -35,6 +35,7 @@
 #include "final/foptimove.h"
 #include "final/fstartoptions.h"
 #include "final/fstring.h"
+#include "final/fsystemheadless.h"
 #include "final/fsystemimpl.h"
 #include "final/fterm.h"
 #include "final/ftermbuffer.h"
@@ -43,6 +44,9 @@
 #include "final/ftermdata.h"
 #include "final/ftermdebugdata.h"
 #include "final/ftermdetection.h"
+#include "final/ftermheadless.h"
+#include "final/ftermoutput.h"
+#include "final/ftermvcsa.h"
 #include "final/ftermios.h"
 #include "final/ftermxterminal.h"
 
@@ -205,7 +209,10 @@ FSystem* FTerm::getFSystem()
   {
     try
     {
-      fsys = new FSystemImpl;
+      if ( getStartOptions().headless )
+        fsys = new FSystemHeadless;
+      else
+        fsys = new FSystemImpl;
     }
     catch (const std::bad_alloc& ex)
     {
@@ -602,6 +609,12 @@ bool FTerm::canChangeColorPalette()
   return FTermcap::can_change_color_palette;
 }
 
+//----------------------------------------------------------------------
+bool FTerm::hasTrueColor()
+{
+  return FTermcap::true_color;
+}
+
 //----------------------------------------------------------------------
 void FTerm::setTermType (const char term_name[])
 {
@@ -1141,15 +1154,10 @@ wchar_t FTerm::charEncode (wchar_t c)
 wchar_t FTerm::charEncode (wchar_t c, fc::encoding enc)
 {
   wchar_t ch_enc = c;
+  int item = fc::getCharacterItem(c);
 
-  for (std::size_t i{0}; i <= fc::lastCharItem; i++)
-  {
-    if ( fc::character[i][fc::UTF8] == uInt(c) )
-    {
-      ch_enc = wchar_t(fc::character[i][enc]);
-      break;
-    }
-  }
+  if ( item >= 0 )
+    ch_enc = wchar_t(fc::character[item][enc]);
 
   if ( enc == fc::PC && ch_enc == c )
     ch_enc = finalcut::unicode_to_cp437(c);
@@ -1324,11 +1332,37 @@ void FTerm::init_global_values (bool disable_alt_screen)
   if ( ! getStartOptions().terminal_detection )
     term_detection->setTerminalDetection (false);
 
+  if ( getStartOptions().terminal_cache )
+    term_detection->setTerminalCache (true);
+
 #if DEBUG
   debug_data->init();
 #endif
 }
 
+//----------------------------------------------------------------------
+void FTerm::init_headless()
+{
+  // Use the virtual terminal instead of the tty
+
+  if ( ! getStartOptions().headless )
+    return;
+
+  // Use COLUMNS and LINES or fallback to 80x24 characters
+  const uInt width = env2uint ("COLUMNS");
+  const uInt height = env2uint ("LINES");
+
+  if ( ! FTermHeadless::init ( ( width == 0 ) ? 80 : width
+                             , ( height == 0 ) ? 24 : height ) )
+  {
+    std::cerr << "Error: Cannot create the headless terminal" << std::endl;
+    std::abort();
+  }
+
+  // Nobody answers the queries of the terminal detection
+  term_detection->setTerminalDetection (false);
+}
+
 //----------------------------------------------------------------------
 void FTerm::init_terminal_device_path()
 {
@@ -1526,6 +1560,54 @@ void FTerm::init_fixed_max_color()
   }
 }
 
+//----------------------------------------------------------------------
+void FTerm::init_true_color()
+{
+  // Use 24-bit direct colors if the terminal announces them
+
+  if ( FTermcap::max_color < 256 || ! TCAP(fc::t_set_a_foreground) )
+    FTermcap::true_color = false;
+  else if ( term_detection->canDisplayTrueColor() )
+    FTermcap::true_color = true;
+}
+
+//----------------------------------------------------------------------
+void FTerm::init_vcsa()
+{
+  // Use the vcsa device of the virtual console for the screen output
+
+  if ( ! getStartOptions().vcsa || getStartOptions().headless )
+    return;
+
+  FString device = getStartOptions().vcsa_device;
+
+  if ( device.isEmpty() )
+    device = FTermVcsa::getDevicePath(data->getTermFileName());
+
+  if ( ! FTermVcsa::open(device) )
+  {
+    data->setExitMessage ( "Cannot open the vcsa device - "
+                           "escape sequences were used instead" );
+    return;
+  }
+
+  FTermVcsa::setMaxColor (FTermcap::max_color);
+}
+
+//----------------------------------------------------------------------
+void FTerm::init_output()
+{
+  // Write the terminal output without blocking the event loop
+
+  if ( ! getStartOptions().async_output
+    || getStartOptions().headless
+    || ! fsys->isTTY(FTermios::getStdOut()) )
+    return;
+
+  std::fflush(stdout);
+  FTermOutput::open (data->getTermFileName());
+}
+
 //----------------------------------------------------------------------
 void FTerm::init_teraterm_charmap()
 {
@@ -1645,6 +1727,9 @@ void FTerm::init_optiAttr()
   };
 
   opti_attr->setTermEnvironment(optiattr_env);
+
+  if ( FTermcap::true_color )
+    opti_attr->setTrueColor();
 }
 
 //----------------------------------------------------------------------
@@ -1845,6 +1930,9 @@ void FTerm::init_captureFontAndTitle()
 {
   // Save the used xterm font and window title
 
+  if ( getStartOptions().headless )
+    return;
+
   xterm->captureFontAndTitle();
   const auto& font = xterm->getFont();
   const auto& title = xterm->getTitle();
@@ -2211,6 +2299,9 @@ void FTerm::init (bool disable_alt_screen)
   allocationValues();
   init_global_values(disable_alt_screen);
 
+  // Replace the tty with the virtual terminal
+  init_headless();
+
   // Initialize termios
   FTermios::init();
 
@@ -2239,6 +2330,12 @@ void FTerm::init (bool disable_alt_screen)
   // Initialize terminal quirks
   init_quirks();
 
+  // Enable 24-bit colors for capable terminals
+  init_true_color();
+
+  // Write directly into the screen memory of the Linux console
+  init_vcsa();
+
   // Initialize cursor movement optimization
   init_optiMove();
 
@@ -2308,6 +2405,9 @@ void FTerm::init (bool disable_alt_screen)
   // Switch to the raw mode
   FTermios::setRawMode();
 
+  // Send the screen output through a non-blocking file descriptor
+  init_output();
+
   // The terminal is now initialized
   term_initialized = true;
 }
@@ -2376,8 +2476,10 @@ void FTerm::initBaudRate()
 //----------------------------------------------------------------------
 void FTerm::finish()
 {
-  // Set default signal handler
+  // Send the remaining output and return to the blocking stdout
+  FTermOutput::close();
 
+  // Set default signal handler
   const auto& title = data->getXtermTitle();
   resetSignalHandler();
 
@@ -2446,6 +2548,12 @@ void FTerm::finish()
   if ( ! exit_message.isEmpty() )
     std::cerr << exit_message << std::endl;
 
+  // Restore stdin of the headless terminal
+  FTermHeadless::finish();
+
+  // Close the vcsa device
+  FTermVcsa::close();
+
   deallocationValues();
 }
 
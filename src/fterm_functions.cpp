@@ -20,13 +20,12 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
-#if defined(__CYGWIN__)
-  #include "final/fconfig.h"  // includes _GNU_SOURCE for wcwidth()
-#endif
-
 #include <algorithm>
+#include <string>
 
 #include "final/fcharmap.h"
+#include "final/fglyphstore.h"
+#include "final/fstringview.h"
 #include "final/fterm.h"
 #include "final/ftermbuffer.h"
 
@@ -47,6 +46,7 @@ static fullWidthSupport has_fullwidth_support = unknown_fullwidth_support;
 
 // Function prototypes
 bool hasAmbiguousWidth (wchar_t);
+std::size_t getUnicodeColumnWidth (const wchar_t[], std::size_t);
 
 // Data array
 const wchar_t ambiguous_width_list[] =
@@ -217,6 +217,39 @@ inline bool hasAmbiguousWidth (wchar_t wchar)
   return false;
 }
 
+//----------------------------------------------------------------------
+std::size_t getUnicodeColumnWidth (const wchar_t s[], std::size_t length)
+{
+  // Sums up the character widths from the built-in unicode table
+
+  std::size_t column_width{0};
+  std::size_t i{0};
+
+  while ( i + 16 <= length )
+  {
+    // Fast path for 16 printable ASCII characters
+    uInt non_ascii{0};
+
+    for (std::size_t n{0}; n < 16; n++)
+      non_ascii |= uInt(uInt(s[i + n]) - 0x20 >= 0x5f);
+
+    if ( non_ascii )
+    {
+      for (std::size_t n{0}; n < 16; n++)
+        column_width += std::size_t(fc::getCharacterWidth(s[i + n]));
+    }
+    else
+      column_width += 16;
+
+    i += 16;
+  }
+
+  for (; i < length; i++)
+    column_width += std::size_t(fc::getCharacterWidth(s[i]));
+
+  return column_width;
+}
+
 //----------------------------------------------------------------------
 bool isReverseNewFontchar (wchar_t wchar)
 {
@@ -255,18 +288,12 @@ bool hasFullWidthSupports()
 //----------------------------------------------------------------------
 wchar_t cp437_to_unicode (uChar c)
 {
-  constexpr std::size_t CP437 = 0;
   constexpr std::size_t UNICODE = 1;
   wchar_t ucs = c;
+  int item = fc::getCP437Item(c);
 
-  for (std::size_t i{0}; i <= fc::lastCP437Item; i++)
-  {
-    if ( fc::cp437_ucs[i][CP437] == c )  // found
-    {
-      ucs = fc::cp437_ucs[i][UNICODE];
-      break;
-    }
-  }
+  if ( item >= 0 )  // found
+    ucs = fc::cp437_ucs[item][UNICODE];
 
   return ucs;
 }
@@ -275,17 +302,11 @@ wchar_t cp437_to_unicode (uChar c)
 uChar unicode_to_cp437 (wchar_t ucs)
 {
   constexpr std::size_t CP437 = 0;
-  constexpr std::size_t UNICODE = 1;
   uChar c{'?'};
+  int item = fc::getCP437UnicodeItem(ucs);
 
-  for (std::size_t i{0}; i <= fc::lastCP437Item; i++)
-  {
-    if ( fc::cp437_ucs[i][UNICODE] == ucs )  // found
-    {
-      c = uChar(fc::cp437_ucs[i][CP437]);
-      break;
-    }
-  }
+  if ( item >= 0 )  // found
+    c = uChar(fc::cp437_ucs[item][CP437]);
 
   return c;
 }
@@ -295,8 +316,10 @@ FString getFullWidth (const FString& str)
 {
   // Converts half-width to full-width characters
 
-  FString s(str);
-  constexpr std::size_t HALF = 0;
+  if ( str.isEmpty() )
+    return str;
+
+  std::wstring s(str.begin(), str.end());
   constexpr std::size_t FULL = 1;
 
   for (auto&& c : s)
@@ -307,11 +330,10 @@ FString getFullWidth (const FString& str)
     }
     else
     {
-      for (std::size_t i{0}; i <= fc::lastHalfWidthItem; i++)
-      {
-        if ( fc::halfWidth_fullWidth[i][HALF] == c )  // found
-          c = fc::halfWidth_fullWidth[i][FULL];
-      }
+      int item = fc::getHalfWidthItem(c);
+
+      if ( item >= 0 )  // found
+        c = fc::halfWidth_fullWidth[item][FULL];
     }
   }
 
@@ -323,9 +345,11 @@ FString getHalfWidth (const FString& str)
 {
   // Converts full-width to half-width characters
 
-  FString s(str);
+  if ( str.isEmpty() )
+    return str;
+
+  std::wstring s(str.begin(), str.end());
   constexpr std::size_t HALF = 0;
-  constexpr std::size_t FULL = 1;
 
   for (auto&& c : s)
   {
@@ -335,11 +359,10 @@ FString getHalfWidth (const FString& str)
     }
     else
     {
-      for (std::size_t i{0}; i <= fc::lastHalfWidthItem; i++)
-      {
-        if ( fc::halfWidth_fullWidth[i][FULL] == c )  // found
-          c = fc::halfWidth_fullWidth[i][HALF];
-      }
+      int item = fc::getFullWidthItem(c);
+
+      if ( item >= 0 )  // found
+        c = fc::halfWidth_fullWidth[item][HALF];
     }
   }
 
@@ -350,16 +373,16 @@ FString getHalfWidth (const FString& str)
 FString getColumnSubString ( const FString& str
                            , std::size_t col_pos, std::size_t col_len )
 {
-  FString s(str);
   std::size_t col_first{1}, col_num{0}, first{1}, num{0};
+  wchar_t first_char{L'\0'}, last_char{L'\0'};  // Cut full-width characters
 
-  if ( col_len == 0 || s.isEmpty() )
+  if ( col_len == 0 || str.isEmpty() )
     return FString(L"");
 
   if ( col_pos == 0 )
     col_pos = 1;
 
-  for (auto&& ch : s)
+  for (auto&& ch : str)
   {
     std::size_t width = getColumnWidth(ch);
 
@@ -372,7 +395,7 @@ FString getColumnSubString ( const FString& str
       }
       else
       {
-        ch = fc::SingleLeftAngleQuotationMark;  // ‹
+        first_char = fc::SingleLeftAngleQuotationMark;  // ‹
         num = col_num = 1;
         col_pos = col_first;
       }
@@ -386,17 +409,26 @@ FString getColumnSubString ( const FString& str
       }
       else if ( col_num < col_len )
       {
-        ch = fc::SingleRightAngleQuotationMark;  // ›
+        last_char = fc::SingleRightAngleQuotationMark;  // ›
         num++;
         break;
       }
     }
   }
 
-  if ( col_first < col_pos )  // String length < col_pos
+  if ( col_first < col_pos || num == 0 )  // String length < col_pos
     return FString(L"");
 
-  return s.mid(first, num);
+  // Copy the substring only once
+  FString s = FStringView(str.wc_str() + first - 1, num);
+
+  if ( first_char )
+    s.overwrite (first_char, 0);
+
+  if ( last_char )
+    s.overwrite (last_char, num - 1);
+
+  return s;
 }
 
 //----------------------------------------------------------------------
@@ -423,61 +455,79 @@ std::size_t getColumnWidth (const FString& s, std::size_t pos)
   if ( s.isEmpty() )
     return 0;
 
-  std::size_t column_width{0};
   auto length = s.getLength();
 
-  if ( pos > length )
-    pos = length;
+  if ( pos >= length )
+    return getColumnWidth(s);
+
+  if ( ! hasFullWidthSupports() )
+    return pos;  // All characters have a width of 1
+
+  const wchar_t* str = s.wc_str();
+
+#if defined(__NetBSD__) || defined(__OpenBSD__) \
+ || defined(__FreeBSD__) || defined(__DragonFly__) \
+ || defined(__sun) && defined(__SVR4)
+  std::size_t column_width{0};
 
   for (std::size_t i{0}; i < pos; i++)
-  {
-    try
-    {
-      column_width += getColumnWidth(s[i]);
-    }
-    catch (const std::out_of_range& ex)
-    {
-      std::cerr << "Out of Range error: " << ex.what() << std::endl;
-    }
-  }
+    column_width += getColumnWidth(str[i]);
 
   return column_width;
+#else
+  return getUnicodeColumnWidth (str, pos);
+#endif
 }
 
 //----------------------------------------------------------------------
 std::size_t getColumnWidth (const FString& s)
 {
-  int column_width{0};
-
   if ( s.isEmpty() )
     return 0;
 
+  if ( ! hasFullWidthSupports() )
+    return s.getLength();  // All characters have a width of 1
+
+#if defined(__NetBSD__) || defined(__OpenBSD__) \
+ || defined(__FreeBSD__) || defined(__DragonFly__) \
+ || defined(__sun) && defined(__SVR4)
+  std::size_t column_width{0};
+
   for (const auto& wchar : s)
     column_width += getColumnWidth(wchar);
 
-  return ( column_width == -1 ) ? 0 : std::size_t(column_width);
+  return column_width;
+#else
+  // The width of the characters is cached in the string,
+  // unless they can be changed via a pointer or a reference
+  if ( s.exposed )
+    return getUnicodeColumnWidth (s.wc_str(), s.getLength());
+
+  if ( s.column_width == FString::UNKNOWN_WIDTH )
+    s.column_width = getUnicodeColumnWidth (s.wc_str(), s.getLength());
+
+  return s.column_width;
+#endif
 }
 
 //----------------------------------------------------------------------
 std::size_t getColumnWidth (const wchar_t wchar)
 {
-  int column_width{};
+  if ( FGlyphStore::isCluster(wchar) )  // Width of the base character
+    return getColumnWidth(FGlyphStore::getBaseCharacter(wchar));
 
 #if defined(__NetBSD__) || defined(__OpenBSD__) \
  || defined(__FreeBSD__) || defined(__DragonFly__) \
  || defined(__sun) && defined(__SVR4)
   if ( hasAmbiguousWidth(wchar) )
-    column_width = 1;
-  else
+    return 1;
 #endif
 
   if ( (wchar >= fc::NF_rev_left_arrow2 && wchar <= fc::NF_check_mark)
     || ! hasFullWidthSupports() )
-    column_width = 1;
-  else
-    column_width = wcwidth(wchar);
+    return 1;
 
-  return ( column_width == -1 ) ? 0 : std::size_t(column_width);
+  return std::size_t(fc::getCharacterWidth(wchar));
 }
 
 //----------------------------------------------------------------------
@@ -25,6 +25,7 @@
 
 #include "final/fc.h"
 #include "final/fcolorpair.h"
+#include "final/fglyphstore.h"
 #include "final/fstring.h"
 #include "final/ftermbuffer.h"
 #include "final/fvterm.h"
@@ -33,13 +34,46 @@
 namespace finalcut
 {
 
+// static class attributes
+FTermBuffer* FTermBuffer::first_buffer{nullptr};
+
+
 //----------------------------------------------------------------------
 // class FTermBuffer
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FTermBuffer::FTermBuffer()
+{
+  attach();
+}
+
+//----------------------------------------------------------------------
+FTermBuffer::FTermBuffer (const FTermBuffer& buffer)  // copy constructor
+  : data{buffer.data}
+{
+  attach();
+}
+
 //----------------------------------------------------------------------
 FTermBuffer::~FTermBuffer()  // destructor
-{ }
+{
+  detach();
+}
+
 
 // public methods of FTermBuffer
+//----------------------------------------------------------------------
+FTermBuffer& FTermBuffer::operator = (const FTermBuffer& buffer)
+{
+  // The list links stay with the object
+  if ( &buffer != this )
+    data = buffer.data;
+
+  return *this;
+}
+
 //----------------------------------------------------------------------
 const FString FTermBuffer::toString() const
 {
@@ -47,7 +81,12 @@ const FString FTermBuffer::toString() const
   wide_string.reserve(data.size());
 
   for (auto&& fchar : data)
-    wide_string.push_back(fchar.ch);
+  {
+    if ( FGlyphStore::isCluster(fchar.ch) )
+      wide_string += FGlyphStore::getString(fchar.ch);
+    else
+      wide_string.push_back(fchar.ch);
+  }
 
   return FString(wide_string);
 }
@@ -60,6 +99,15 @@ int FTermBuffer::write (const FString& string)
 
   for (auto&& c : string)
   {
+    if ( ! data.empty() && FGlyphStore::extendsGlyph(data.back().ch, c) )
+    {
+      // Add c to the grapheme cluster of the previous character
+      auto& last = data.back();
+      last.ch = FGlyphStore::combine(last.ch, c);
+      getColumnWidth(last);  // update column width
+      continue;
+    }
+
     FChar nc;  // next character
     nc = FVTerm::getAttribute();
     nc.ch = c;
@@ -75,6 +123,15 @@ int FTermBuffer::write (const FString& string)
 //----------------------------------------------------------------------
 int FTermBuffer::write (wchar_t ch)
 {
+  if ( ! data.empty() && FGlyphStore::extendsGlyph(data.back().ch, ch) )
+  {
+    // Add ch to the grapheme cluster of the previous character
+    auto& last = data.back();
+    last.ch = FGlyphStore::combine(last.ch, ch);
+    getColumnWidth(last);  // update column width
+    return 1;
+  }
+
   FChar nc = FVTerm::getAttribute();  // next character
   nc.ch = ch;
   getColumnWidth(nc);  // add column width
@@ -92,6 +149,38 @@ void FTermBuffer::write (const FColorPair& pair)
 }
 
 
+
+// private methods of FTermBuffer
+//----------------------------------------------------------------------
+void FTermBuffer::attach()
+{
+  // Adds the buffer to the list of all buffers, so that the
+  // cluster ids can be relocated by FVTerm
+
+  next_buffer = first_buffer;
+
+  if ( first_buffer )
+    first_buffer->prev_buffer = this;
+
+  first_buffer = this;
+}
+
+//----------------------------------------------------------------------
+void FTermBuffer::detach()
+{
+  if ( prev_buffer )
+    prev_buffer->next_buffer = next_buffer;
+  else
+    first_buffer = next_buffer;
+
+  if ( next_buffer )
+    next_buffer->prev_buffer = prev_buffer;
+
+  prev_buffer = nullptr;
+  next_buffer = nullptr;
+}
+
+
 // FTermBuffer non-member operators
 //----------------------------------------------------------------------
 FTermBuffer::FCharVector& operator << ( FTermBuffer::FCharVector& termString
@@ -0,0 +1,379 @@
+/***********************************************************************
+* ftermcache.cpp - Persistent cache of the terminal replies            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "final/ftermcache.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr std::time_t  FTermCache::MAX_AGE;
+std::string            FTermCache::answerback{};
+std::string            FTermCache::primary_da{};
+std::string            FTermCache::sec_da{};
+int                    FTermCache::max_color{-1};
+bool                   FTermCache::loaded{false};
+
+
+//----------------------------------------------------------------------
+// class FTermCache
+//----------------------------------------------------------------------
+
+// public methods of FTermCache
+//----------------------------------------------------------------------
+const FString FTermCache::getFileName()
+{
+  // Returns the name of the cache file for the current terminal
+
+  const std::string directory = getDirectory();
+
+  if ( directory.empty() )
+    return FString{};
+
+  char name[64]{};
+  std::snprintf ( name, sizeof(name), "/terminal-%016llx.cache"
+                , static_cast<unsigned long long>(hash(getKey())) );
+  return FString(directory + name);
+}
+
+//----------------------------------------------------------------------
+bool FTermCache::load()
+{
+  // Reads the terminal replies of a previous program start
+
+  clear();
+  const FString filename = getFileName();
+
+  if ( filename.isEmpty() )
+    return false;
+
+  struct stat st{};
+
+  // Only trust own, not expired cache files
+  if ( stat(filename.c_str(), &st) != 0
+    || ! S_ISREG(st.st_mode)
+    || st.st_uid != geteuid()
+    || std::time(nullptr) - st.st_mtime > MAX_AGE
+    || std::time(nullptr) < st.st_mtime )
+    return false;
+
+  std::FILE* fp = std::fopen(filename.c_str(), "r");
+
+  if ( ! fp )
+    return false;
+
+  const std::string key = getKey();
+  const std::string session = getSession();
+  std::string new_answerback{};
+  std::string new_primary_da{};
+  std::string new_sec_da{};
+  int new_max_color{-1};
+  bool key_found{false};
+  bool session_found{false};
+  char line[1024]{};
+
+  while ( std::fgets(line, sizeof(line), fp) )
+  {
+    std::string str(line);
+
+    if ( ! str.empty() && str.back() == '\n' )
+      str.erase(str.length() - 1);
+
+    const std::size_t pos = str.find('=');
+
+    if ( str.empty() || str[0] == '#' || pos == std::string::npos )
+      continue;
+
+    const std::string name(str.substr(0, pos));
+    const std::string value(decode(str.substr(pos + 1)));
+
+    if ( name == "key" )
+      key_found = ( value == key );
+    else if ( name == "session" )
+      session_found = ( value == session );
+    else if ( name == "answerback" )
+      new_answerback = value;
+    else if ( name == "primary_da" )
+      new_primary_da = value;
+    else if ( name == "sec_da" )
+      new_sec_da = value;
+    else if ( name == "max_color" )
+      new_max_color = std::atoi(value.c_str());
+  }
+
+  std::fclose(fp);
+
+  if ( ! key_found )  // Different terminal with the same hash value
+    return false;
+
+  // A new terminal on the same device or a changed terminal size
+  // invalidates the entry. The terminal is queried again and
+  // save() overwrites this file.
+  if ( ! session_found || new_primary_da.empty() )
+    return false;
+
+  answerback = new_answerback;
+  primary_da = new_primary_da;
+  sec_da = new_sec_da;
+  max_color = new_max_color;
+  loaded = true;
+  return true;
+}
+
+//----------------------------------------------------------------------
+bool FTermCache::save()
+{
+  // Writes the terminal replies into the cache file
+
+  // Without an answer to the primary device attributes request,
+  // the replies are incomplete (e.g. timeout or no terminal)
+  if ( primary_da.empty() )
+    return false;
+
+  const std::string directory = getDirectory();
+
+  if ( directory.empty() || ! makeDirectory(directory) )
+    return false;
+
+  const std::string filename(getFileName().c_str());
+  const std::string tmp_filename = filename + "."
+                                 + std::to_string(getpid());
+  std::FILE* fp = std::fopen(tmp_filename.c_str(), "w");
+
+  if ( ! fp )
+    return false;
+
+  std::fprintf ( fp, "# The Final Cut terminal cache\n"
+                     "key=%s\n"
+                     "session=%s\n"
+                     "answerback=%s\n"
+                     "primary_da=%s\n"
+                     "sec_da=%s\n"
+                     "max_color=%d\n"
+               , encode(getKey()).c_str()
+               , encode(getSession()).c_str()
+               , encode(answerback).c_str()
+               , encode(primary_da).c_str()
+               , encode(sec_da).c_str()
+               , max_color );
+
+  const bool write_error = std::ferror(fp) != 0;
+
+  // Replaces the old file in one step
+  if ( std::fclose(fp) != 0 || write_error
+    || std::rename(tmp_filename.c_str(), filename.c_str()) != 0 )
+  {
+    std::remove (tmp_filename.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTermCache::clear()
+{
+  answerback.clear();
+  primary_da.clear();
+  sec_da.clear();
+  max_color = -1;
+  loaded = false;
+}
+
+
+// private methods of FTermCache
+//----------------------------------------------------------------------
+const std::string FTermCache::getKey()
+{
+  // The environment variables that identify the terminal emulator
+  // and the terminal device. All values are known without a query.
+
+  static const char* const variables[] =
+  {
+    "TERM",
+    "TERM_PROGRAM",
+    "TERM_PROGRAM_VERSION",
+    "VTE_VERSION",
+    "XTERM_VERSION",
+    "COLORTERM",
+    "KONSOLE_VERSION",
+    "MLTERM"
+  };
+
+  std::string key{};
+
+  for (auto&& name : variables)
+  {
+    const char* value = std::getenv(name);
+
+    if ( ! key.empty() )
+      key.push_back(';');
+
+    key.append(name);
+    key.push_back('=');
+
+    if ( value )
+      key.append(value);
+  }
+
+  const char* tty = ttyname(STDOUT_FILENO);
+  key.append(";tty=");
+
+  if ( tty )
+    key.append(tty);
+
+  return key;
+}
+
+//----------------------------------------------------------------------
+const std::string FTermCache::getSession()
+{
+  // The status change time of the terminal device is set when
+  // the pseudo terminal is allocated. It distinguishes a new
+  // terminal that reuses the device name from the old one.
+
+  struct stat st{};
+  struct winsize win_size{};
+
+  if ( fstat(STDOUT_FILENO, &st) != 0
+    || ioctl(STDOUT_FILENO, TIOCGWINSZ, &win_size) != 0 )
+    return std::string{};
+
+  char session[64]{};
+  std::snprintf ( session, sizeof(session), "%lld;%ux%u"
+                , static_cast<long long>(st.st_ctime)
+                , uInt(win_size.ws_col)
+                , uInt(win_size.ws_row) );
+  return std::string(session);
+}
+
+//----------------------------------------------------------------------
+const std::string FTermCache::getDirectory()
+{
+  const char* cache_home = std::getenv("XDG_CACHE_HOME");
+
+  // Relative paths are invalid according to the XDG specification
+  if ( cache_home && cache_home[0] == '/' )
+    return std::string(cache_home) + "/finalcut";
+
+  const char* home = std::getenv("HOME");
+
+  if ( home && home[0] == '/' )
+    return std::string(home) + "/.cache/finalcut";
+
+  return std::string{};
+}
+
+//----------------------------------------------------------------------
+bool FTermCache::makeDirectory (const std::string& directory)
+{
+  // Creates the directory and its missing parent directories
+
+  struct stat st{};
+
+  if ( stat(directory.c_str(), &st) == 0 )
+    return S_ISDIR(st.st_mode);
+
+  const std::size_t pos = directory.rfind('/');
+
+  if ( pos != std::string::npos && pos > 0
+    && ! makeDirectory(directory.substr(0, pos)) )
+    return false;
+
+  return mkdir(directory.c_str(), 0700) == 0 || errno == EEXIST;
+}
+
+//----------------------------------------------------------------------
+const std::string FTermCache::encode (const std::string& str)
+{
+  // Escapes control characters and the backslash as \xHH
+
+  std::string encoded{};
+
+  for (auto&& ch : str)
+  {
+    const uChar c = uChar(ch);
+
+    if ( c < 0x20 || c == 0x7f || c == '\\' )
+    {
+      char hex[5]{};
+      std::snprintf (hex, sizeof(hex), "\\x%02x", c);
+      encoded.append(hex);
+    }
+    else
+      encoded.push_back(ch);
+  }
+
+  return encoded;
+}
+
+//----------------------------------------------------------------------
+const std::string FTermCache::decode (const std::string& str)
+{
+  std::string decoded{};
+  std::size_t i{0};
+
+  while ( i < str.length() )
+  {
+    if ( str[i] == '\\' && i + 3 < str.length() && str[i + 1] == 'x' )
+    {
+      const std::string hex(str.substr(i + 2, 2));
+      decoded.push_back(char(std::strtol(hex.c_str(), nullptr, 16)));
+      i += 4;
+    }
+    else
+    {
+      decoded.push_back(str[i]);
+      i++;
+    }
+  }
+
+  return decoded;
+}
+
+//----------------------------------------------------------------------
+uInt64 FTermCache::hash (const std::string& str)
+{
+  // FNV-1a hash
+
+  uInt64 value{14695981039346656037ull};
+
+  for (auto&& ch : str)
+  {
+    value ^= uInt64(uChar(ch));
+    value *= 1099511628211ull;
+  }
+
+  return value;
+}
+
+}  // namespace finalcut
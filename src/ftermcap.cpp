@@ -21,6 +21,8 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -44,11 +46,13 @@ bool             FTermcap::eat_nl_glitch           {false};
 bool             FTermcap::ansi_default_color      {false};
 bool             FTermcap::osc_support             {false};
 bool             FTermcap::no_utf8_acs_chars       {false};
+bool             FTermcap::true_color              {false};
 int              FTermcap::max_color               {1};
 int              FTermcap::tabstop                 {8};
 int              FTermcap::attr_without_color      {0};
 FTermData*       FTermcap::fterm_data              {nullptr};
 FTermDetection*  FTermcap::term_detection          {nullptr};
+const FTermcap::builtin_entry* FTermcap::builtin_term{nullptr};
 
 
 //----------------------------------------------------------------------
@@ -106,6 +110,15 @@ void FTermcap::termcap()
   {
     fterm_data->setTermType(iter->c_str());
 
+    // Common terminals do not need the termcap/terminfo database
+    builtin_term = getBuiltinEntry(termtype);
+
+    if ( builtin_term )
+    {
+      status = success;
+      break;
+    }
+
     // Open the termcap file + load entry for termtype
     status = tgetent(term_buffer, termtype);
 
@@ -122,6 +135,92 @@ void FTermcap::termcap()
   termcapVariables (buffer);
 }
 
+//----------------------------------------------------------------------
+const FTermcap::builtin_entry* FTermcap::getBuiltinEntry (const char name[])
+{
+  // An explicitly selected database has priority
+  if ( std::getenv("TERMINFO") || std::getenv("TERMCAP") )
+    return nullptr;
+
+  return findBuiltinEntry(name);
+}
+
+//----------------------------------------------------------------------
+const FTermcap::builtin_entry* FTermcap::findBuiltinEntry (const char name[])
+{
+  if ( ! name )
+    return nullptr;
+
+  for (std::size_t i{0}; builtin[i].name; i++)
+    if ( std::strcmp(builtin[i].name, name) == 0 )
+      return &builtin[i];
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------------
+const char* FTermcap::getBuiltinCapability (const char name[])
+{
+  // Returns the capability text behind the name or nullptr
+
+  const builtin_entry* entry = builtin_term;
+
+  while ( entry )
+  {
+    for ( const char* cap = entry->capabilities
+        ; *cap
+        ; cap += std::strlen(cap) + 1 )
+    {
+      // Like tgetstr, only the first two characters are compared
+      if ( cap[0] == name[0] && cap[1] == name[1] )
+        return ( cap[2] == '@' ) ? nullptr : cap + 2;
+    }
+
+    entry = findBuiltinEntry(entry->base);
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------------
+bool FTermcap::getFlag (char name[])
+{
+  if ( ! builtin_term )
+    return tgetflag(name);
+
+  const char* cap = getBuiltinCapability(name);
+  return cap && *cap == '\0';
+}
+
+//----------------------------------------------------------------------
+int FTermcap::getNumber (char name[])
+{
+  if ( ! builtin_term )
+    return tgetnum(name);
+
+  const char* cap = getBuiltinCapability(name);
+
+  if ( ! cap || *cap != '#' )
+    return -1;
+
+  return std::atoi(cap + 1);
+}
+
+//----------------------------------------------------------------------
+char* FTermcap::getString (char name[], char*& buffer)
+{
+  if ( ! builtin_term )
+    return tgetstr(name, &buffer);
+
+  const char* cap = getBuiltinCapability(name);
+
+  if ( ! cap || *cap != '=' )
+    return nullptr;
+
+  // The built-in strings are only read, never changed
+  return const_cast<char*>(cap + 1);
+}
+
 //----------------------------------------------------------------------
 void FTermcap::termcapError (int status)
 {
@@ -167,29 +266,32 @@ void FTermcap::termcapBoleans()
   // Get termcap booleans
 
   // Screen erased with the background color
-  background_color_erase = tgetflag(C_STR("ut"));
+  background_color_erase = getFlag(C_STR("ut"));
 
   // Terminal is able to redefine existing colors
-  can_change_color_palette = tgetflag(C_STR("cc"));
+  can_change_color_palette = getFlag(C_STR("cc"));
 
   // t_cursor_left wraps from column 0 to last column
-  automatic_left_margin = tgetflag(C_STR("bw"));
+  automatic_left_margin = getFlag(C_STR("bw"));
 
   // Terminal has auto-matic margins
-  automatic_right_margin = tgetflag(C_STR("am"));
+  automatic_right_margin = getFlag(C_STR("am"));
 
   // NewLine ignored after 80 cols
-  eat_nl_glitch = tgetflag(C_STR("xn"));
+  eat_nl_glitch = getFlag(C_STR("xn"));
 
   // Terminal supports ANSI set default fg and bg color
-  ansi_default_color = tgetflag(C_STR("AX"));
+  ansi_default_color = getFlag(C_STR("AX"));
 
   // Terminal supports operating system commands (OSC)
   // OSC = Esc + ']'
-  osc_support = tgetflag(C_STR("XT"));
+  osc_support = getFlag(C_STR("XT"));
 
   // U8 is nonzero for terminals with no VT100 line-drawing in UTF-8 mode
-  no_utf8_acs_chars = bool(tgetnum(C_STR("U8")) != 0);
+  no_utf8_acs_chars = bool(getNumber(C_STR("U8")) != 0);
+
+  // Terminal supports 24-bit direct colors (tmux extension)
+  true_color = getFlag(C_STR("Tc"));
 }
 
 //----------------------------------------------------------------------
@@ -198,7 +300,7 @@ void FTermcap::termcapNumerics()
   // Get termcap numeric
 
   // Maximum number of colors on screen
-  max_color = std::max(max_color, tgetnum(C_STR("Co")));
+  max_color = std::max(max_color, getNumber(C_STR("Co")));
 
   if ( max_color < 0 )
     max_color = 1;
@@ -209,10 +311,10 @@ void FTermcap::termcapNumerics()
     fterm_data->setMonochron(false);
 
   // Get initial spacing for hardware tab stop
-  tabstop = tgetnum(C_STR("it"));
+  tabstop = getNumber(C_STR("it"));
 
   // Get video attributes that cannot be used with colors
-  attr_without_color = tgetnum(C_STR("NC"));
+  attr_without_color = getNumber(C_STR("NC"));
 }
 
 //----------------------------------------------------------------------
@@ -222,7 +324,7 @@ void FTermcap::termcapStrings (char*& buffer)
 
   // Read termcap output strings
   for (std::size_t i{0}; strings[i].tname[0] != 0; i++)
-    strings[i].string = tgetstr(strings[i].tname, &buffer);
+    strings[i].string = getString(strings[i].tname, buffer);
 }
 
 //----------------------------------------------------------------------
@@ -232,7 +334,7 @@ void FTermcap::termcapKeys (char*& buffer)
 
   for (std::size_t i{0}; fc::fkey[i].tname[0] != 0; i++)
   {
-    fc::fkey[i].string = tgetstr(fc::fkey[i].tname, &buffer);
+    fc::fkey[i].string = getString(fc::fkey[i].tname, buffer);
 
     // Fallback for rxvt with TERM=xterm
     if ( std::strncmp(fc::fkey[i].tname, "khx", 3) == 0 )
@@ -284,7 +386,7 @@ void FTermcap::termcapKeysVt100 (char*& buffer)
   // Some terminals (e.g. PuTTY) send vt100 key codes for
   // the arrow and function keys.
 
-  const char* key_up_string = tgetstr(C_STR("ku"), &buffer);
+  const char* key_up_string = getString(C_STR("ku"), buffer);
 
   if ( (key_up_string && (std::strcmp(key_up_string, ESC "OA") == 0))
     || ( TCAP(fc::t_cursor_up)
@@ -374,6 +476,12 @@ FTermcap::tcap_map FTermcap::strings[] =
   { 0, "Ss" },  // set cursor style       -> Select the DECSCUSR cursor style
   { 0, "sf" },  // scroll_forward         -> scroll text up (P)
   { 0, "sr" },  // scroll_reverse         -> scroll text down (P)
+  { 0, "cs" },  // change_scroll_region   -> change region to line #1 to line #2 (P)
+  { 0, "SF" },  // parm_index             -> scroll forward #1 lines (P)
+  { 0, "SR" },  // parm_rindex            -> scroll back #1 lines (P)
+  { 0, "ML" },  // set_lr_margin          -> set both left and right margins
+                //                           to #1, #2
+  { 0, "MC" },  // clear_margins          -> clear right and left soft margins
   { 0, "ti" },  // enter_ca_mode          -> string to start programs using cup
   { 0, "te" },  // exit_ca_mode           -> strings to end programs using cup
   { 0, "eA" },  // enable_acs             -> enable alternate char set
@@ -427,4 +535,768 @@ FTermcap::tcap_map FTermcap::strings[] =
  * "XX", "Us" and "Ue" are unofficial and they are only used here.
  */
 
+
+// private Data Member of FTermcap - built-in terminal capabilities
+//----------------------------------------------------------------------
+
+/* Every entry is a zero-separated list of termcap capabilities
+ * with the values returned by tgetflag, tgetnum and tgetstr:
+ *
+ *   "xx"      boolean capability
+ *   "xx#123"  numeric capability
+ *   "xx=..."  string capability
+ *   "xx@"     capability of the base entry is absent
+ *
+ * Missing capabilities are looked up in the base entry.
+ */
+
+// Generated by scripts/termcap_table.py
+constexpr char xterm_caps[] =
+  "ut\0"
+  "am\0"
+  "xn\0"
+  "AX\0"
+  "XT\0"
+  "Co#8\0"
+  "it#8\0"
+  "bl=\007\0"
+  "ec=\033[%p1%dX\0"
+  "cl=\033[H\033[2J\0"
+  "cd=\033[J\0"
+  "ce=\033[K\0"
+  "cb=\033[1K\0"
+  "ho=\033[H\0"
+  "cr=\015\0"
+  "ta=\011\0"
+  "bt=\033[Z\0"
+  "IC=\033[%p1%d@\0"
+  "rp=%p1%c\033[%p2%{1}%-%db\0"
+  "AF=\033[3%p1%dm\0"
+  "AB=\033[4%p1%dm\0"
+  "Sf=\033[3%\077%p1%{1}%=%t4%e%p1%{3}%=%t6%e%p1%{4}%=%t1%e%p1%{6}%=%t3%e%p1%d%;m\0"
+  "Sb=\033[4%\077%p1%{1}%=%t4%e%p1%{3}%=%t6%e%p1%{4}%=%t1%e%p1%{6}%=%t3%e%p1%d%;m\0"
+  "op=\033[39;49m\0"
+  "cm=\033[%i%p1%d;%p2%dH\0"
+  "ch=\033[%i%p1%dG\0"
+  "cv=\033[%i%p1%dd\0"
+  "vs=\033[\07712;25h\0"
+  "vi=\033[\07725l\0"
+  "ve=\033[\07712l\033[\07725h\0"
+  "up=\033[A\0"
+  "do=\012\0"
+  "le=\010\0"
+  "nd=\033[C\0"
+  "UP=\033[%p1%dA\0"
+  "DO=\033[%p1%dB\0"
+  "LE=\033[%p1%dD\0"
+  "RI=\033[%p1%dC\0"
+  "sc=\0337\0"
+  "rc=\0338\0"
+  "Ss=\033[%p1%d q\0"
+  "sf=\012\0"
+  "sr=\033M\0"
+  "cs=\033[%i%p1%d;%p2%dr\0"
+  "SF=\033[%p1%dS\0"
+  "SR=\033[%p1%dT\0"
+  "ML=\033[\07769h\033[%i%p1%d;%p2%ds\0"
+  "MC=\033[\07769l\0"
+  "ti=\033[\0771049h\033[22;0;0t\0"
+  "te=\033[\0771049l\033[23;0;0t\0"
+  "md=\033[1m\0"
+  "me=\033[0m\0"
+  "mh=\033[2m\0"
+  "ZH=\033[3m\0"
+  "ZR=\033[23m\0"
+  "us=\033[4m\0"
+  "ue=\033[24m\0"
+  "mb=\033[5m\0"
+  "mr=\033[7m\0"
+  "so=\033[7m\0"
+  "se=\033[27m\0"
+  "mk=\033[8m\0"
+  "sa=%\077%p9%t\033(0%e\033(B%;\033[0%\077%p6%t;1%;%\077%p5%t;2%;%\077%p2%t;4%;%\077%p1%p3%|%t;7%;%\077%p4%t;5%;%\077%p7%t;8%;m\0"
+  "as=\033(0\0"
+  "ae=\033(B\0"
+  "im=\033[4h\0"
+  "ei=\033[4l\0"
+  "SA=\033[\0777h\0"
+  "RA=\033[\0777l\0"
+  "ac=``aaffggiijjkkllmmnnooppqqrrssttuuvvwwxxyyzz{{||}}~~\0"
+  "ks=\033[\0771h\033=\0"
+  "ke=\033[\0771l\033>\0"
+  "Km=\033[<\0"
+  "kb=\177\0"
+  "kD=\033[3~\0"
+  "kd=\033OB\0"
+  "k1=\033OP\0"
+  "k2=\033OQ\0"
+  "k3=\033OR\0"
+  "k4=\033OS\0"
+  "k5=\033[15~\0"
+  "k6=\033[17~\0"
+  "k7=\033[18~\0"
+  "k8=\033[19~\0"
+  "k9=\033[20~\0"
+  "k;=\033[21~\0"
+  "kh=\033OH\0"
+  "kI=\033[2~\0"
+  "kl=\033OD\0"
+  "kN=\033[6~\0"
+  "kP=\033[5~\0"
+  "kr=\033OC\0"
+  "kF=\033[1;2B\0"
+  "kR=\033[1;2A\0"
+  "ku=\033OA\0"
+  "K1=\033Ow\0"
+  "K3=\033Oy\0"
+  "K2=\033Ou\0"
+  "K4=\033Oq\0"
+  "K5=\033Os\0"
+  "kB=\033[Z\0"
+  "@1=\033OE\0"
+  "@7=\033OF\0"
+  "@8=\033OM\0"
+  "*4=\033[3;2~\0"
+  "*7=\033[1;2F\0"
+  "#2=\033[1;2H\0"
+  "#3=\033[2;2~\0"
+  "#4=\033[1;2D\0"
+  "%c=\033[6;2~\0"
+  "%e=\033[5;2~\0"
+  "%i=\033[1;2C\0"
+  "F1=\033[23~\0"
+  "F2=\033[24~\0"
+  "F3=\033[1;2P\0"
+  "F4=\033[1;2Q\0"
+  "F5=\033[1;2R\0"
+  "F6=\033[1;2S\0"
+  "F7=\033[15;2~\0"
+  "F8=\033[17;2~\0"
+  "F9=\033[18;2~\0"
+  "FA=\033[19;2~\0"
+  "FB=\033[20;2~\0"
+  "FC=\033[21;2~\0"
+  "FD=\033[23;2~\0"
+  "FE=\033[24;2~\0"
+  "FF=\033[1;5P\0"
+  "FG=\033[1;5Q\0"
+  "FH=\033[1;5R\0"
+  "FI=\033[1;5S\0"
+  "FJ=\033[15;5~\0"
+  "FK=\033[17;5~\0"
+  "FL=\033[18;5~\0"
+  "FM=\033[19;5~\0"
+  "FN=\033[20;5~\0"
+  "FO=\033[21;5~\0"
+  "FP=\033[23;5~\0"
+  "FQ=\033[24;5~\0"
+  "FR=\033[1;6P\0"
+  "FS=\033[1;6Q\0"
+  "FT=\033[1;6R\0"
+  "FU=\033[1;6S\0"
+  "FV=\033[15;6~\0"
+  "FW=\033[17;6~\0"
+  "FX=\033[18;6~\0"
+  "FY=\033[19;6~\0"
+  "FZ=\033[20;6~\0"
+  "Fa=\033[21;6~\0"
+  "Fb=\033[23;6~\0"
+  "Fc=\033[24;6~\0"
+  "Fd=\033[1;3P\0"
+  "Fe=\033[1;3Q\0"
+  "Ff=\033[1;3R\0"
+  "Fg=\033[1;3S\0"
+  "Fh=\033[15;3~\0"
+  "Fi=\033[17;3~\0"
+  "Fj=\033[18;3~\0"
+  "Fk=\033[19;3~\0"
+  "Fl=\033[20;3~\0"
+  "Fm=\033[21;3~\0"
+  "Fn=\033[23;3~\0"
+  "Fo=\033[24;3~\0"
+  "Fp=\033[1;4P\0"
+  "Fq=\033[1;4Q\0"
+  "Fr=\033[1;4R\0"
+;
+
+constexpr char xterm_16color_caps[] =  // Based on xterm
+  "cc\0"
+  "Co#16\0"
+  "Ic=\033]4;%p1%d;rgb:%p2%{255}%*%{1000}%/%2.2X/%p3%{255}%*%{1000}%/%2.2X/%p4%{255}%*%{1000}%/%2.2X\033\134\0"
+  "AF=\033[%\077%p1%{8}%<%t%p1%{30}%+%e%p1%'R'%+%;%dm\0"
+  "AB=\033[%\077%p1%{8}%<%t%p1%'('%+%e%p1%{92}%+%;%dm\0"
+  "Sf=%p1%{8}%/%{6}%*%{3}%+\033[%d%p1%{8}%m%Pa%\077%ga%{1}%=%t4%e%ga%{3}%=%t6%e%ga%{4}%=%t1%e%ga%{6}%=%t3%e%ga%d%;m\0"
+  "Sb=%p1%{8}%/%{6}%*%{4}%+\033[%d%p1%{8}%m%Pa%\077%ga%{1}%=%t4%e%ga%{3}%=%t6%e%ga%{4}%=%t1%e%ga%{6}%=%t3%e%ga%d%;m\0"
+  "oc=\033]104\007\0"
+;
+
+constexpr char xterm_88color_caps[] =  // Based on xterm-16color
+  "Co#88\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+  "Sf@\0"
+  "Sb@\0"
+;
+
+constexpr char xterm_256color_caps[] =  // Based on xterm-88color
+  "Co#256\0"
+;
+
+constexpr char gnome_caps[] =  // Based on xterm
+  "NC#16\0"
+  "ve=\033[\07725h\0"
+  "ti=\0337\033[\07747h\0"
+  "te=\033[2J\033[\07747l\0338\0"
+  "eA=\033)0\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p2%t;4%;%\077%p5%t;2%;%\077%p7%t;8%;%\077%p1%p3%|%t;7%;m%\077%p9%t\016%e\017%;\0"
+  "as=\016\0"
+  "ae=\017\0"
+  "Km=\033[M\0"
+  "K2=\033[E\0"
+  "@0=\033[1~\0"
+  "*6=\033[4~\0"
+  "F3=\033O1;2P\0"
+  "F4=\033O1;2Q\0"
+  "F5=\033O1;2R\0"
+  "F6=\033O1;2S\0"
+  "FF=\033O1;5P\0"
+  "FG=\033O1;5Q\0"
+  "FH=\033O1;5R\0"
+  "FI=\033O1;5S\0"
+  "FR=\033O1;6P\0"
+  "FS=\033O1;6Q\0"
+  "FT=\033O1;6R\0"
+  "FU=\033O1;6S\0"
+  "Fd=\033O1;3P\0"
+  "Fe=\033O1;3Q\0"
+  "Ff=\033O1;3R\0"
+  "Fg=\033O1;3S\0"
+  "Fp=\033O1;4P\0"
+  "Fq=\033O1;4Q\0"
+  "Fr=\033O1;4R\0"
+  "AX@\0"
+  "cb@\0"
+  "bt@\0"
+  "IC@\0"
+  "rp@\0"
+  "Sf@\0"
+  "Sb@\0"
+  "vs@\0"
+  "Ss@\0"
+  "SF@\0"
+  "SR@\0"
+  "ML@\0"
+  "MC@\0"
+  "mb@\0"
+  "K1@\0"
+  "K3@\0"
+  "K4@\0"
+  "K5@\0"
+  "@1@\0"
+  "@8@\0"
+;
+
+constexpr char gnome_256color_caps[] =  // Based on gnome
+  "cc\0"
+  "Co#256\0"
+  "Ic=\033]4;%p1%d;rgb:%p2%{255}%*%{1000}%/%2.2X/%p3%{255}%*%{1000}%/%2.2X/%p4%{255}%*%{1000}%/%2.2X\033\134\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+  "oc=\033]104\007\0"
+;
+
+constexpr char vte_caps[] =  // Based on xterm
+  "ve=\033[\07725h\0"
+  "eA=\033(B\033)0\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p2%t;4%;%\077%p4%t;5%;%\077%p5%t;2%;%\077%p7%t;8%;%\077%p1%p3%|%t;7%;m%\077%p9%t\016%e\017%;\0"
+  "as=\016\0"
+  "ae=\017\0"
+  "K2=\033[E\0"
+  "@0=\033[1~\0"
+  "*6=\033[4~\0"
+  "Sf@\0"
+  "Sb@\0"
+  "vs@\0"
+  "ML@\0"
+  "MC@\0"
+  "K1@\0"
+  "K3@\0"
+  "K4@\0"
+  "K5@\0"
+  "@1@\0"
+;
+
+constexpr char vte_256color_caps[] =  // Based on vte
+  "cc\0"
+  "Co#256\0"
+  "Ic=\033]4;%p1%d;rgb:%p2%{255}%*%{1000}%/%2.2X/%p3%{255}%*%{1000}%/%2.2X/%p4%{255}%*%{1000}%/%2.2X\033\134\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+  "oc=\033]104\007\0"
+;
+
+constexpr char konsole_caps[] =  // Based on gnome
+  "AX\0"
+  "SF=\033[%p1%dS\0"
+  "SR=\033[%p1%dT\0"
+  "mb=\033[5m\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p2%t;4%;%\077%p1%p3%|%t;7%;%\077%p4%t;5%;%\077%p5%t;2%;%\077%p7%t;8%;m%\077%p9%t\016%e\017%;\0"
+  "Km=\033[<\0"
+  "F3=\033O2P\0"
+  "F4=\033O2Q\0"
+  "F5=\033O2R\0"
+  "F6=\033O2S\0"
+  "FF=\033O5P\0"
+  "FG=\033O5Q\0"
+  "FH=\033O5R\0"
+  "FI=\033O5S\0"
+  "FR=\033O6P\0"
+  "FS=\033O6Q\0"
+  "FT=\033O6R\0"
+  "FU=\033O6S\0"
+  "Fd=\033O3P\0"
+  "Fe=\033O3Q\0"
+  "Ff=\033O3R\0"
+  "Fg=\033O3S\0"
+  "Fp=\033O4P\0"
+  "Fq=\033O4Q\0"
+  "Fr=\033O4R\0"
+  "NC@\0"
+  "K2@\0"
+  "@0@\0"
+  "*6@\0"
+;
+
+constexpr char konsole_256color_caps[] =  // Based on konsole
+  "Co#256\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+;
+
+constexpr char putty_caps[] =  // Based on vte
+  "cc\0"
+  "bw\0"
+  "NC#22\0"
+  "U8#1\0"
+  "cl=\033[H\033[J\0"
+  "Ic=\033]P%p1%x%p2%{255}%*%{1000}%/%02x%p3%{255}%*%{1000}%/%02x%p4%{255}%*%{1000}%/%02x\0"
+  "oc=\033]R\0"
+  "up=\033M\0"
+  "do=\033D\0"
+  "ti=\033[\0771049h\0"
+  "te=\033[\0771049l\0"
+  "sa=\033[0%\077%p1%p6%|%t;1%;%\077%p2%t;4%;%\077%p1%p3%|%t;7%;%\077%p4%t;5%;m%\077%p9%t\016%e\017%;\0"
+  "S2=\033[11m\0"
+  "S3=\033[10m\0"
+  "ac=``aaffggjjkkllmmnnooppqqrrssttuuvvwwxxyyzz{{||}}~~\0"
+  "k0=\033Oy\0"
+  "k1=\033[11~\0"
+  "k2=\033[12~\0"
+  "k3=\033[13~\0"
+  "k4=\033[14~\0"
+  "kh=\033[1~\0"
+  "kF=\033[B\0"
+  "kR=\033[A\0"
+  "K1=\033Oq\0"
+  "K3=\033Os\0"
+  "K2=\033Or\0"
+  "K4=\033Op\0"
+  "K5=\033On\0"
+  "@7=\033[4~\0"
+  "&7=\032\0"
+  "F3=\033[25~\0"
+  "F4=\033[26~\0"
+  "F5=\033[28~\0"
+  "F6=\033[29~\0"
+  "F7=\033[31~\0"
+  "F8=\033[32~\0"
+  "F9=\033[33~\0"
+  "FA=\033[34~\0"
+  "AX@\0"
+  "IC@\0"
+  "Ss@\0"
+  "mh@\0"
+  "ZH@\0"
+  "ZR@\0"
+  "mk@\0"
+  "@0@\0"
+  "*4@\0"
+  "*6@\0"
+  "*7@\0"
+  "#2@\0"
+  "#3@\0"
+  "#4@\0"
+  "%c@\0"
+  "%e@\0"
+  "%i@\0"
+  "FB@\0"
+  "FC@\0"
+  "FD@\0"
+  "FE@\0"
+  "FF@\0"
+  "FG@\0"
+  "FH@\0"
+  "FI@\0"
+  "FJ@\0"
+  "FK@\0"
+  "FL@\0"
+  "FM@\0"
+  "FN@\0"
+  "FO@\0"
+  "FP@\0"
+  "FQ@\0"
+  "FR@\0"
+  "FS@\0"
+  "FT@\0"
+  "FU@\0"
+  "FV@\0"
+  "FW@\0"
+  "FX@\0"
+  "FY@\0"
+  "FZ@\0"
+  "Fa@\0"
+  "Fb@\0"
+  "Fc@\0"
+  "Fd@\0"
+  "Fe@\0"
+  "Ff@\0"
+  "Fg@\0"
+  "Fh@\0"
+  "Fi@\0"
+  "Fj@\0"
+  "Fk@\0"
+  "Fl@\0"
+  "Fm@\0"
+  "Fn@\0"
+  "Fo@\0"
+  "Fp@\0"
+  "Fq@\0"
+  "Fr@\0"
+;
+
+constexpr char putty_256color_caps[] =  // Based on putty
+  "Co#256\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+  "cc@\0"
+  "Ic@\0"
+;
+
+constexpr char rxvt_caps[] =  // Based on putty
+  "AX\0"
+  "cl=\033[H\033[2J\0"
+  "IC=\033[%p1%d@\0"
+  "up=\033[A\0"
+  "do=\012\0"
+  "ti=\0337\033[\07747h\0"
+  "te=\033[2J\033[\07747l\0338\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p2%t;4%;%\077%p1%p3%|%t;7%;%\077%p4%t;5%;m%\077%p9%t\016%e\017%;\0"
+  "ks=\033=\0"
+  "ke=\033>\0"
+  "Km=\033[M\0"
+  "kb=\010\0"
+  "kd=\033[B\0"
+  "kE=\033[8^\0"
+  "k0=\033[21~\0"
+  "kh=\033[7~\0"
+  "kl=\033[D\0"
+  "kr=\033[C\0"
+  "kF=\033[a\0"
+  "kR=\033[b\0"
+  "ku=\033[A\0"
+  "K1=\033Ow\0"
+  "K3=\033Oy\0"
+  "K2=\033Ou\0"
+  "K4=\033Oq\0"
+  "K5=\033Os\0"
+  "@7=\033[8~\0"
+  "@0=\033[1~\0"
+  "*4=\033[3$\0"
+  "*6=\033[4~\0"
+  "*7=\033[8$\0"
+  "#2=\033[7$\0"
+  "#3=\033[2$\0"
+  "#4=\033[d\0"
+  "%c=\033[6$\0"
+  "%e=\033[5$\0"
+  "%i=\033[c\0"
+  "FB=\033[23$\0"
+  "FC=\033[24$\0"
+  "FD=\033[11^\0"
+  "FE=\033[12^\0"
+  "FF=\033[13^\0"
+  "FG=\033[14^\0"
+  "FH=\033[15^\0"
+  "FI=\033[17^\0"
+  "FJ=\033[18^\0"
+  "FK=\033[19^\0"
+  "FL=\033[20^\0"
+  "FM=\033[21^\0"
+  "FN=\033[23^\0"
+  "FO=\033[24^\0"
+  "FP=\033[25^\0"
+  "FQ=\033[26^\0"
+  "FR=\033[28^\0"
+  "FS=\033[29^\0"
+  "FT=\033[31^\0"
+  "FU=\033[32^\0"
+  "FV=\033[33^\0"
+  "FW=\033[34^\0"
+  "FX=\033[23@\0"
+  "FY=\033[24@\0"
+  "cc@\0"
+  "bw@\0"
+  "NC@\0"
+  "U8@\0"
+  "ec@\0"
+  "bt@\0"
+  "rp@\0"
+  "Ic@\0"
+  "oc@\0"
+  "SF@\0"
+  "SR@\0"
+  "S2@\0"
+  "S3@\0"
+  "SA@\0"
+  "RA@\0"
+  "&7@\0"
+;
+
+constexpr char rxvt_16color_caps[] =  // Based on rxvt
+  "Co#16\0"
+  "NC#32\0"
+  "AF=\033[%\077%p1%{8}%<%t%p1%{30}%+%e%p1%'R'%+%;%dm\0"
+  "AB=\033[%\077%p1%{8}%<%t%p1%'('%+%e%p1%{92}%+%;%dm\0"
+  "Sf=%p1%{8}%/%{6}%*%{3}%+\033[%d%p1%{8}%m%Pa%\077%ga%{1}%=%t4%e%ga%{3}%=%t6%e%ga%{4}%=%t1%e%ga%{6}%=%t3%e%ga%d%;m\0"
+  "Sb=%p1%{8}%/%{6}%*%{4}%+\033[%d%p1%{8}%m%Pa%\077%ga%{1}%=%t4%e%ga%{3}%=%t6%e%ga%{4}%=%t1%e%ga%{6}%=%t3%e%ga%d%;m\0"
+;
+
+constexpr char rxvt_256color_caps[] =  // Based on rxvt
+  "cc\0"
+  "Co#256\0"
+  "Ic=\033]4;%p1%d;rgb:%p2%{255}%*%{1000}%/%2.2X/%p3%{255}%*%{1000}%/%2.2X/%p4%{255}%*%{1000}%/%2.2X\033\134\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+  "oc=\033]104\007\0"
+;
+
+constexpr char screen_caps[] =  // Based on putty
+  "AX\0"
+  "IC=\033[%p1%d@\0"
+  "vs=\033[34l\0"
+  "ve=\033[34h\033[\07725h\0"
+  "do=\012\0"
+  "mh=\033[2m\0"
+  "so=\033[3m\0"
+  "se=\033[23m\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p1%t;3%;%\077%p2%t;4%;%\077%p3%t;7%;%\077%p4%t;5%;%\077%p5%t;2%;m%\077%p9%t\016%e\017%;\0"
+  "ac=++,,--..00``aaffgghhiijjkkllmmnnooppqqrrssttuuvvwwxxyyzz{{||}}~~\0"
+  "Km=\033[M\0"
+  "k1=\033OP\0"
+  "k2=\033OQ\0"
+  "k3=\033OR\0"
+  "k4=\033OS\0"
+  "ut@\0"
+  "cc@\0"
+  "bw@\0"
+  "XT@\0"
+  "NC@\0"
+  "ec@\0"
+  "rp@\0"
+  "Ic@\0"
+  "oc@\0"
+  "S2@\0"
+  "S3@\0"
+  "SA@\0"
+  "RA@\0"
+  "k0@\0"
+  "kF@\0"
+  "kR@\0"
+  "K1@\0"
+  "K3@\0"
+  "K2@\0"
+  "K4@\0"
+  "K5@\0"
+  "@8@\0"
+  "&7@\0"
+  "F3@\0"
+  "F4@\0"
+  "F5@\0"
+  "F6@\0"
+  "F7@\0"
+  "F8@\0"
+  "F9@\0"
+  "FA@\0"
+;
+
+constexpr char screen_256color_caps[] =  // Based on screen
+  "Co#256\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+;
+
+constexpr char tmux_caps[] =  // Based on vte
+  "U8#1\0"
+  "cl=\033[H\033[J\0"
+  "vs=\033[34l\0"
+  "ve=\033[34h\033[\07725h\0"
+  "up=\033M\0"
+  "ti=\033[\0771049h\0"
+  "te=\033[\0771049l\0"
+  "sa=\033[0%\077%p6%t;1%;%\077%p2%t;4%;%\077%p1%p3%|%t;7%;%\077%p4%t;5%;%\077%p5%t;2%;%\077%p7%t;8%;m%\077%p9%t\016%e\017%;\0"
+  "ac=++,,--..00``aaffgghhiijjkkllmmnnooppqqrrssttuuvvwwxxyyzz{{||}}~~\0"
+  "Km=\033[M\0"
+  "kh=\033[1~\0"
+  "@7=\033[4~\0"
+  "ut@\0"
+  "XT@\0"
+  "ec@\0"
+  "rp@\0"
+  "SA@\0"
+  "RA@\0"
+  "K2@\0"
+  "@8@\0"
+  "@0@\0"
+  "*6@\0"
+;
+
+constexpr char tmux_256color_caps[] =  // Based on tmux
+  "Co#256\0"
+  "AF=\033[%\077%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0"
+  "AB=\033[%\077%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0"
+;
+
+constexpr char linux_caps[] =  // Based on putty
+  "AX\0"
+  "NC#18\0"
+  "ic=\033[@\0"
+  "IC=\033[%p1%d@\0"
+  "vs=\033[\07725h\033[\0778c\0"
+  "vi=\033[\07725l\033[\0771c\0"
+  "ve=\033[\07725h\033[\0770c\0"
+  "up=\033[A\0"
+  "do=\012\0"
+  "eA=\033)0\0"
+  "me=\033[m\017\0"
+  "mh=\033[2m\0"
+  "sa=\033[0;10%\077%p1%t;7%;%\077%p2%t;4%;%\077%p3%t;7%;%\077%p4%t;5%;%\077%p5%t;2%;%\077%p6%t;1%;m%\077%p9%t\016%e\017%;\0"
+  "ac=++,,--..00``aaffgghhiijjkkllmmnnooppqqrrssttuuvvwwxxyyzz{{||}}~~\0"
+  "Km=\033[M\0"
+  "kd=\033[B\0"
+  "k1=\033[[A\0"
+  "k2=\033[[B\0"
+  "k3=\033[[C\0"
+  "k4=\033[[D\0"
+  "k5=\033[[E\0"
+  "kl=\033[D\0"
+  "kr=\033[C\0"
+  "ku=\033[A\0"
+  "K2=\033[G\0"
+  "kB=\033\011\0"
+  "bw@\0"
+  "XT@\0"
+  "bt@\0"
+  "rp@\0"
+  "SF@\0"
+  "SR@\0"
+  "ti@\0"
+  "te@\0"
+  "ks@\0"
+  "ke@\0"
+  "k0@\0"
+  "kF@\0"
+  "kR@\0"
+  "K1@\0"
+  "K3@\0"
+  "K4@\0"
+  "K5@\0"
+  "@8@\0"
+;
+
+constexpr char ansi_caps[] =
+  "am\0"
+  "AX\0"
+  "Co#8\0"
+  "it#8\0"
+  "NC#3\0"
+  "bl=\007\0"
+  "ec=\033[%p1%dX\0"
+  "cl=\033[H\033[J\0"
+  "cd=\033[J\0"
+  "ce=\033[K\0"
+  "cb=\033[1K\0"
+  "ho=\033[H\0"
+  "cr=\015\0"
+  "ta=\033[I\0"
+  "bt=\033[Z\0"
+  "IC=\033[%p1%d@\0"
+  "rp=%p1%c\033[%p2%{1}%-%db\0"
+  "AF=\033[3%p1%dm\0"
+  "AB=\033[4%p1%dm\0"
+  "op=\033[39;49m\0"
+  "cm=\033[%i%p1%d;%p2%dH\0"
+  "ch=\033[%i%p1%dG\0"
+  "cv=\033[%i%p1%dd\0"
+  "up=\033[A\0"
+  "do=\033[B\0"
+  "le=\033[D\0"
+  "nd=\033[C\0"
+  "UP=\033[%p1%dA\0"
+  "DO=\033[%p1%dB\0"
+  "LE=\033[%p1%dD\0"
+  "RI=\033[%p1%dC\0"
+  "sf=\012\0"
+  "SF=\033[%p1%dS\0"
+  "SR=\033[%p1%dT\0"
+  "md=\033[1m\0"
+  "me=\033[0m\0"
+  "us=\033[4m\0"
+  "ue=\033[m\0"
+  "mb=\033[5m\0"
+  "mr=\033[7m\0"
+  "so=\033[7m\0"
+  "se=\033[m\0"
+  "mk=\033[8m\0"
+  "sa=\033[0;10%\077%p1%t;7%;%\077%p2%t;4%;%\077%p3%t;7%;%\077%p4%t;5%;%\077%p6%t;1%;%\077%p7%t;8%;%\077%p9%t;11%;m\0"
+  "as=\033[11m\0"
+  "ae=\033[10m\0"
+  "S2=\033[11m\0"
+  "S3=\033[10m\0"
+  "ac=+\020,\021-\030.\0310\333`\004a\261f\370g\361h\260j\331k\277l\332m\300n\305o~p\304q\304r\304s_t\303u\264v\301w\302x\263y\363z\362{\343|\330}\234~\376\0"
+  "kb=\010\0"
+  "kd=\033[B\0"
+  "kh=\033[H\0"
+  "kI=\033[L\0"
+  "kl=\033[D\0"
+  "kr=\033[C\0"
+  "ku=\033[A\0"
+  "kB=\033[Z\0"
+;
+
+const FTermcap::builtin_entry FTermcap::builtin[] =
+{
+  { "xterm", nullptr, xterm_caps },
+  { "xterm-16color", "xterm", xterm_16color_caps },
+  { "xterm-88color", "xterm-16color", xterm_88color_caps },
+  { "xterm-256color", "xterm-88color", xterm_256color_caps },
+  { "gnome", "xterm", gnome_caps },
+  { "gnome-256color", "gnome", gnome_256color_caps },
+  { "vte", "xterm", vte_caps },
+  { "vte-256color", "vte", vte_256color_caps },
+  { "konsole", "gnome", konsole_caps },
+  { "konsole-256color", "konsole", konsole_256color_caps },
+  { "putty", "vte", putty_caps },
+  { "putty-256color", "putty", putty_256color_caps },
+  { "rxvt", "putty", rxvt_caps },
+  { "rxvt-16color", "rxvt", rxvt_16color_caps },
+  { "rxvt-256color", "rxvt", rxvt_256color_caps },
+  { "screen", "putty", screen_caps },
+  { "screen-256color", "screen", screen_256color_caps },
+  { "tmux", "vte", tmux_caps },
+  { "tmux-256color", "tmux", tmux_256color_caps },
+  { "linux", "putty", linux_caps },
+  { "ansi", nullptr, ansi_caps },
+  { nullptr, nullptr, nullptr }
+};
+
 }  // namespace finalcut
@@ -242,6 +242,20 @@ void FTermcapQuirks::xterm()
   if ( ! TCAP(fc::t_cursor_normal) )
     TCAP(fc::t_cursor_normal) = \
         C_STR(CSI "?12l" CSI "?25h");
+
+  // Many xterm-compatible terminals ignore the left
+  // and right margins (DECSLRM) set by "ML"
+  if ( term_detection->isGnomeTerminal()
+    || term_detection->isKdeTerminal()
+    || term_detection->isMinttyTerm()
+    || term_detection->isMltermTerminal()
+    || term_detection->isTeraTerm()
+    || term_detection->isScreenTerm()
+    || term_detection->isTmuxTerm() )
+  {
+    TCAP(fc::t_set_lr_margin) = 0;
+    TCAP(fc::t_clear_margins) = 0;
+  }
 }
 
 //----------------------------------------------------------------------
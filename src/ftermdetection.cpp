@@ -28,9 +28,11 @@
 #include "final/fc.h"
 #include "final/fsystem.h"
 #include "final/fterm.h"
+#include "final/ftermcache.h"
 #include "final/ftermdata.h"
 #include "final/ftermdetection.h"
 #include "final/ftermios.h"
+#include "final/ftermquery.h"
 #include "final/ftypes.h"
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
@@ -54,7 +56,9 @@ char           FTermDetection::termtype[256]{};
 char           FTermDetection::ttytypename[256]{};
 bool           FTermDetection::decscusr_support{};
 bool           FTermDetection::terminal_detection{};
+bool           FTermDetection::terminal_cache{};
 bool           FTermDetection::color256{};
+bool           FTermDetection::true_color{};
 const FString* FTermDetection::answer_back{nullptr};
 const FString* FTermDetection::sec_da{nullptr};
 int            FTermDetection::gnome_terminal_id{};
@@ -135,6 +139,9 @@ void FTermDetection::detect()
   // Analysis the termtype
   termtypeAnalysis();
 
+  // Support for 24-bit colors
+  true_color = getTrueColorEnvString();
+
   // Terminal detection
   detectTerminal();
 }
@@ -344,11 +351,20 @@ void FTermDetection::detectTerminal()
 
   if ( terminal_detection )
   {
+    // Reads the terminal replies of a previous run
+    if ( terminal_cache )
+      FTermCache::load();
+    else
+      FTermCache::clear();
+
     FTermios::setCaptureSendCharacters();
 
     // Initialize 256 colors terminals
     new_termtype = init_256colorTerminal();
 
+    // Requests the answerback-message and the SEC_DA in one batch
+    queryTerminalIdentity();
+
     // Identify the terminal via the answerback-message
     new_termtype = parseAnswerbackMsg (new_termtype);
 
@@ -359,6 +375,10 @@ void FTermDetection::detectTerminal()
     new_termtype = determineMaxColor(new_termtype);
 
     FTermios::unsetCaptureSendCharacters();
+
+    // Stores the terminal replies for the next run
+    if ( terminal_cache && ! FTermCache::isLoaded() )
+      FTermCache::save();
   }
 
   //
@@ -448,6 +468,19 @@ bool FTermDetection::get256colorEnvString()
   return false;
 }
 
+//----------------------------------------------------------------------
+bool FTermDetection::getTrueColorEnvString()
+{
+  // The terminal announces 24-bit colors via COLORTERM
+  const char* const& colorterm = std::getenv("COLORTERM");
+
+  if ( ! colorterm )
+    return false;
+
+  return std::strcmp(colorterm, "truecolor") == 0
+      || std::strcmp(colorterm, "24bit") == 0;
+}
+
 //----------------------------------------------------------------------
 char* FTermDetection::termtype_256color_quirks()
 {
@@ -501,6 +534,26 @@ char* FTermDetection::termtype_256color_quirks()
   return new_termtype;
 }
 
+//----------------------------------------------------------------------
+void FTermDetection::queryTerminalIdentity()
+{
+  if ( FTermCache::isLoaded() )  // Known replies of this terminal
+    return;
+
+  FTermQuery::clear();
+  std::putchar (ENQ[0]);  // Send enquiry character
+
+  // The Linux console and older cygwin terminals knows no Sec_DA
+  if ( ! isLinuxTerm() && ! isCygwinTerminal() )
+    std::fputs (SECDA, stdout);  // Get the secondary device attributes
+
+  FTermQuery::sendSentinel();
+  FTermQuery::readReplies (600000);  // 600 ms
+  FTermCache::setAnswerback (FTermQuery::getAnswerback());
+  FTermCache::setPrimaryDA (FTermQuery::getPrimaryDA());
+  FTermCache::setSecondaryDA (FTermQuery::getSecondaryDA());
+}
+
 //----------------------------------------------------------------------
 char* FTermDetection::determineMaxColor (char current_termtype[])
 {
@@ -512,10 +565,14 @@ char* FTermDetection::determineMaxColor (char current_termtype[])
     && ! isCygwinTerminal()
     && ! isTeraTerm()
     && ! isLinuxTerm()
-    && ! isNetBSDTerm()
-    && ! getXTermColorName(0).isEmpty() )
+    && ! isNetBSDTerm() )
   {
-    if ( ! getXTermColorName(255).isEmpty() )
+    if ( ! FTermCache::isLoaded() )
+      FTermCache::setMaxColor (queryMaxColor());
+
+    const int max_color = FTermCache::getMaxColor();
+
+    if ( max_color == 256 )
     {
       color256 = true;
 
@@ -524,11 +581,11 @@ char* FTermDetection::determineMaxColor (char current_termtype[])
       else
         new_termtype = C_STR("xterm-256color");
     }
-    else if ( ! getXTermColorName(87).isEmpty() )
+    else if ( max_color == 88 )
     {
       new_termtype = C_STR("xterm-88color");
     }
-    else if ( ! getXTermColorName(15).isEmpty() )
+    else if ( max_color == 16 )
     {
       new_termtype = C_STR("xterm-16color");
     }
@@ -538,43 +595,41 @@ char* FTermDetection::determineMaxColor (char current_termtype[])
 }
 
 //----------------------------------------------------------------------
-const FString FTermDetection::getXTermColorName (FColor color)
+int FTermDetection::queryMaxColor()
 {
-  FString color_str{""};
-  fd_set ifds{};
-  struct timeval tv{};
-  int stdin_no = FTermios::getStdIn();
+  // Requests all test colors in one batch
 
-  // get color
-  std::fprintf (stdout, OSC "4;%hu;?" BEL, color);
-  std::fflush (stdout);
+  FTermQuery::clear();
 
-  char temp[512]{};
-  FD_ZERO(&ifds);
-  FD_SET(stdin_no, &ifds);
-  tv.tv_sec  = 0;
-  tv.tv_usec = 150000;  // 150 ms
+  for (const FColor color : { 0, 255, 87, 15 })
+    std::fprintf (stdout, OSC "4;%hu;?" BEL, color);
 
-  // read the terminal answer
-  if ( select (stdin_no + 1, &ifds, 0, 0, &tv) > 0 )
-  {
-    if ( std::scanf("\033]4;%10hu;%509[^\n]s", &color, temp) == 2 )
-    {
-      std::size_t n = std::strlen(temp);
+  FTermQuery::sendSentinel();
+  FTermQuery::readReplies (150000);  // 150 ms
 
-      // BEL + '\0' = string terminator
-      if ( n >= 6 && temp[n - 1] == BEL[0] && temp[n] == '\0' )
-        temp[n - 1] = '\0';
+  if ( getXTermColorName(0).isEmpty() )
+    return 0;  // No color query support
 
-      // Esc + \ = OSC string terminator (mintty)
-      if ( n >= 6 && temp[n - 2] == ESC[0] && temp[n - 1] == '\\' )
-        temp[n - 2] = '\0';
+  if ( ! getXTermColorName(255).isEmpty() )
+    return 256;
 
-      color_str = temp;
-    }
-  }
+  if ( ! getXTermColorName(87).isEmpty() )
+    return 88;
+
+  if ( ! getXTermColorName(15).isEmpty() )
+    return 16;
+
+  return 8;
+}
 
-  return color_str;
+//----------------------------------------------------------------------
+const FString FTermDetection::getXTermColorName (FColor color)
+{
+  // Returns the reply to the color query (OSC 4)
+
+  FString prefix{};
+  prefix.sprintf("4;%hu;", color);
+  return FTermQuery::getOSCString(prefix);
 }
 
 //----------------------------------------------------------------------
@@ -604,7 +659,7 @@ char* FTermDetection::parseAnswerbackMsg (char current_termtype[])
   }
 
   // cygwin needs a backspace to delete the '♣' char
-  if ( isCygwinTerminal() )
+  if ( isCygwinTerminal() && ! FTermCache::isLoaded() )
     FTerm::putstring (BS " " BS);
 
 #if DEBUG
@@ -623,26 +678,8 @@ char* FTermDetection::parseAnswerbackMsg (char current_termtype[])
 //----------------------------------------------------------------------
 const FString FTermDetection::getAnswerbackMsg()
 {
-  FString answerback{""};
-  fd_set ifds{};
-  struct timeval tv{};
-  char temp[10]{};
-  int stdin_no = FTermios::getStdIn();
-
-  std::putchar (ENQ[0]);  // Send enquiry character
-  std::fflush(stdout);
-
-  FD_ZERO(&ifds);
-  FD_SET(stdin_no, &ifds);
-  tv.tv_sec  = 0;
-  tv.tv_usec = 150000;  // 150 ms
-
-  // Read the answerback message
-  if ( select (stdin_no + 1, &ifds, 0, 0, &tv) > 0 )
-    if ( std::fgets (temp, sizeof(temp) - 1, stdin) != 0 )
-      answerback = temp;
-
-  return answerback;
+  // Returns the reply to the enquiry character (ENQ)
+  return FTermCache::getAnswerback();
 }
 
 //----------------------------------------------------------------------
@@ -726,34 +763,8 @@ int FTermDetection::str2int (const FString& s)
 //----------------------------------------------------------------------
 const FString FTermDetection::getSecDA()
 {
-  FString sec_da_str{""};
-
-  int a{0}
-    , b{0}
-    , c{0}
-    , stdin_no{FTermios::getStdIn()}
-    , stdout_no{FTermios::getStdOut()};
-  fd_set ifds{};
-  struct timeval tv{};
-
-  // Get the secondary device attributes
-  ssize_t ret = write(stdout_no, SECDA, std::strlen(SECDA));
-
-  if ( ret == -1 )
-    return sec_da_str;
-
-  std::fflush(stdout);
-  FD_ZERO(&ifds);
-  FD_SET(stdin_no, &ifds);
-  tv.tv_sec  = 0;
-  tv.tv_usec = 600000;  // 600 ms
-
-  // Read the answer
-  if ( select (stdin_no + 1, &ifds, 0, 0, &tv) == 1
-    && std::scanf("\033[>%10d;%10d;%10dc", &a, &b, &c) == 3 )
-      sec_da_str.sprintf("\033[>%d;%d;%dc", a, b, c);
-
-  return sec_da_str;
+  // Returns the secondary device attributes reply (CSI > ... c)
+  return FTermCache::getSecondaryDA();
 }
 
 //----------------------------------------------------------------------
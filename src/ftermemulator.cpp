@@ -0,0 +1,1519 @@
+/***********************************************************************
+* ftermemulator.cpp - In-memory emulation of a xterm-compatible        *
+*                     terminal                                         *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "final/fcharmap.h"
+#include "final/fglyphstore.h"
+#include "final/ftermemulator.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr std::size_t FTermEmulator::MAX_PARAMETERS;
+constexpr std::size_t FTermEmulator::MAX_STRING_LENGTH;
+constexpr std::size_t FTermEmulator::MAX_CLUSTERS;
+constexpr uInt        FTermEmulator::CLUSTER_ID;
+
+namespace
+{
+
+// Unicode characters of the vt100 special graphics (0x5f - 0x7e)
+constexpr wchar_t dec_graphics[] =
+{
+  L' ',       L'\x25c6',  L'\x2592',  L'\x2409',  // _ ` a b
+  L'\x240c',  L'\x240d',  L'\x240a',  L'\x00b0',  // c d e f
+  L'\x00b1',  L'\x2424',  L'\x240b',  L'\x2518',  // g h i j
+  L'\x2510',  L'\x250c',  L'\x2514',  L'\x253c',  // k l m n
+  L'\x23ba',  L'\x23bb',  L'\x2500',  L'\x23bc',  // o p q r
+  L'\x23bd',  L'\x251c',  L'\x2524',  L'\x2534',  // s t u v
+  L'\x252c',  L'\x2502',  L'\x2264',  L'\x2265',  // w x y z
+  L'\x03c0',  L'\x2260',  L'\x00a3',  L'\x00b7'   // { | } ~
+};
+
+}  // anonymous namespace
+
+
+//----------------------------------------------------------------------
+// class FTermEmulator
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FTermEmulator::FTermEmulator()
+{
+  reset();
+}
+
+//----------------------------------------------------------------------
+FTermEmulator::FTermEmulator (std::size_t w, std::size_t h)
+  : width{w}
+  , height{h}
+{
+  reset();
+}
+
+//----------------------------------------------------------------------
+FTermEmulator::~FTermEmulator()  // destructor
+{ }
+
+
+// public methods of FTermEmulator
+//----------------------------------------------------------------------
+const FString FTermEmulator::getCharString ( std::size_t x
+                                           , std::size_t y ) const
+{
+  // Returns the character of the cell including combining characters
+
+  const FChar& cell = getChar(x, y);
+
+  if ( cell.attr.bit.fullwidth_padding )
+    return FString{};
+
+  return FString(getGlyph(cell.ch));
+}
+
+//----------------------------------------------------------------------
+const FString FTermEmulator::getLine (std::size_t y) const
+{
+  // Returns the text of a screen line without trailing spaces
+
+  std::wstring line{};
+
+  for (std::size_t x{0}; x < width; x++)
+  {
+    const FChar& cell = getChar(x, y);
+
+    if ( ! cell.attr.bit.fullwidth_padding )
+      line.append(getGlyph(cell.ch));
+  }
+
+  const std::size_t end = line.find_last_not_of(L' ');
+  line.erase( ( end == std::wstring::npos ) ? 0 : end + 1 );
+  return FString(line);
+}
+
+//----------------------------------------------------------------------
+const FString FTermEmulator::getText() const
+{
+  // Returns all screen lines separated by newlines
+
+  FString text{""};
+
+  for (std::size_t y{0}; y < height; y++)
+  {
+    if ( y > 0 )
+      text += L'\n';
+
+    text += getLine(y);
+  }
+
+  return text;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setSize (std::size_t w, std::size_t h)
+{
+  // Changes the screen size and keeps the upper left content
+
+  if ( w == 0 || h == 0 )
+    return;
+
+  const FChar blank = getBlankChar();
+
+  for (auto screen_data : { &screen, &inactive_screen })
+  {
+    std::vector<FChar> new_screen(w * h, blank);
+
+    if ( ! screen_data->empty() )
+    {
+      for (std::size_t y{0}; y < std::min(h, height); y++)
+        std::copy ( screen_data->begin() + long(y * width)
+                  , screen_data->begin() + long(y * width + std::min(w, width))
+                  , new_screen.begin() + long(y * w) );
+    }
+
+    screen_data->swap(new_screen);
+  }
+
+  width = w;
+  height = h;
+  top_margin = 0;
+  bottom_margin = h - 1;
+  left_margin = 0;
+  right_margin = w - 1;
+  cursor_x = std::min(cursor_x, w - 1);
+  cursor_y = std::min(cursor_y, h - 1);
+  saved_x = std::min(saved_x, w - 1);
+  saved_y = std::min(saved_y, h - 1);
+  wrap_pending = false;
+  resetTabStops();
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::write (char c)
+{
+  // Interprets one output byte of the program
+
+  const uChar ch = uChar(c);
+  byte_count++;
+
+  if ( recording_enabled )
+    recording.push_back(c);
+
+  // CAN and SUB cancel a sequence
+  if ( (ch == 0x18 || ch == 0x1a) && state != text_state )
+  {
+    state = text_state;
+    return;
+  }
+
+  switch ( state )
+  {
+    case text_state:
+      parseText (ch);
+      break;
+
+    case esc_state:
+      parseEscape (c);
+      break;
+
+    case esc_intermediate:
+      if ( ch >= 0x30 && ch <= 0x7e )  // Final byte
+      {
+        state = text_state;
+        executeEscape (intermediate, c);
+      }
+      else if ( ch < 0x20 )
+        executeControl (ch);
+
+      break;
+
+    case csi_state:
+      parseControlSequence (c);
+      break;
+
+    case osc_state:
+      if ( ch == 0x07 )  // BEL terminates the string
+      {
+        state = text_state;
+        executeOSC();
+      }
+      else if ( ch == 0x1b )
+        state = osc_esc_state;
+      else if ( sequence.length() < MAX_STRING_LENGTH )
+        sequence.push_back(c);
+
+      break;
+
+    case osc_esc_state:
+      executeOSC();
+      parseEscape (c);  // ESC \ is the string terminator
+      break;
+
+    case string_state:
+      if ( ch == 0x1b )
+        state = string_esc_state;
+      else if ( ch == 0x07 )
+        state = text_state;
+
+      break;
+
+    case string_esc_state:
+      parseEscape (c);
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+const std::string FTermEmulator::takeReply()
+{
+  // Returns and removes the answers to the terminal queries
+
+  std::string answer{};
+  answer.swap(reply);
+  return answer;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::reset()
+{
+  // Full reset (RIS)
+
+  screen.clear();
+  inactive_screen.clear();
+  clusters.clear();
+  cluster_index.clear();
+  sequence.clear();
+  reply.clear();
+  state = text_state;
+  utf8_bytes = 0;
+  last_char = L'\0';
+  cursor_x = 0;
+  cursor_y = 0;
+  alternate_screen = false;
+  mouse_mode = 0;
+  sgr_mouse = false;
+  softReset();
+  setSize (width, height);
+}
+
+
+// private methods of FTermEmulator
+//----------------------------------------------------------------------
+void FTermEmulator::parseText (uChar ch)
+{
+  if ( utf8_bytes > 0 )
+  {
+    if ( (ch & 0xc0) == 0x80 )  // UTF-8 continuation byte
+    {
+      code_point = (code_point << 6) | (ch & 0x3f);
+      utf8_bytes--;
+
+      if ( utf8_bytes == 0 )
+        print (wchar_t(code_point));
+
+      return;
+    }
+
+    utf8_bytes = 0;
+    print (L'\xfffd');  // Incomplete UTF-8 sequence
+  }
+
+  if ( ch < 0x20 )
+    executeControl (ch);
+  else if ( ch < 0x7f )
+  {
+    const bool graphics = ( shift_out ) ? g1_graphics : g0_graphics;
+
+    if ( graphics && ch >= 0x5f )
+      print (dec_graphics[ch - 0x5f]);
+    else
+      print (wchar_t(ch));
+  }
+  else if ( ch >= 0xc2 && ch <= 0xdf )
+  {
+    code_point = ch & 0x1f;
+    utf8_bytes = 1;
+  }
+  else if ( ch >= 0xe0 && ch <= 0xef )
+  {
+    code_point = ch & 0x0f;
+    utf8_bytes = 2;
+  }
+  else if ( ch >= 0xf0 && ch <= 0xf4 )
+  {
+    code_point = ch & 0x07;
+    utf8_bytes = 3;
+  }
+  else if ( ch != 0x7f )  // DEL is ignored
+    print (L'\xfffd');
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::parseEscape (char c)
+{
+  const uChar ch = uChar(c);
+  state = text_state;
+
+  switch ( c )
+  {
+    case '[':  // Control sequence introducer
+      sequence.clear();
+      state = csi_state;
+      break;
+
+    case ']':  // Operating system command
+      sequence.clear();
+      state = osc_state;
+      break;
+
+    case 'P':  // Device control string
+    case 'X':  // Start of string
+    case '^':  // Privacy message
+    case '_':  // Application program command
+      state = string_state;
+      break;
+
+    case '7':  // Save cursor
+      saveCursor();
+      break;
+
+    case '8':  // Restore cursor
+      restoreCursor();
+      break;
+
+    case 'D':  // Index
+      lineFeed();
+      break;
+
+    case 'E':  // Next line
+      cursor_x = 0;
+      lineFeed();
+      break;
+
+    case 'H':  // Horizontal tab set
+      tab_stops[cursor_x] = true;
+      break;
+
+    case 'M':  // Reverse index
+      reverseIndex();
+      break;
+
+    case 'c':  // Full reset
+      reset();
+      break;
+
+    default:
+      if ( ch >= 0x20 && ch <= 0x2f )
+      {
+        intermediate = c;
+        state = esc_intermediate;
+      }
+      else if ( ch < 0x20 )
+        executeControl (ch);
+
+      break;  // ESC \, ESC =, ESC > and others are ignored
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::parseControlSequence (char c)
+{
+  const uChar ch = uChar(c);
+
+  if ( ch >= 0x40 && ch <= 0x7e )  // Final byte
+  {
+    state = text_state;
+    executeControlSequence (c);
+  }
+  else if ( ch < 0x20 )
+    executeControl (ch);
+  else if ( sequence.length() < MAX_STRING_LENGTH )
+    sequence.push_back(c);
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::executeControl (uChar ch)
+{
+  switch ( ch )
+  {
+    case 0x08:  // Backspace
+      wrap_pending = false;
+
+      if ( cursor_x > 0 )
+        cursor_x--;
+
+      break;
+
+    case 0x09:  // Horizontal tab
+      tabForward (1);
+      break;
+
+    case 0x0a:  // Line feed
+    case 0x0b:  // Vertical tab
+    case 0x0c:  // Form feed
+      lineFeed();
+      break;
+
+    case 0x0d:  // Carriage return
+      cursor_x = 0;
+      wrap_pending = false;
+      break;
+
+    case 0x0e:  // Shift out (G1 character set)
+      shift_out = true;
+      break;
+
+    case 0x0f:  // Shift in (G0 character set)
+      shift_out = false;
+      break;
+
+    case 0x1b:  // Escape
+      state = esc_state;
+      sequence_count++;
+      break;
+
+    default:  // BEL, ENQ and the others are ignored
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::executeEscape (char inter, char final_byte)
+{
+  if ( inter == '(' )  // Designate G0 character set
+    g0_graphics = ( final_byte == '0' );
+  else if ( inter == ')' )  // Designate G1 character set
+    g1_graphics = ( final_byte == '0' );
+  else if ( inter == '#' && final_byte == '8' )  // Screen alignment test
+  {
+    FChar fill = getBlankChar();
+    fill.ch = L'E';
+    fill.fg_color = fc::Default;
+    fill.bg_color = fc::Default;
+    std::fill (screen.begin(), screen.end(), fill);
+    top_margin = 0;
+    bottom_margin = height - 1;
+    left_margin = 0;
+    right_margin = width - 1;
+    setCursor (0, 0);
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::executeControlSequence (char final_byte)
+{
+  // Splits the sequence into the parameters, the private marker
+  // and the intermediate byte and executes it
+
+  char marker{'\0'};
+  char inter{'\0'};
+  int value{-1};  // -1 = omitted parameter
+  parameter_count = 0;
+
+  for (auto&& c : sequence)
+  {
+    if ( c >= '0' && c <= '9' )
+    {
+      if ( value < 0 )
+        value = 0;
+
+      if ( value < 100000 )
+        value = value * 10 + (c - '0');
+    }
+    else if ( c == ';' || c == ':' )
+    {
+      if ( parameter_count < MAX_PARAMETERS )
+        parameters[parameter_count++] = value;
+
+      value = -1;
+    }
+    else if ( c >= '<' && c <= '?' )
+      marker = c;
+    else if ( c >= ' ' && c <= '/' )
+      inter = c;
+  }
+
+  if ( (value >= 0 || parameter_count > 0)
+    && parameter_count < MAX_PARAMETERS )
+    parameters[parameter_count++] = value;
+
+  if ( inter == '!' && final_byte == 'p' )  // Soft terminal reset
+  {
+    softReset();
+    return;
+  }
+
+  if ( inter != '\0' )  // e.g. cursor style
+    return;
+
+  if ( marker == '?' )
+  {
+    executePrivateSequence (final_byte);
+    return;
+  }
+
+  if ( marker == '>' )
+  {
+    if ( final_byte == 'c' )  // Secondary device attributes
+      reply.append(CSI ">0;0;0c");
+
+    return;
+  }
+
+  if ( marker != '\0' )
+    return;
+
+  switch ( final_byte )
+  {
+    case '@':  // Insert characters
+      insertCells (getCount());
+      break;
+
+    case 'A':  // Cursor up
+      moveCursorUp (getCount());
+      break;
+
+    case 'B':  // Cursor down
+    case 'e':  // Vertical position relative
+      moveCursorDown (getCount());
+      break;
+
+    case 'C':  // Cursor forward
+    case 'a':  // Horizontal position relative
+      setCursor (cursor_x + getCount(), cursor_y);
+      break;
+
+    case 'D':  // Cursor backward
+      setCursor (cursor_x - std::min(getCount(), cursor_x), cursor_y);
+      break;
+
+    case 'E':  // Cursor next line
+      moveCursorDown (getCount());
+      cursor_x = 0;
+      break;
+
+    case 'F':  // Cursor preceding line
+      moveCursorUp (getCount());
+      cursor_x = 0;
+      break;
+
+    case 'G':  // Cursor character absolute
+    case '`':  // Horizontal position absolute
+      setCursor (getCount() - 1, cursor_y);
+      break;
+
+    case 'H':  // Cursor position
+    case 'f':  // Horizontal and vertical position
+      setCursor (getCount(1) - 1, getCount(0) - 1);
+      break;
+
+    case 'I':  // Cursor forward tabulation
+      tabForward (getCount());
+      break;
+
+    case 'J':  // Erase in display
+      eraseDisplay (getParameter(0, 0));
+      break;
+
+    case 'K':  // Erase in line
+      eraseLine (getParameter(0, 0));
+      break;
+
+    case 'L':  // Insert lines
+      if ( cursor_y >= top_margin && cursor_y <= bottom_margin
+        && isInsideLeftRightMargins() )
+      {
+        scrollDown (cursor_y, bottom_margin, getCount());
+        setCursor (0, cursor_y);
+      }
+
+      break;
+
+    case 'M':  // Delete lines
+      if ( cursor_y >= top_margin && cursor_y <= bottom_margin
+        && isInsideLeftRightMargins() )
+      {
+        scrollUp (cursor_y, bottom_margin, getCount());
+        setCursor (0, cursor_y);
+      }
+
+      break;
+
+    case 'P':  // Delete characters
+      deleteCells (getCount());
+      break;
+
+    case 'S':  // Scroll up
+      scrollUp (top_margin, bottom_margin, getCount());
+      break;
+
+    case 'T':  // Scroll down
+      if ( parameter_count <= 1 )
+        scrollDown (top_margin, bottom_margin, getCount());
+
+      break;
+
+    case 'X':  // Erase characters
+      eraseCells (cursor_x, cursor_x + getCount(), cursor_y);
+      break;
+
+    case 'Z':  // Cursor backward tabulation
+      tabBackward (getCount());
+      break;
+
+    case 'b':  // Repeat the preceding graphic character
+      if ( last_char != L'\0' )
+      {
+        const std::size_t count = std::min(getCount(), width * height);
+
+        for (std::size_t i{0}; i < count; i++)
+          print (last_char);
+      }
+
+      break;
+
+    case 'c':  // Primary device attributes
+      if ( getParameter(0, 0) == 0 )
+        reply.append(CSI "?1;2c");
+
+      break;
+
+    case 'd':  // Line position absolute
+      setCursor (cursor_x, getCount() - 1);
+      break;
+
+    case 'g':  // Tab clear
+      if ( getParameter(0, 0) == 0 )
+        tab_stops[cursor_x] = false;
+      else if ( getParameter(0, 0) == 3 )
+        std::fill (tab_stops.begin(), tab_stops.end(), false);
+
+      break;
+
+    case 'h':  // Set mode
+      setMode (true);
+      break;
+
+    case 'l':  // Reset mode
+      setMode (false);
+      break;
+
+    case 'm':  // Select graphic rendition
+      setGraphicRendition();
+      break;
+
+    case 'n':  // Device status report
+      if ( getParameter(0, 0) == 5 )
+        reply.append(CSI "0n");
+      else if ( getParameter(0, 0) == 6 )
+      {
+        char cpr[32]{};
+        std::snprintf ( cpr, sizeof(cpr), CSI "%zu;%zuR"
+                      , cursor_y + 1, cursor_x + 1 );
+        reply.append(cpr);
+      }
+
+      break;
+
+    case 'r':  // Set top and bottom margins
+    {
+      const std::size_t top = getCount(0) - 1;
+      const std::size_t bottom = ( getParameter(1, 0) > 0 )
+                               ? std::size_t(getParameter(1, 0)) - 1
+                               : height - 1;
+
+      if ( top < bottom && bottom < height )
+      {
+        top_margin = top;
+        bottom_margin = bottom;
+        setCursor (0, 0);
+      }
+
+      break;
+    }
+
+    case 's':  // Set left and right margins or save cursor
+      if ( lr_margin_mode )
+        setLeftRightMargins();
+      else
+        saveCursor();
+
+      break;
+
+    case 't':  // Window manipulation
+      if ( getParameter(0, 0) == 18 )  // Report the text area size
+      {
+        char size[32]{};
+        std::snprintf (size, sizeof(size), CSI "8;%zu;%zut", height, width);
+        reply.append(size);
+      }
+
+      break;
+
+    case 'u':  // Restore cursor
+      restoreCursor();
+      break;
+
+    default:
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::executePrivateSequence (char final_byte)
+{
+  switch ( final_byte )
+  {
+    case 'h':  // DEC private mode set
+      setPrivateMode (true);
+      break;
+
+    case 'l':  // DEC private mode reset
+      setPrivateMode (false);
+      break;
+
+    case 'n':  // Extended cursor position report
+      if ( getParameter(0, 0) == 6 )
+      {
+        char cpr[32]{};
+        std::snprintf ( cpr, sizeof(cpr), CSI "?%zu;%zuR"
+                      , cursor_y + 1, cursor_x + 1 );
+        reply.append(cpr);
+      }
+
+      break;
+
+    default:
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::executeOSC()
+{
+  // Only the window title is used (OSC 0 and OSC 2)
+
+  const std::size_t pos = sequence.find(';');
+
+  if ( pos == std::string::npos )
+    return;
+
+  const std::string command(sequence.substr(0, pos));
+
+  if ( command == "0" || command == "2" )
+    title = FString(sequence.substr(pos + 1));
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setGraphicRendition()
+{
+  auto& bit = attribute.attr.bit;
+
+  if ( parameter_count == 0 )
+    parameters[parameter_count++] = 0;
+
+  for (std::size_t i{0}; i < parameter_count; i++)
+  {
+    const int param = ( parameters[i] < 0 ) ? 0 : parameters[i];
+
+    switch ( param )
+    {
+      case 0:  // Reset all attributes
+        attribute = getBlankChar();
+        attribute.fg_color = fc::Default;
+        attribute.bg_color = fc::Default;
+        break;
+
+      case 1:
+        bit.bold = true;
+        break;
+
+      case 2:
+        bit.dim = true;
+        break;
+
+      case 3:
+        bit.italic = true;
+        break;
+
+      case 4:
+        bit.underline = true;
+        break;
+
+      case 5:
+        bit.blink = true;
+        break;
+
+      case 7:
+        bit.reverse = true;
+        break;
+
+      case 8:
+        bit.invisible = true;
+        break;
+
+      case 9:
+        bit.crossed_out = true;
+        break;
+
+      case 21:
+        bit.dbl_underline = true;
+        break;
+
+      case 22:
+        bit.bold = false;
+        bit.dim = false;
+        break;
+
+      case 23:
+        bit.italic = false;
+        break;
+
+      case 24:
+        bit.underline = false;
+        bit.dbl_underline = false;
+        break;
+
+      case 25:
+        bit.blink = false;
+        break;
+
+      case 27:
+        bit.reverse = false;
+        break;
+
+      case 28:
+        bit.invisible = false;
+        break;
+
+      case 29:
+        bit.crossed_out = false;
+        break;
+
+      case 38:
+        attribute.fg_color = getExtendedColor(i, attribute.fg_color);
+        break;
+
+      case 39:
+        attribute.fg_color = fc::Default;
+        break;
+
+      case 48:
+        attribute.bg_color = getExtendedColor(i, attribute.bg_color);
+        break;
+
+      case 49:
+        attribute.bg_color = fc::Default;
+        break;
+
+      default:
+        if ( param >= 30 && param <= 37 )
+          attribute.fg_color = FColor(param - 30);
+        else if ( param >= 40 && param <= 47 )
+          attribute.bg_color = FColor(param - 40);
+        else if ( param >= 90 && param <= 97 )
+          attribute.fg_color = FColor(param - 90 + 8);
+        else if ( param >= 100 && param <= 107 )
+          attribute.bg_color = FColor(param - 100 + 8);
+
+        break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setMode (bool enable)
+{
+  for (std::size_t i{0}; i < parameter_count; i++)
+  {
+    if ( parameters[i] == 4 )  // Insert mode
+      insert_mode = enable;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setPrivateMode (bool enable)
+{
+  for (std::size_t i{0}; i < parameter_count; i++)
+  {
+    switch ( parameters[i] )
+    {
+      case 7:  // Auto-wrap mode
+        autowrap = enable;
+        wrap_pending = false;
+        break;
+
+      case 25:  // Show cursor
+        show_cursor = enable;
+        break;
+
+      case 47:
+      case 1047:  // Alternate screen buffer
+        switchScreen (enable, false);
+        break;
+
+      case 69:  // Left and right margin mode (DECLRMM)
+        lr_margin_mode = enable;
+
+        if ( ! enable )
+        {
+          left_margin = 0;
+          right_margin = width - 1;
+        }
+
+        break;
+
+      case 1048:  // Save or restore the cursor
+        if ( enable )
+          saveCursor();
+        else
+          restoreCursor();
+
+        break;
+
+      case 1049:  // Alternate screen buffer with saved cursor
+        if ( enable )
+        {
+          saveCursor();
+          switchScreen (true, true);
+        }
+        else
+        {
+          switchScreen (false, false);
+          restoreCursor();
+        }
+
+        break;
+
+      case 9:
+      case 1000:
+      case 1002:
+      case 1003:  // Mouse tracking
+        mouse_mode = ( enable ) ? parameters[i] : 0;
+        break;
+
+      case 1006:  // SGR mouse mode
+        sgr_mouse = enable;
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::print (wchar_t ch)
+{
+  if ( FGlyphStore::isExtendingCharacter(ch) )
+  {
+    combine (ch);
+    return;
+  }
+
+  const int column_width = fc::getCharacterWidth(ch);
+
+  if ( column_width == 0 )
+    return;  // Like U+200B, without a cell of its own
+
+  const std::size_t char_width = ( column_width == 2
+                                 && width > 1 ) ? 2 : 1;
+
+  if ( wrap_pending )
+  {
+    cursor_x = 0;
+    lineFeed();
+  }
+
+  // A full-width character does not fit into the last column
+  if ( char_width == 2 && cursor_x == width - 1 )
+  {
+    if ( ! autowrap )
+      return;
+
+    cursor_x = 0;
+    lineFeed();
+  }
+
+  if ( insert_mode )
+    insertCells (char_width);
+
+  splitWideChar (cursor_x, cursor_y);
+
+  if ( char_width == 2 )
+    splitWideChar (cursor_x + 1, cursor_y);
+
+  FChar& cell = getCell(cursor_x, cursor_y);
+  cell = attribute;
+  cell.ch = ch;
+  cell.attr.bit.char_width = char_width & 0x03;
+
+  if ( char_width == 2 )
+  {
+    FChar& padding = getCell(cursor_x + 1, cursor_y);
+    padding = attribute;
+    padding.ch = L'\0';
+    padding.attr.bit.fullwidth_padding = true;
+    padding.attr.bit.char_width = 0;
+  }
+
+  last_char = ch;
+  cursor_x += char_width;
+
+  if ( cursor_x >= width )
+  {
+    cursor_x = width - 1;
+    wrap_pending = autowrap;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::combine (wchar_t ch)
+{
+  // Appends a combining character to the preceding character
+
+  std::size_t x = cursor_x;
+
+  if ( ! wrap_pending )
+  {
+    if ( x == 0 )
+      return;
+
+    x--;
+  }
+
+  if ( getCell(x, cursor_y).attr.bit.fullwidth_padding && x > 0 )
+    x--;
+
+  FChar& cell = getCell(x, cursor_y);
+  const std::wstring glyph = getGlyph(cell.ch) + ch;
+  const auto iter = cluster_index.find(glyph);
+
+  if ( iter != cluster_index.end() )
+    cell.ch = wchar_t(CLUSTER_ID + iter->second);
+  else if ( clusters.size() < MAX_CLUSTERS )
+  {
+    cell.ch = wchar_t(CLUSTER_ID + clusters.size());
+    cluster_index[glyph] = clusters.size();
+    clusters.push_back(glyph);
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::lineFeed()
+{
+  wrap_pending = false;
+
+  if ( cursor_y == bottom_margin )
+  {
+    // Outside the left and right margins nothing is scrolled
+    if ( isInsideLeftRightMargins() )
+      scrollUp (top_margin, bottom_margin, 1);
+  }
+  else if ( cursor_y < height - 1 )
+    cursor_y++;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::reverseIndex()
+{
+  wrap_pending = false;
+
+  if ( cursor_y == top_margin )
+  {
+    if ( isInsideLeftRightMargins() )
+      scrollDown (top_margin, bottom_margin, 1);
+  }
+  else if ( cursor_y > 0 )
+    cursor_y--;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::tabForward (std::size_t count)
+{
+  wrap_pending = false;
+
+  while ( count > 0 && cursor_x < width - 1 )
+  {
+    cursor_x++;
+
+    if ( tab_stops[cursor_x] )
+      count--;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::tabBackward (std::size_t count)
+{
+  wrap_pending = false;
+
+  while ( count > 0 && cursor_x > 0 )
+  {
+    cursor_x--;
+
+    if ( tab_stops[cursor_x] )
+      count--;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setCursor (std::size_t x, std::size_t y)
+{
+  cursor_x = std::min(x, width - 1);
+  cursor_y = std::min(y, height - 1);
+  wrap_pending = false;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::moveCursorUp (std::size_t count)
+{
+  // The cursor stops at the top margin
+
+  const std::size_t limit = ( cursor_y >= top_margin ) ? top_margin : 0;
+  const std::size_t y = ( cursor_y - limit > count )
+                      ? cursor_y - count
+                      : limit;
+  setCursor (cursor_x, y);
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::moveCursorDown (std::size_t count)
+{
+  // The cursor stops at the bottom margin
+
+  const std::size_t limit = ( cursor_y <= bottom_margin )
+                          ? bottom_margin
+                          : height - 1;
+  const std::size_t y = ( limit - cursor_y > count )
+                      ? cursor_y + count
+                      : limit;
+  setCursor (cursor_x, y);
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::saveCursor()
+{
+  saved_x = cursor_x;
+  saved_y = cursor_y;
+  saved_attribute = attribute;
+  saved_g0_graphics = g0_graphics;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::restoreCursor()
+{
+  setCursor (saved_x, saved_y);
+  attribute = saved_attribute;
+  g0_graphics = saved_g0_graphics;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::setLeftRightMargins()
+{
+  // Sets the left and right margins (DECSLRM)
+
+  const std::size_t left = getCount(0) - 1;
+  const std::size_t right = ( getParameter(1, 0) > 0 )
+                          ? std::size_t(getParameter(1, 0)) - 1
+                          : width - 1;
+
+  if ( left < right && right < width )
+  {
+    left_margin = left;
+    right_margin = right;
+    setCursor (0, 0);
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::scrollUp ( std::size_t top, std::size_t bottom
+                             , std::size_t count )
+{
+  // Scrolls the lines top to bottom between the left and right
+  // margins up and fills the new lines at the bottom with blanks
+
+  const std::size_t lines = bottom - top + 1;
+  const long columns = long(right_margin - left_margin + 1);
+  count = std::min(count, lines);
+
+  for (std::size_t y{top}; y <= bottom; y++)
+  {
+    const auto dest = screen.begin() + long(y * width + left_margin);
+
+    if ( y + count <= bottom )
+    {
+      const auto src = dest + long(count * width);
+      std::copy (src, src + columns, dest);
+    }
+    else
+      std::fill (dest, dest + columns, getBlankChar());
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::scrollDown ( std::size_t top, std::size_t bottom
+                               , std::size_t count )
+{
+  // Scrolls the lines top to bottom between the left and right
+  // margins down and fills the new lines at the top with blanks
+
+  const std::size_t lines = bottom - top + 1;
+  const long columns = long(right_margin - left_margin + 1);
+  count = std::min(count, lines);
+
+  for (std::size_t y{bottom + 1}; y-- > top; )
+  {
+    const auto dest = screen.begin() + long(y * width + left_margin);
+
+    if ( y >= top + count )
+    {
+      const auto src = dest - long(count * width);
+      std::copy (src, src + columns, dest);
+    }
+    else
+      std::fill (dest, dest + columns, getBlankChar());
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::eraseCells ( std::size_t from, std::size_t to
+                               , std::size_t y )
+{
+  // Erases the cells from <= x < to in line y
+
+  to = std::min(to, width);
+
+  if ( from >= to )
+    return;
+
+  splitWideChar (from, y);
+  splitWideChar (to - 1, y);
+  const auto line = screen.begin() + long(y * width);
+  std::fill (line + long(from), line + long(to), getBlankChar());
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::eraseDisplay (int mode)
+{
+  switch ( mode )
+  {
+    case 0:  // From the cursor to the end of the screen
+      eraseCells (cursor_x, width, cursor_y);
+
+      for (std::size_t y = cursor_y + 1; y < height; y++)
+        eraseCells (0, width, y);
+
+      break;
+
+    case 1:  // From the beginning of the screen to the cursor
+      for (std::size_t y{0}; y < cursor_y; y++)
+        eraseCells (0, width, y);
+
+      eraseCells (0, cursor_x + 1, cursor_y);
+      break;
+
+    case 2:  // Entire screen
+    case 3:
+      std::fill (screen.begin(), screen.end(), getBlankChar());
+      break;
+
+    default:
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::eraseLine (int mode)
+{
+  switch ( mode )
+  {
+    case 0:  // From the cursor to the end of the line
+      eraseCells (cursor_x, width, cursor_y);
+      break;
+
+    case 1:  // From the beginning of the line to the cursor
+      eraseCells (0, cursor_x + 1, cursor_y);
+      break;
+
+    case 2:  // Entire line
+      eraseCells (0, width, cursor_y);
+      break;
+
+    default:
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::insertCells (std::size_t count)
+{
+  // Shifts the characters from the cursor to the right
+
+  count = std::min(count, width - cursor_x);
+  const auto line = screen.begin() + long(cursor_y * width);
+  splitWideChar (cursor_x, cursor_y);
+  std::copy_backward ( line + long(cursor_x)
+                     , line + long(width - count)
+                     , line + long(width) );
+  std::fill ( line + long(cursor_x)
+            , line + long(cursor_x + count), getBlankChar() );
+  wrap_pending = false;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::deleteCells (std::size_t count)
+{
+  // Shifts the characters right of the cursor to the left
+
+  count = std::min(count, width - cursor_x);
+  const auto line = screen.begin() + long(cursor_y * width);
+  splitWideChar (cursor_x, cursor_y);
+  std::copy ( line + long(cursor_x + count)
+            , line + long(width)
+            , line + long(cursor_x) );
+  std::fill (line + long(width - count), line + long(width), getBlankChar());
+  wrap_pending = false;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::splitWideChar (std::size_t x, std::size_t y)
+{
+  // Replaces a full-width character that is overwritten in one
+  // of its two columns by a space
+
+  if ( x >= width )
+    return;
+
+  FChar& cell = getCell(x, y);
+
+  if ( cell.attr.bit.fullwidth_padding && x > 0 )
+  {
+    FChar& wide_char = getCell(x - 1, y);
+    wide_char.ch = L' ';
+    wide_char.attr.bit.char_width = 1;
+    cell.ch = L' ';
+    cell.attr.bit.fullwidth_padding = false;
+    cell.attr.bit.char_width = 1;
+  }
+  else if ( cell.attr.bit.char_width == 2 && x + 1 < width )
+  {
+    FChar& padding = getCell(x + 1, y);
+    cell.ch = L' ';
+    cell.attr.bit.char_width = 1;
+    padding.ch = L' ';
+    padding.attr.bit.fullwidth_padding = false;
+    padding.attr.bit.char_width = 1;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::switchScreen (bool alternate, bool clear)
+{
+  if ( alternate != alternate_screen )
+  {
+    screen.swap(inactive_screen);
+    alternate_screen = alternate;
+  }
+
+  if ( alternate && clear )
+    std::fill (screen.begin(), screen.end(), getBlankChar());
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::softReset()
+{
+  // Soft terminal reset (DECSTR)
+
+  attribute = FChar{};
+  attribute.ch = L' ';
+  attribute.fg_color = fc::Default;
+  attribute.bg_color = fc::Default;
+  saved_attribute = attribute;
+  saved_x = 0;
+  saved_y = 0;
+  top_margin = 0;
+  bottom_margin = height - 1;
+  left_margin = 0;
+  right_margin = width - 1;
+  lr_margin_mode = false;
+  wrap_pending = false;
+  autowrap = true;
+  insert_mode = false;
+  show_cursor = true;
+  g0_graphics = false;
+  g1_graphics = false;
+  shift_out = false;
+  saved_g0_graphics = false;
+}
+
+//----------------------------------------------------------------------
+void FTermEmulator::resetTabStops()
+{
+  // Sets a tab stop at every eighth column
+
+  tab_stops.assign(width, false);
+
+  for (std::size_t x{8}; x < width; x += 8)
+    tab_stops[x] = true;
+}
+
+//----------------------------------------------------------------------
+int FTermEmulator::getParameter (std::size_t index, int default_value) const
+{
+  if ( index < parameter_count && parameters[index] >= 0 )
+    return parameters[index];
+
+  return default_value;
+}
+
+//----------------------------------------------------------------------
+std::size_t FTermEmulator::getCount (std::size_t index) const
+{
+  // Omitted and zero counts are one
+
+  const int count = getParameter(index, 1);
+  return ( count > 0 ) ? std::size_t(count) : 1;
+}
+
+//----------------------------------------------------------------------
+FChar FTermEmulator::getBlankChar() const
+{
+  // Erased cells get the current background color
+  // (background color erase)
+
+  FChar blank{};
+  blank.ch = L' ';
+  blank.fg_color = attribute.fg_color;
+  blank.bg_color = attribute.bg_color;
+  blank.attr.bit.char_width = 1;
+  return blank;
+}
+
+//----------------------------------------------------------------------
+const std::wstring FTermEmulator::getGlyph (wchar_t ch) const
+{
+  if ( uInt(ch) >= CLUSTER_ID && uInt(ch) - CLUSTER_ID < clusters.size() )
+    return clusters[uInt(ch) - CLUSTER_ID];
+
+  return std::wstring(1, ch);
+}
+
+//----------------------------------------------------------------------
+FColor FTermEmulator::getExtendedColor ( std::size_t& index
+                                       , FColor color ) const
+{
+  // Reads the color of "38;5;n" or "38;2;r;g;b" (as the nearest
+  // color of the 6x6x6 color cube)
+
+  if ( index + 2 < parameter_count && parameters[index + 1] == 5 )
+  {
+    index += 2;
+    return FColor(std::max(parameters[index], 0) & 0xff);
+  }
+
+  if ( index + 4 < parameter_count && parameters[index + 1] == 2 )
+  {
+    const auto level = [] (int value)
+    {
+      value = std::max(std::min(value, 255), 0);
+      return ( value < 48 ) ? 0 : ( value < 115 ) ? 1 : (value - 35) / 40;
+    };
+
+    const int red = level(parameters[index + 2]);
+    const int green = level(parameters[index + 3]);
+    const int blue = level(parameters[index + 4]);
+    index += 4;
+    return FColor(16 + 36 * red + 6 * green + blue);
+  }
+
+  index = parameter_count;  // Skips the invalid parameters
+  return color;
+}
+
+}  // namespace finalcut
@@ -0,0 +1,228 @@
+/***********************************************************************
+* ftermheadless.cpp - Virtual terminal without a tty                   *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "final/fc.h"
+#include "final/fkey_map.h"
+#include "final/ftermheadless.h"
+
+namespace finalcut
+{
+
+// static class attributes
+FTermEmulator FTermHeadless::emulator{};
+int           FTermHeadless::input_fd{-1};
+int           FTermHeadless::saved_stdin_fd{-1};
+bool          FTermHeadless::active{false};
+
+
+//----------------------------------------------------------------------
+// class FTermHeadless
+//----------------------------------------------------------------------
+
+// public methods of FTermHeadless
+//----------------------------------------------------------------------
+bool FTermHeadless::init (std::size_t width, std::size_t height)
+{
+  // Replaces stdin with a pipe for the injected input and
+  // starts the terminal emulator with the given size
+
+  if ( active )
+    return true;
+
+  int fd[2]{};
+
+  if ( pipe(fd) != 0 )
+    return false;
+
+  saved_stdin_fd = dup(STDIN_FILENO);
+
+  if ( dup2(fd[0], STDIN_FILENO) == -1 )
+  {
+    close (fd[0]);
+    close (fd[1]);
+
+    if ( saved_stdin_fd != -1 )
+      close (saved_stdin_fd);
+
+    saved_stdin_fd = -1;
+    return false;
+  }
+
+  close (fd[0]);
+  input_fd = fd[1];
+
+  // A full pipe must not block the program
+  fcntl (input_fd, F_SETFL, fcntl(input_fd, F_GETFL) | O_NONBLOCK);
+  fcntl (input_fd, F_SETFD, FD_CLOEXEC);
+
+  if ( saved_stdin_fd != -1 )
+    fcntl (saved_stdin_fd, F_SETFD, FD_CLOEXEC);
+
+  emulator.setSize (width, height);
+  emulator.reset();
+
+  // The emulator understands the sequences of xterm-256color
+  setenv ("TERM", "xterm-256color", 1);
+  active = true;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTermHeadless::finish()
+{
+  // Restores stdin (the screen content is kept)
+
+  if ( ! active )
+    return;
+
+  if ( saved_stdin_fd != -1 )
+  {
+    dup2 (saved_stdin_fd, STDIN_FILENO);
+    close (saved_stdin_fd);
+    saved_stdin_fd = -1;
+  }
+
+  close (input_fd);
+  input_fd = -1;
+  active = false;
+}
+
+//----------------------------------------------------------------------
+void FTermHeadless::write (char c)
+{
+  // Passes a terminal output byte to the emulator
+
+  emulator.write(c);
+
+  // The answers to terminal queries arrive like key presses
+  if ( emulator.hasReply() )
+    sendString (emulator.takeReply());
+}
+
+//----------------------------------------------------------------------
+bool FTermHeadless::sendString (const std::string& str)
+{
+  // Injects input bytes as if they were typed on the keyboard
+
+  if ( ! active )
+    return false;
+
+  std::size_t written{0};
+
+  while ( written < str.length() )
+  {
+    const ssize_t bytes = ::write ( input_fd, str.data() + written
+                                  , str.length() - written );
+
+    if ( bytes <= 0 )
+      return false;
+
+    written += std::size_t(bytes);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+bool FTermHeadless::sendKey (FKey key)
+{
+  // Injects the byte sequence of a key
+
+  for (std::size_t i{0}; fc::fkey[i].tname[0] != 0; i++)
+  {
+    if ( fc::fkey[i].num == key && fc::fkey[i].string )
+      return sendString (fc::fkey[i].string);
+  }
+
+  for (std::size_t i{0}; fc::fmetakey[i].string[0] != 0; i++)
+  {
+    if ( fc::fmetakey[i].num == key )
+      return sendString (fc::fmetakey[i].string);
+  }
+
+  if ( key >= 0x110000 )  // No unicode character
+    return false;
+
+  // UTF-8 encoded character
+  std::string str{};
+
+  if ( key < 0x80 )
+    str.push_back(char(key));
+  else if ( key < 0x800 )
+  {
+    str.push_back(char(0xc0 | (key >> 6)));
+    str.push_back(char(0x80 | (key & 0x3f)));
+  }
+  else if ( key < 0x10000 )
+  {
+    str.push_back(char(0xe0 | (key >> 12)));
+    str.push_back(char(0x80 | ((key >> 6) & 0x3f)));
+    str.push_back(char(0x80 | (key & 0x3f)));
+  }
+  else
+  {
+    str.push_back(char(0xf0 | (key >> 18)));
+    str.push_back(char(0x80 | ((key >> 12) & 0x3f)));
+    str.push_back(char(0x80 | ((key >> 6) & 0x3f)));
+    str.push_back(char(0x80 | (key & 0x3f)));
+  }
+
+  return sendString (str);
+}
+
+//----------------------------------------------------------------------
+bool FTermHeadless::sendMouse ( mouse_button button
+                              , const FPoint& pos, bool pressed )
+{
+  // Injects a mouse event in the SGR format at the terminal
+  // position pos (1-based) if the program has enabled the mouse
+
+  if ( ! emulator.isMouseTracking() )
+    return false;
+
+  char event[64]{};
+  std::snprintf ( event, sizeof(event), CSI "<%d;%d;%d%c"
+                , int(button), pos.getX(), pos.getY()
+                , ( pressed ) ? 'M' : 'm' );
+  return sendString (event);
+}
+
+//----------------------------------------------------------------------
+void FTermHeadless::resize (std::size_t width, std::size_t height)
+{
+  // Changes the terminal size and informs the program
+
+  emulator.setSize (width, height);
+
+  if ( active )
+    std::raise (SIGWINCH);
+}
+
+}  // namespace finalcut
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <utility>
 #include <vector>
 
 #include "final/fc.h"
@@ -29,6 +30,7 @@
 #include "final/ftermcap.h"
 #include "final/ftermdetection.h"
 #include "final/ftermlinux.h"
+#include "final/ftermvcsa.h"
 #include "final/ftypes.h"
 
 #if defined(__linux__)
@@ -41,6 +43,15 @@
 namespace finalcut
 {
 
+// static class attributes
+#if defined(__linux__)
+FTermLinux::ConsoleFont  FTermLinux::saved_font{};
+FTermLinux::UnicodeMap   FTermLinux::saved_unicode_map{};
+uInt64                   FTermLinux::font_fingerprint{0};
+uInt64                   FTermLinux::unimap_fingerprint{0};
+#endif  // defined(__linux__)
+
+
 //----------------------------------------------------------------------
 // class FTermLinux
 //----------------------------------------------------------------------
@@ -48,15 +59,7 @@ namespace finalcut
 // constructors and destructor
 //----------------------------------------------------------------------
 FTermLinux::~FTermLinux()  // destructor
-{
-#if defined(__linux__)
-  if ( screen_font.data )
-    delete[] screen_font.data;
-
-  if ( screen_unicode_map.entries )
-    delete[] screen_unicode_map.entries;
-#endif  // defined(__linux__)
-}
+{ }
 
 // public methods of FTermLinux
 //----------------------------------------------------------------------
@@ -159,8 +162,6 @@ void FTermLinux::init()
 
   fsystem = FTerm::getFSystem();
   term_detection = FTerm::getFTermDetection();
-  screen_unicode_map.entries = nullptr;
-  screen_font.data = nullptr;
   fterm_data->supportShadowCharacter (true);
   fterm_data->supportHalfBlockCharacter (true);
 
@@ -191,7 +192,7 @@ void FTermLinux::init()
       framebuffer_bpp = getFramebuffer_bpp();
 
       // More than 4 bits per pixel and the font uses the blink-bit
-      if ( framebuffer_bpp >= 4 && screen_font.charcount <= 256 )
+      if ( framebuffer_bpp >= 4 && saved_font.charcount <= 256 )
         FTermcap::max_color = 16;
     }
 
@@ -213,7 +214,7 @@ void FTermLinux::initCharMap()
   if ( new_font || vga_font )
     return;
 
-  if ( screen_unicode_map.entry_ct > 0 && screen_unicode_map.entries )
+  if ( ! saved_unicode_map.entries.empty() )
   {
     for (std::size_t i{0}; i <= fc::lastCharItem; i++ )
     {
@@ -242,6 +243,7 @@ void FTermLinux::initCharMap()
   }
 
   initSpecialCharacter();
+  setVcsaCharMap (getSavedUnicodeMap(), saved_font.charcount);
 }
 
 //----------------------------------------------------------------------
@@ -278,6 +280,7 @@ bool FTermLinux::loadVGAFont()
                                / sizeof(unipair) );
       unimap.entries = &fc::unicode_cp437_pairs[0];
       setUnicodeMap(&unimap);
+      setVcsaCharMap (unimap, 256);
     }
     else
       vga_font = false;
@@ -324,6 +327,7 @@ bool FTermLinux::loadNewFont()
                                / sizeof(unipair) );
       unimap.entries = &fc::unicode_newfont_pairs[0];
       setUnicodeMap(&unimap);
+      setVcsaCharMap (unimap, 256);
     }
     else
       new_font = false;
@@ -352,26 +356,24 @@ bool FTermLinux::loadOldFont()
   {
     if ( isLinuxConsole() )
     {
-      if ( screen_font.data )
+      // The saved font is kept for further font changes
+      if ( ! saved_font.data.empty() )
       {
-        int ret = setScreenFont ( screen_font.data
-                                , screen_font.charcount
-                                , screen_font.width
-                                , screen_font.height
-                                , true );
-        delete[] screen_font.data;
-        screen_font.data = nullptr;
+        int ret = setScreenFont ( saved_font.data.data()
+                                , saved_font.charcount
+                                , saved_font.width
+                                , saved_font.height );
 
         if ( ret == 0 )
           retval = true;
       }
 
-      if ( screen_unicode_map.entries )
+      if ( ! saved_unicode_map.entries.empty() )
       {
-        setUnicodeMap (&screen_unicode_map);
+        struct unimapdesc unimap = getSavedUnicodeMap();
+        setUnicodeMap (&unimap);
+        setVcsaCharMap (unimap, saved_font.charcount);
         initCharMap();
-        delete[] screen_unicode_map.entries;
-        screen_unicode_map.entries = nullptr;
       }
     }
 
@@ -531,6 +533,8 @@ int FTermLinux::getFramebuffer_bpp()
 //----------------------------------------------------------------------
 bool FTermLinux::getScreenFont()
 {
+  // Reads the console font and keeps it in a compact form
+
   struct console_font_op font{};
   int fd_tty = FTerm::getTTYFileDescriptor();
   int ret{-1};
@@ -541,17 +545,13 @@ bool FTermLinux::getScreenFont()
   // Initialize unused padding bytes in struct
   std::memset (&font, 0, sizeof(console_font_op));
 
-  font.op = KD_FONT_OP_GET;
-  font.flags = 0;
-  font.width = 32;
-  font.height = 32;
-  font.charcount = 512;
+  // The kernel reserves 32 lines per glyph
+  static constexpr std::size_t data_size = 4 * 32 * 512;
+  std::vector<uChar> font_data{};
 
-  // Initialize with 0
   try
   {
-    static constexpr std::size_t data_size = 4 * 32 * 512;
-    font.data = new uChar[data_size]();
+    font_data.resize(data_size);  // Initialize with 0
   }
   catch (const std::bad_alloc& ex)
   {
@@ -559,51 +559,76 @@ bool FTermLinux::getScreenFont()
     return false;
   }
 
+  font.op = KD_FONT_OP_GET;
+  font.flags = 0;
+  font.width = 32;
+  font.height = 32;
+  font.charcount = 512;
+  font.data = font_data.data();
+
   // Font operation
   if ( fsystem )
     ret = fsystem->ioctl (fd_tty, KDFONTOP, &font);
 
-  if ( ret != 0 )
-  {
-    if ( font.data )
-      delete[] font.data;
-
+  if ( ret != 0 || font.height > 32 || font.charcount > 512 )
     return false;
-  }
 
-  screen_font.width = font.width;
-  screen_font.height = font.height;
-  screen_font.charcount = font.charcount;
-  screen_font.data = font.data;
+  // Remove the unused lines of each glyph
+  const std::size_t bytes_per_line = (font.width + 7) / 8;
+  const std::size_t glyph_size = bytes_per_line * font.height;
+
+  for (std::size_t i{1}; i < font.charcount; i++)
+    std::memmove ( &font_data[i * glyph_size]
+                 , &font_data[i * bytes_per_line * 32]
+                 , glyph_size );
+
+  font_data.resize (glyph_size * font.charcount);
+  font_fingerprint = getFontFingerprint ( font_data.data(), font.charcount
+                                        , font.width, font.height );
+
+  // Unchanged since the last call
+  if ( font_fingerprint == saved_font.fingerprint )
+    return true;
+
+  font_data.shrink_to_fit();
+  saved_font.data = std::move(font_data);
+  saved_font.width = font.width;
+  saved_font.height = font.height;
+  saved_font.charcount = font.charcount;
+  saved_font.fingerprint = font_fingerprint;
   return true;
 }
 
 //----------------------------------------------------------------------
 bool FTermLinux::getUnicodeMap()
 {
+  // Reads the unicode-to-font mapping of the console
+
   int fd_tty = FTerm::getTTYFileDescriptor();
   int ret{-1};
 
   if ( fd_tty < 0 )
     return false;
 
-  screen_unicode_map.entry_ct = 0;
-  screen_unicode_map.entries = nullptr;
+  struct unimapdesc unimap{};
+  std::vector<unipair> entries{};
+  unimap.entry_ct = 0;
+  unimap.entries = nullptr;
 
   // Get count
   if ( fsystem )
-    ret = fsystem->ioctl (fd_tty, GIO_UNIMAP, &screen_unicode_map);
+    ret = fsystem->ioctl (fd_tty, GIO_UNIMAP, &unimap);
 
   if ( ret != 0 )
   {
-    std::size_t count = screen_unicode_map.entry_ct;
+    std::size_t count = unimap.entry_ct;
 
     if ( errno != ENOMEM || count == 0 )
       return false;
 
     try
     {
-      screen_unicode_map.entries = new struct unipair[count]();
+      entries.resize(count);
     }
     catch (const std::bad_alloc& ex)
     {
@@ -611,17 +636,38 @@ bool FTermLinux::getUnicodeMap()
       return false;
     }
 
+    unimap.entries = entries.data();
+
     // Get unicode-to-font mapping from kernel
     if ( fsystem )
-      ret = fsystem->ioctl (fd_tty, GIO_UNIMAP, &screen_unicode_map);
+      ret = fsystem->ioctl (fd_tty, GIO_UNIMAP, &unimap);
 
     if ( ret != 0 )
       return false;
   }
 
+  entries.resize (unimap.entry_ct);
+  unimap.entries = entries.data();
+  unimap_fingerprint = getUnicodeMapFingerprint(unimap);
+
+  // Unchanged since the last call
+  if ( unimap_fingerprint == saved_unicode_map.fingerprint )
+    return true;
+
+  saved_unicode_map.entries = std::move(entries);
+  saved_unicode_map.fingerprint = unimap_fingerprint;
   return true;
 }
 
+//----------------------------------------------------------------------
+struct unimapdesc FTermLinux::getSavedUnicodeMap()
+{
+  struct unimapdesc unimap{};
+  unimap.entry_ct = uInt16(saved_unicode_map.entries.size());
+  unimap.entries = saved_unicode_map.entries.data();
+  return unimap;
+}
+
 //----------------------------------------------------------------------
 FTermLinux::modifier_key& FTermLinux::getModifierKey()
 {
@@ -652,9 +698,8 @@ FTermLinux::modifier_key& FTermLinux::getModifierKey()
 }
 
 //----------------------------------------------------------------------
-int FTermLinux::setScreenFont ( uChar fontdata[], uInt count
-                              , uInt fontwidth, uInt fontheight
-                              , bool direct)
+int FTermLinux::setScreenFont ( const uChar fontdata[], uInt count
+                              , uInt fontwidth, uInt fontheight )
 {
   struct console_font_op font{};
   int fd_tty = FTerm::getTTYFileDescriptor();
@@ -663,6 +708,13 @@ int FTermLinux::setScreenFont ( uChar fontdata[], uInt count
   if ( fd_tty < 0 )
     return -1;
 
+  // The console has already loaded this font
+  const uInt64 fingerprint = getFontFingerprint ( fontdata, count
+                                                , fontwidth, fontheight );
+
+  if ( fingerprint == font_fingerprint )
+    return 0;
+
   // Initialize unused padding bytes in struct
   std::memset (&font, 0x00, sizeof(console_font_op));
 
@@ -672,46 +724,38 @@ int FTermLinux::setScreenFont ( uChar fontdata[], uInt count
   font.height = fontheight;
   font.charcount = count;
 
-  if ( direct )
-    font.data = fontdata;
-  else
+  const std::size_t bytes_per_line = (font.width + 7) / 8;
+  const std::size_t glyph_size = bytes_per_line * font.height;
+  const std::size_t data_size = bytes_per_line * 32 * font.charcount;
+  std::vector<uChar> font_data{};
+
+  try
   {
-    const std::size_t bytes_per_line = font.width / 8;
-    const std::size_t data_size = bytes_per_line * 32 * font.charcount;
+    font_data.resize(data_size);  // Initialize with 0
+  }
+  catch (const std::bad_alloc& ex)
+  {
+    std::cerr << bad_alloc_str << ex.what() << std::endl;
+    return -1;
+  }
 
-    try
-    {
-      font.data = new uChar[data_size]();  // Initialize with 0
-    }
-    catch (const std::bad_alloc& ex)
-    {
-      std::cerr << bad_alloc_str << ex.what() << std::endl;
-      return -1;
-    }
+  // The kernel expects 32 lines per glyph
+  for (std::size_t i{0}; i < count; i++)
+    std::memcpy ( &font_data[bytes_per_line * 32 * i]
+                , &fontdata[i * glyph_size]
+                , glyph_size );
 
-    for (std::size_t i{0}; i < count; i++)
-      std::memcpy ( const_cast<uChar*>(font.data + bytes_per_line * 32 * i)
-                  , &fontdata[i * font.height]
-                  , font.height);
-  }
+  font.data = font_data.data();
 
   // Font operation
   if ( fsystem )
     ret = fsystem->ioctl (fd_tty, KDFONTOP, &font);
 
-  if ( ret != 0 && errno != ENOSYS && errno != EINVAL )
-  {
-    if ( ! direct )
-      delete[] font.data;
-
-    return -1;
-  }
-
-  if ( ! direct )
-    delete[] font.data;
-
   if ( ret == 0 )
+  {
+    font_fingerprint = fingerprint;
     return 0;
+  }
   else
     return -1;
 }
@@ -726,6 +770,12 @@ int FTermLinux::setUnicodeMap (struct unimapdesc* unimap)
   if ( fd_tty < 0 )
     return -1;
 
+  // The console already uses this mapping
+  const uInt64 fingerprint = getUnicodeMapFingerprint(*unimap);
+
+  if ( fingerprint == unimap_fingerprint )
+    return 0;
+
   advice.advised_hashsize = 0;
   advice.advised_hashstep = 0;
   advice.advised_hashlevel = 0;
@@ -749,11 +799,37 @@ int FTermLinux::setUnicodeMap (struct unimapdesc* unimap)
   while ( ret != 0 && errno == ENOMEM && advice.advised_hashlevel < 100);
 
   if ( ret == 0 )
+  {
+    unimap_fingerprint = fingerprint;
     return 0;
+  }
   else
     return -1;
 }
 
+//----------------------------------------------------------------------
+void FTermLinux::setVcsaCharMap (const unimapdesc& unimap, uInt charcount)
+{
+  // Passes the glyph positions of the console font
+  // to the direct screen output
+
+  if ( ! FTermVcsa::isActive() )
+    return;
+
+  FTermVcsa::clearFontPositions();
+  FTermVcsa::setGlyphCount ( ( charcount > 0 ) ? charcount : 256 );
+
+  for (std::size_t n{0}; unimap.entries && n < unimap.entry_ct; n++)
+  {
+    FTermVcsa::setFontPosition ( wchar_t(unimap.entries[n].unicode)
+                               , unimap.entries[n].fontpos );
+  }
+
+  // Missing characters get the glyph of their substitute
+  for (auto&& sub : fterm_data->getCharSubstitutionMap())
+    FTermVcsa::setCharSubstitution (sub.first, sub.second);
+}
+
 //----------------------------------------------------------------------
 void FTermLinux::setLinuxCursorStyle (CursorStyle style)
 {
@@ -856,7 +932,7 @@ int FTermLinux::setBlinkAsIntensity (bool enable)
   int fd_tty = FTerm::getTTYFileDescriptor();
 
   // Test if the blink-bit is used by the screen font (512 characters)
-  if ( screen_font.charcount > 256 )
+  if ( saved_font.charcount > 256 )
     return -1;
 
   if ( fsystem->getuid() != 0 )  // Direct hardware access requires root privileges
@@ -984,6 +1060,10 @@ bool FTermLinux::resetVGAPalette()
 
   if ( has_saved_palette )
   {
+    // The palette has not been changed
+    if ( std::memcmp(&cmap, &saved_color_map, sizeof(cmap)) == 0 )
+      return true;
+
     if ( fsystem && fsystem->ioctl (0, PIO_CMAP, &saved_color_map) )
       return false;
   }
@@ -1308,15 +1388,51 @@ sInt16 FTermLinux::getFontPos (wchar_t ucs)
 {
   constexpr sInt16 NOT_FOUND = -1;
 
-  for (std::size_t n{0}; n < screen_unicode_map.entry_ct; n++)
+  for (auto&& entry : saved_unicode_map.entries)
   {
-    if ( screen_unicode_map.entries[n].unicode == ucs )
-      return sInt16(screen_unicode_map.entries[n].fontpos);
+    if ( entry.unicode == ucs )
+      return sInt16(entry.fontpos);
   }
 
   return NOT_FOUND;
 }
 
+//----------------------------------------------------------------------
+uInt64 FTermLinux::getFontFingerprint ( const uChar fontdata[], uInt count
+                                      , uInt fontwidth, uInt fontheight )
+{
+  // Identifies a font by its size and its glyphs
+
+  const uInt dimension[3] = { count, fontwidth, fontheight };
+  const std::size_t glyph_size = ((fontwidth + 7) / 8) * fontheight;
+  const uInt64 hash = getFingerprint (dimension, sizeof(dimension));
+  return getFingerprint (fontdata, glyph_size * count, hash);
+}
+
+//----------------------------------------------------------------------
+uInt64 FTermLinux::getUnicodeMapFingerprint (const struct unimapdesc& unimap)
+{
+  const std::size_t count = ( unimap.entries ) ? unimap.entry_ct : 0;
+  return getFingerprint (unimap.entries, count * sizeof(unipair));
+}
+
+//----------------------------------------------------------------------
+uInt64 FTermLinux::getFingerprint ( const void* data, std::size_t size
+                                  , uInt64 hash )
+{
+  // 64-bit FNV-1a hash
+
+  const auto bytes = static_cast<const uChar*>(data);
+
+  for (std::size_t i{0}; i < size; i++)
+  {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3;
+  }
+
+  return hash;
+}
+
 //----------------------------------------------------------------------
 void FTermLinux::characterFallback ( wchar_t ucs
                                    , std::vector<wchar_t> fallback )
@@ -0,0 +1,220 @@
+/***********************************************************************
+* ftermoutput.cpp - Non-blocking terminal output with back-pressure    *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+
+#include "final/ftermoutput.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr std::size_t       FTermOutput::DEFAULT_THRESHOLD;
+std::string                 FTermOutput::buffer{};
+std::vector<std::size_t>    FTermOutput::frame_starts{};
+std::size_t                 FTermOutput::offset{0};
+std::size_t                 FTermOutput::threshold{DEFAULT_THRESHOLD};
+int                         FTermOutput::fd{-1};
+bool                        FTermOutput::frame_active{false};
+
+
+//----------------------------------------------------------------------
+// class FTermOutput
+//----------------------------------------------------------------------
+
+// public methods of FTermOutput
+//----------------------------------------------------------------------
+bool FTermOutput::open (const FString& device)
+{
+  // Opens the terminal device a second time, so that the non-blocking
+  // mode does not affect stdin and stdout
+
+  if ( isActive() )
+    close();
+
+  if ( device.isEmpty() )
+    return false;
+
+  fd = ::open ( device.c_str()
+              , O_WRONLY | O_NOCTTY | O_NONBLOCK | O_CLOEXEC );
+  return ( fd >= 0 );
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::close()
+{
+  // Sends the remaining output before closing
+
+  if ( fd >= 0 )
+  {
+    drain();
+    ::close (fd);
+  }
+
+  fd = -1;
+  buffer.clear();
+  frame_starts.clear();
+  offset = 0;
+  frame_active = false;
+}
+
+//----------------------------------------------------------------------
+int FTermOutput::putchar (int c)
+{
+  // Data outside of a frame must not be discarded
+  if ( ! frame_active && ! frame_starts.empty() )
+    frame_starts.clear();
+
+  buffer.push_back (char(c));
+  return int(uChar(c));
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::beginFrame()
+{
+  // Marks the start of a screen update
+
+  if ( ! isActive() )
+    return;
+
+  frame_starts.push_back (buffer.size());
+  frame_active = true;
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::endFrame()
+{
+  frame_active = false;
+}
+
+//----------------------------------------------------------------------
+bool FTermOutput::write()
+{
+  // Writes as much of the pending data as the terminal accepts
+  // without blocking. Returns true if nothing remains.
+
+  if ( fd < 0 )
+    return ! hasPendingData();
+
+  while ( hasPendingData() )
+  {
+    const ssize_t bytes = ::write ( fd, buffer.data() + offset
+                                  , getPendingSize() );
+
+    if ( bytes < 0 && errno == EINTR )
+      continue;
+
+    if ( bytes < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+      break;
+
+    if ( bytes <= 0 )
+    {
+      // The terminal is gone: drop the output
+      offset = buffer.size();
+      break;
+    }
+
+    offset += std::size_t(bytes);
+  }
+
+  compact();
+  return ! hasPendingData();
+}
+
+//----------------------------------------------------------------------
+bool FTermOutput::drain()
+{
+  // Waits until all pending data is written
+
+  if ( fd < 0 )
+    return ! hasPendingData();
+
+  while ( ! write() )
+  {
+    struct pollfd pfd{};
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+
+    if ( poll(&pfd, 1, -1) < 0 && errno != EINTR )
+      return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+bool FTermOutput::discardFrames()
+{
+  // Removes all frames of which nothing has been written yet.
+  // A frame that has already been started is always completed.
+
+  if ( frame_active )
+    return false;
+
+  const auto iter = std::lower_bound ( frame_starts.begin()
+                                     , frame_starts.end()
+                                     , offset );
+
+  if ( iter == frame_starts.end() )
+    return false;
+
+  buffer.resize (*iter);
+  frame_starts.erase (iter, frame_starts.end());
+  return true;
+}
+
+
+// private methods of FTermOutput
+//----------------------------------------------------------------------
+void FTermOutput::compact()
+{
+  // Removes the written data from the front of the buffer
+
+  if ( offset == buffer.size() )
+  {
+    buffer.clear();
+    frame_starts.clear();
+    offset = 0;
+    return;
+  }
+
+  if ( offset < buffer.size() / 2 )
+    return;
+
+  const auto iter = std::lower_bound ( frame_starts.begin()
+                                     , frame_starts.end()
+                                     , offset );
+  frame_starts.erase (frame_starts.begin(), iter);
+
+  for (auto&& start : frame_starts)
+    start -= offset;
+
+  buffer.erase (0, offset);
+  offset = 0;
+}
+
+}  // namespace finalcut
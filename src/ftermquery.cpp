@@ -0,0 +1,276 @@
+/***********************************************************************
+* ftermquery.cpp - Pipelined terminal queries                          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#if defined(__CYGWIN__)
+  #include <sys/select.h>  // need for FD_ZERO, FD_SET, FD_CLR, ...
+#endif
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "final/fc.h"
+#include "final/ftermios.h"
+#include "final/ftermoutput.h"
+#include "final/ftermquery.h"
+#include "final/fobject.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr std::size_t      FTermQuery::MAX_REPLY_LENGTH;
+std::string                FTermQuery::answerback{};
+std::string                FTermQuery::reply{};
+std::vector<std::string>   FTermQuery::replies{};
+FTermQuery::parser_state   FTermQuery::state{FTermQuery::text_state};
+bool                       FTermQuery::sentinel_reply{false};
+
+
+//----------------------------------------------------------------------
+// class FTermQuery
+//----------------------------------------------------------------------
+
+// public methods of FTermQuery
+//----------------------------------------------------------------------
+const FString FTermQuery::getOSCString (const FString& prefix)
+{
+  // Returns the text of the operating system command reply
+  // that begins with prefix (without prefix and string terminator)
+
+  const std::string pre(prefix.c_str());
+
+  for (auto&& osc : replies)
+  {
+    if ( osc.compare(0, 2, OSC) != 0 )
+      continue;
+
+    std::string text(osc.substr(2));
+
+    if ( ! text.empty() && text.back() == BEL[0] )
+      text.erase(text.length() - 1);
+    else if ( text.length() >= 2
+           && text.compare(text.length() - 2, 2, ESC "\\") == 0 )
+      text.erase(text.length() - 2);
+
+    if ( text.compare(0, pre.length(), pre) == 0 )
+      return FString(text.substr(pre.length()));
+  }
+
+  return FString{};
+}
+
+//----------------------------------------------------------------------
+void FTermQuery::sendSentinel()
+{
+  // Primary device attributes (DA1)
+  std::fputs (CSI "c", stdout);
+}
+
+//----------------------------------------------------------------------
+bool FTermQuery::readReplies (uInt64 timeout)
+{
+  // Reads and splits the terminal replies until the sentinel
+  // has arrived or the timeout (in microseconds) has expired
+
+  const int stdin_no = FTermios::getStdIn();
+  char buffer[512]{};
+  timeval start{};
+  std::fflush(stdout);
+  FTermOutput::drain();  // The query must reach the terminal
+  FObject::getCurrentTime (&start);
+
+  while ( ! sentinel_reply )
+  {
+    timeval now{};
+    FObject::getCurrentTime (&now);
+    const timeval diff = now - start;
+    const uInt64 elapsed = uInt64(diff.tv_sec) * 1000000
+                         + uInt64(diff.tv_usec);
+
+    if ( now < start || elapsed >= timeout )
+      break;
+
+    const uInt64 remaining = timeout - elapsed;
+    fd_set ifds{};
+    struct timeval tv{};
+    FD_ZERO(&ifds);
+    FD_SET(stdin_no, &ifds);
+    tv.tv_sec  = time_t(remaining / 1000000);
+    tv.tv_usec = suseconds_t(remaining % 1000000);
+
+    if ( select (stdin_no + 1, &ifds, 0, 0, &tv) <= 0 )
+      break;
+
+    const ssize_t bytes = read (stdin_no, buffer, sizeof(buffer));
+
+    if ( bytes <= 0 )
+      break;
+
+    for (ssize_t i{0}; i < bytes; i++)
+      parse (buffer[i]);
+  }
+
+  if ( ! sentinel_reply )
+    return false;
+
+  // Some terminals answer a query with a DA1 reply, so the real
+  // sentinel reply can follow directly afterwards
+  fd_set ifds{};
+  struct timeval tv{};
+  FD_ZERO(&ifds);
+  FD_SET(stdin_no, &ifds);
+
+  if ( select (stdin_no + 1, &ifds, 0, 0, &tv) > 0 )
+  {
+    const ssize_t bytes = read (stdin_no, buffer, sizeof(buffer));
+
+    for (ssize_t i{0}; i < bytes; i++)
+      parse (buffer[i]);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTermQuery::clear()
+{
+  answerback.clear();
+  reply.clear();
+  replies.clear();
+  state = text_state;
+  sentinel_reply = false;
+}
+
+
+// private methods of FTermQuery
+//----------------------------------------------------------------------
+void FTermQuery::parse (char c)
+{
+  // State machine for splitting the terminal replies
+
+  if ( reply.length() >= MAX_REPLY_LENGTH )  // Discards oversized replies
+  {
+    reply.clear();
+    state = text_state;
+  }
+
+  switch ( state )
+  {
+    case text_state:
+      if ( c == ESC[0] )
+      {
+        reply = ESC;
+        state = esc_state;
+      }
+      else if ( answerback.length() < MAX_REPLY_LENGTH )
+        answerback.push_back(c);
+
+      break;
+
+    case esc_state:
+      reply.push_back(c);
+
+      if ( c == '[' )
+        state = csi_state;
+      else if ( c == ']' )
+        state = osc_state;
+      else
+      {
+        reply.clear();
+        state = text_state;
+      }
+
+      break;
+
+    case csi_state:
+      reply.push_back(c);
+
+      if ( c >= '@' && c <= '~' )  // Final byte
+        finishReply();
+
+      break;
+
+    case osc_state:
+      if ( c == ESC[0] )
+        state = osc_esc_state;
+      else
+      {
+        reply.push_back(c);
+
+        if ( c == BEL[0] )
+          finishReply();
+      }
+
+      break;
+
+    case osc_esc_state:
+      if ( c == '\\' )  // String terminator
+      {
+        reply.append(ESC "\\");
+        finishReply();
+      }
+      else  // Unterminated string: ESC starts a new reply
+      {
+        reply = ESC;
+        state = esc_state;
+        parse (c);
+      }
+
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermQuery::finishReply()
+{
+  replies.push_back(reply);
+
+  // CSI ? ... c is the sentinel reply
+  if ( reply.length() > 3 && reply[2] == '?' && reply.back() == 'c' )
+    sentinel_reply = true;
+
+  reply.clear();
+  state = text_state;
+}
+
+//----------------------------------------------------------------------
+const FString FTermQuery::getCSIReply (char marker, char final_byte)
+{
+  // Returns the first control sequence reply of the form
+  // CSI <marker> ... <final_byte>
+
+  for (auto&& csi : replies)
+  {
+    if ( csi.length() > 3
+      && csi.compare(0, 2, CSI) == 0
+      && csi[2] == marker
+      && csi.back() == final_byte )
+      return FString(csi);
+  }
+
+  return FString{};
+}
+
+}  // namespace finalcut
@@ -0,0 +1,285 @@
+/***********************************************************************
+* ftermvcsa.cpp - Direct screen output into a Linux /dev/vcsa device   *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "final/fcharmap.h"
+#include "final/fglyphstore.h"
+#include "final/ftermvcsa.h"
+#include "final/ftruecolor.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr std::size_t                FTermVcsa::HEADER_SIZE;
+constexpr std::size_t                FTermVcsa::CELL_SIZE;
+std::unordered_map<wchar_t, uInt16>  FTermVcsa::font_positions{};
+std::vector<uInt8>                   FTermVcsa::buffer{};
+std::size_t                          FTermVcsa::console_columns{0};
+std::size_t                          FTermVcsa::console_lines{0};
+std::size_t                          FTermVcsa::glyph_count{256};
+int                                  FTermVcsa::max_color{16};
+int                                  FTermVcsa::fd{-1};
+
+
+//----------------------------------------------------------------------
+// class FTermVcsa
+//----------------------------------------------------------------------
+
+// public methods of FTermVcsa
+//----------------------------------------------------------------------
+const FString FTermVcsa::getDevicePath (const char termfilename[])
+{
+  // Returns the vcsa device of a virtual console (/dev/ttyN)
+
+  constexpr char tty_prefix[] = "/dev/tty";
+  constexpr std::size_t prefix_length = sizeof(tty_prefix) - 1;
+
+  if ( ! termfilename
+    || std::strncmp(termfilename, tty_prefix, prefix_length) != 0 )
+    return FString();
+
+  const char* number = termfilename + prefix_length;
+  const std::size_t length = std::strlen(number);
+
+  if ( length == 0
+    || std::strspn(number, "0123456789") != length )
+    return FString();
+
+  return FString("/dev/vcsa") + number;
+}
+
+//----------------------------------------------------------------------
+void FTermVcsa::setCharSubstitution (wchar_t from, wchar_t to)
+{
+  // A character without a glyph uses the glyph of its substitute
+
+  if ( font_positions.find(from) != font_positions.end() )
+    return;
+
+  const auto iter = font_positions.find(to);
+
+  if ( iter != font_positions.end() )
+    font_positions.emplace (from, iter->second);
+}
+
+//----------------------------------------------------------------------
+bool FTermVcsa::open (const FString& device)
+{
+  // Opens the vcsa device or a regular file with the same layout
+
+  if ( isActive() )
+    close();
+
+  if ( device.isEmpty() )
+    return false;
+
+  fd = ::open (device.c_str(), O_RDWR | O_CLOEXEC);
+
+  if ( fd < 0 )
+    return false;
+
+  if ( ! readHeader() )
+  {
+    close();
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTermVcsa::close()
+{
+  if ( fd >= 0 )
+    ::close (fd);
+
+  fd = -1;
+  console_columns = 0;
+  console_lines = 0;
+  buffer.clear();
+}
+
+//----------------------------------------------------------------------
+bool FTermVcsa::readHeader()
+{
+  // Gets the current console size from the header
+
+  uInt8 header[HEADER_SIZE]{};
+
+  if ( fd < 0
+    || pread(fd, header, HEADER_SIZE, 0) != ssize_t(HEADER_SIZE) )
+    return false;
+
+  console_lines = header[0];
+  console_columns = header[1];
+  return console_lines > 0 && console_columns > 0;
+}
+
+//----------------------------------------------------------------------
+bool FTermVcsa::write ( std::size_t x, std::size_t y
+                      , const FChar cells[], std::size_t count )
+{
+  // Writes count character cells with a single pwrite
+  // to the screen position (x, y)
+
+  if ( fd < 0 || y >= console_lines || x >= console_columns )
+    return false;
+
+  count = std::min (count, console_columns - x);
+  buffer.resize (count * CELL_SIZE);
+
+  for (std::size_t i{0}; i < count; i++)
+  {
+    const uInt16 cell = encode(cells[i]);
+    buffer[i * CELL_SIZE] = uInt8(cell & 0xff);  // Font position
+    buffer[i * CELL_SIZE + 1] = uInt8(cell >> 8);  // Attribute
+  }
+
+  const std::size_t cell_index = y * console_columns + x;
+  const off_t offset = off_t(HEADER_SIZE + cell_index * CELL_SIZE);
+  std::size_t written{0};
+
+  while ( written < buffer.size() )
+  {
+    const ssize_t bytes = pwrite ( fd, buffer.data() + written
+                                 , buffer.size() - written
+                                 , offset + off_t(written) );
+
+    if ( bytes < 0 && errno == EINTR )
+      continue;
+
+    if ( bytes <= 0 )
+      return false;
+
+    written += std::size_t(bytes);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+uInt16 FTermVcsa::encode (const FChar& fchar)
+{
+  // Returns the attribute byte (high byte) and the
+  // font position (low byte) of a character cell
+
+  wchar_t ch = fchar.ch;
+
+  if ( fchar.attr.bit.fullwidth_padding || ch == L'\0' )
+    ch = L' ';
+  else if ( FGlyphStore::isCluster(ch) )
+    ch = FGlyphStore::getBaseCharacter(ch);
+
+  const uInt16 fontpos = getFontPos(ch);
+  const FColor fg_color = ( fchar.fg_color == fc::Default )
+                          ? FColor(fc::LightGray) : fchar.fg_color;
+  const FColor bg_color = ( fchar.bg_color == fc::Default )
+                          ? FColor(fc::Black) : fchar.bg_color;
+  uInt8 fg = getVGAColor(fg_color);
+  uInt8 bg = getVGAColor(bg_color);
+
+  if ( fchar.attr.bit.reverse || fchar.attr.bit.standout )
+    std::swap (fg, bg);
+
+  if ( fchar.attr.bit.bold )
+    fg |= 0x08;
+
+  if ( fchar.attr.bit.dim )
+    fg = ( fg & 0x08 ) ? uInt8(fg & 0x07) : uInt8(fc::DarkGray);
+
+  if ( fchar.attr.bit.invisible )
+    fg = bg;
+
+  // Without 16 background colors, bit 7 lets the character blink
+  if ( max_color < 16 )
+    bg = uInt8(( bg & 0x07 ) | ( fchar.attr.bit.blink ? 0x08 : 0x00 ));
+
+  // A font with 512 glyphs uses the intensity bit as 9th glyph bit
+  if ( glyph_count > 256 )
+    fg = uInt8((fg & 0x07) | ((fontpos & 0x100) >> 5));
+
+  const uInt8 attribute = uInt8((bg << 4) | fg);
+  return uInt16((attribute << 8) | (fontpos & 0xff));
+}
+
+
+// private methods of FTermVcsa
+//----------------------------------------------------------------------
+uInt16 FTermVcsa::getFontPos (wchar_t ucs)
+{
+  // Returns the glyph position of a character in the console font
+
+  if ( font_positions.empty() )
+  {
+    // Without a unicode map, a cp437 font is assumed
+    if ( ucs < 0x80 )
+      return uInt16(ucs);
+
+    const int item = fc::getCP437UnicodeItem(ucs);
+
+    if ( item >= 0 )
+      return uInt16(fc::cp437_ucs[item][0]);
+
+    return uInt16('?');
+  }
+
+  auto iter = font_positions.find(ucs);
+
+  if ( iter != font_positions.end() )
+    return iter->second;
+
+  // Like the kernel, use the replacement character or a question mark
+  iter = font_positions.find(L'\xfffd');
+
+  if ( iter == font_positions.end() )
+    iter = font_positions.find(L'?');
+
+  if ( iter != font_positions.end() )
+    return iter->second;
+
+  return uInt16('?');
+}
+
+//----------------------------------------------------------------------
+uInt8 FTermVcsa::getVGAColor (FColor color)
+{
+  // The VGA attribute byte holds the first 16 colors (in VGA order)
+
+  if ( color < 16 )
+    return uInt8(color);
+
+  // Palette and direct colors get the nearest of the 16 colors
+  const uInt rgb = FTrueColor::getRGB(color);
+  return uInt8(FTrueColor::quantize ( uInt8(rgb >> 16)
+                                    , uInt8(rgb >> 8)
+                                    , uInt8(rgb), 16 ));
+}
+
+}  // namespace finalcut
@@ -31,6 +31,7 @@
 #include "final/ftermdetection.h"
 #include "final/ftermfreebsd.h"
 #include "final/ftermios.h"
+#include "final/ftermquery.h"
 #include "final/ftermxterminal.h"
 #include "final/fsize.h"
 
@@ -285,6 +286,16 @@ void FTermXTerminal::captureFontAndTitle()
     && ! term_detection->isRxvtTerminal() )
   {
     FTermios::setCaptureSendCharacters();
+
+    // Requests font and title in one batch
+    FTermQuery::clear();
+    requestXTermFont();
+    requestXTermTitle();
+    oscPrefix();
+    FTermQuery::sendSentinel();
+    oscPostfix();
+    FTermQuery::readReplies (150000);  // 150 ms
+
     xterm_font  = captureXTermFont();
     xterm_title = captureXTermTitle();
     FTermios::unsetCaptureSendCharacters();
@@ -683,87 +694,39 @@ void FTermXTerminal::oscPostfix()
 }
 
 //----------------------------------------------------------------------
-const FString FTermXTerminal::captureXTermFont()
+void FTermXTerminal::requestXTermFont()
 {
   if ( term_detection->isXTerminal()
     || term_detection->isScreenTerm()
     || FTermcap::osc_support )
   {
-    fd_set ifds{};
-    struct timeval tv{};
-    int stdin_no = FTermios::getStdIn();
-
     oscPrefix();
     FTerm::putstring (OSC "50;?" BEL);  // get font
     oscPostfix();
-    std::fflush(stdout);
-
-    FD_ZERO(&ifds);
-    FD_SET(stdin_no, &ifds);
-    tv.tv_sec  = 0;
-    tv.tv_usec = 150000;  // 150 ms
-
-    // Read the terminal answer
-    if ( select(stdin_no + 1, &ifds, 0, 0, &tv) > 0 )
-    {
-      char temp[150]{};
-
-      if ( std::scanf("\033]50;%148[^\n]s", temp) == 1 )
-      {
-        std::size_t n = std::strlen(temp);
-
-        // BEL + '\0' = string terminator
-        if ( n >= 5 && temp[n - 1] == BEL[0] && temp[n] == '\0' )
-          temp[n - 1] = '\0';
-
-        return FString(temp);
-      }
-    }
   }
-
-  return FString{};
 }
 
 //----------------------------------------------------------------------
-const FString FTermXTerminal::captureXTermTitle()
+void FTermXTerminal::requestXTermTitle()
 {
   if ( term_detection->isKdeTerminal() )
-    return FString{};
-
-  fd_set ifds{};
-  struct timeval tv{};
-  int stdin_no = FTermios::getStdIn();
+    return;
 
   FTerm::putstring (CSI "21t");  // get title
-  std::fflush(stdout);
-
-  FD_ZERO(&ifds);
-  FD_SET(stdin_no, &ifds);
-  tv.tv_sec  = 0;
-  tv.tv_usec = 150000;  // 150 ms
+}
 
-  // read the terminal answer
-  if ( select (stdin_no + 1, &ifds, 0, 0, &tv) > 0 )
-  {
-    char temp[512]{};
-
-    if ( std::scanf("\033]l%509[^\n]s", temp) == 1 )
-    {
-      std::size_t n = std::strlen(temp);
-
-      // Esc + \ = OSC string terminator
-      if ( n >= 2 && temp[n - 2] == ESC[0] && temp[n - 1] == '\\' )
-      {
-        if ( n < 4 )
-          return FString{};
-
-        temp[n - 2] = '\0';
-        return FString{temp};
-      }
-    }
-  }
+//----------------------------------------------------------------------
+const FString FTermXTerminal::captureXTermFont()
+{
+  // Returns the reply to the font query (OSC 50)
+  return FTermQuery::getOSCString("50;");
+}
 
-  return FString{};
+//----------------------------------------------------------------------
+const FString FTermXTerminal::captureXTermTitle()
+{
+  // Returns the reply to the title query (CSI 21 t)
+  return FTermQuery::getOSCString("l");
 }
 
 //----------------------------------------------------------------------
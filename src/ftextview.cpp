@@ -21,11 +21,13 @@
 ***********************************************************************/
 
 #include <memory>
+#include <string>
 
 #include "final/fapplication.h"
 #include "final/fc.h"
 #include "final/fdialog.h"
 #include "final/fevent.h"
+#include "final/fglyphstore.h"
 #include "final/fstring.h"
 #include "final/fscrollbar.h"
 #include "final/fstatusbar.h"
@@ -56,29 +58,30 @@ FTextView::~FTextView()  // destructor
 //----------------------------------------------------------------------
 const FString FTextView::getText() const
 {
-  if ( data.empty() )
+  if ( getRows() == 0 )
     return FString("");
 
+  const auto& lines = getLines();
   std::size_t len{0};
 
-  for (auto&& line : data)
+  for (auto&& line : lines)
     len += line.getLength() + 1;  // String length + '\n'
 
   FString s(len);  // Reserves storage
-  auto iter = s.begin();
+  std::size_t pos{0};
 
-  for (auto&& line : data)
+  for (auto&& line : lines)
   {
     if ( ! line.isEmpty() )
     {
-      if ( iter != s.begin() )
+      if ( pos > 0 )
       {
-        *iter = '\n';
-        ++iter;
+        s.overwrite (L'\n', pos);
+        pos++;
       }
 
-      std::copy (line.begin(), line.end(), iter);
-      iter += std::distance(line.begin(), line.end());
+      s.overwrite (line, pos);
+      pos += line.getLength();
     }
   }
 
@@ -109,18 +112,43 @@ void FTextView::setText (const FString& str)
 {
   clear();
   insert(str, -1);
+  invalidate();
+}
+
+//----------------------------------------------------------------------
+void FTextView::setMaxLines (std::size_t max)
+{
+  // Limits the scrollback to the last max lines (0 = unlimited)
+
+  max_lines = max;
+  evictLines();
+  updateVerticalScrollBar();
+
+  if ( ! isShown() )
+    return;
+
+  // The trimmed lines leave the view without an update of the text
+  drawText();
+
+  if ( vbar->isShown() )
+    vbar->drawBar();
+
+  updateTerminal();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
 void FTextView::scrollToX (int x)
 {
   scrollTo (x, yoffset);
+  invalidate();
 }
 
 //----------------------------------------------------------------------
 void FTextView::scrollToY (int y)
 {
   scrollTo (xoffset, y);
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -199,6 +227,12 @@ void FTextView::insert (const FString& str, int pos)
   if ( pos < 0 || pos >= int(getRows()) )
     pos = int(getRows());
 
+  // In follow mode, text appended at the end keeps
+  // the view at the bottom if it was there before
+  bool follow = follow_mode
+             && pos == int(getRows())
+             && isScrolledToBottom();
+
   if ( str.isEmpty() )
     s = "\n";
   else
@@ -234,22 +268,21 @@ void FTextView::insert (const FString& str, int pos)
     }
   }
 
-  auto iter = data.begin();
+  auto iter = data.begin() + int(first_line);
   data.insert (iter + pos, text_split.begin(), text_split.end());
+  evictLines();
   int vmax = ( getRows() > getTextHeight() )
              ? int(getRows()) - int(getTextHeight())
              : 0;
-  vbar->setMaximum (vmax);
-  vbar->setPageSize (int(getRows()), int(getTextHeight()));
-  vbar->calculateSliderValues();
 
-  if ( isShown() && ! vbar->isShown() && isVerticallyScrollable() )
-    vbar->show();
-
-  if ( isShown() && vbar->isShown() && ! isVerticallyScrollable() )
-    vbar->hide();
+  // A burst of appends results in a single offset change, which
+  // is drawn with the next redraw of the text
+  if ( follow )
+    yoffset = vmax;
 
+  updateVerticalScrollBar();
   processChanged();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -258,11 +291,13 @@ void FTextView::replaceRange (const FString& str, int from, int to)
   if ( from > to || from >= int(getRows()) || to >= int(getRows()) )
     return;
 
-  auto iter = data.begin();
+  auto iter = data.begin() + int(first_line);
   data.erase (iter + from, iter + to + 1);
 
   if ( ! str.isNull() )
     insert(str, from);
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -270,8 +305,10 @@ void FTextView::clear()
 {
   data.clear();
   data.shrink_to_fit();
+  first_line = 0;
   xoffset = 0;
   yoffset = 0;
+  last_yoffset = -1;
   maxLineWidth = 0;
 
   vbar->setMinimum(0);
@@ -309,6 +346,7 @@ void FTextView::clear()
 
   updateTerminal();
   processChanged();
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -639,7 +677,7 @@ void FTextView::drawScrollbars()
 //----------------------------------------------------------------------
 void FTextView::drawText()
 {
-  if ( data.empty() || getHeight() <= 2 || getWidth() <= 2 )
+  if ( getRows() == 0 || getHeight() <= 2 || getWidth() <= 2 )
     return;
 
   auto num = getTextHeight();
@@ -647,6 +685,22 @@ void FTextView::drawText()
   if ( num > getRows() )
     num = getRows();
 
+  if ( last_yoffset >= 0 && num == getTextHeight() )
+  {
+    // speed up: let the terminal scroll the unchanged lines
+    int distance = int(evicted_lines - last_evicted_lines)
+                 + yoffset - last_yoffset;
+    FRect box ( FPoint(getTermX() + 1, getTermY() + 1 - nf_offset)
+              , FSize(getTextWidth(), num) );
+
+    if ( distance > 0 )
+      scrollAreaForward (getPrintArea(), box, std::size_t(distance));
+    else if ( distance < 0 )
+      scrollAreaReverse (getPrintArea(), box, std::size_t(-distance));
+  }
+
+  last_yoffset = yoffset;
+  last_evicted_lines = evicted_lines;
   setColor();
 
   if ( isMonochron() )
@@ -654,24 +708,26 @@ void FTextView::drawText()
 
   for (std::size_t y{0}; y < num; y++)  // Line loop
   {
-    std::size_t n = std::size_t(yoffset) + y;
+    std::size_t n = first_line + std::size_t(yoffset) + y;
     std::size_t pos = std::size_t(xoffset) + 1;
     std::size_t trailing_whitespace{0};
     auto text_width = getTextWidth();
-    FString line(getColumnSubString(data[n], pos, text_width));
+    const FString line(getColumnSubString(data[n], pos, text_width));
     auto column_width = getColumnWidth(line);
+    std::wstring text{};
+    text.reserve(line.getLength());
     print() << FPoint(2, 2 - nf_offset + int(y));
 
     for (auto&& ch : line)  // Column loop
     {
-      if ( getColumnWidth(ch) == 0 )
-        continue;
-      else if ( isPrintable(ch) )
-        print (ch);
-      else
-        print ('.');
+      if ( getColumnWidth(ch) > 0 )
+        text.push_back(( isPrintable(ch) ) ? ch : L'.');
+      else if ( FGlyphStore::isExtendingCharacter(ch) )
+        text.push_back(ch);  // Combines with the previous character
     }
 
+    print (text);
+
     if ( column_width <= text_width )
       trailing_whitespace = text_width - column_width;
 
@@ -716,6 +772,64 @@ inline bool FTextView::isPrintable (wchar_t ch)
   return false;
 }
 
+//----------------------------------------------------------------------
+void FTextView::evictLines()
+{
+  // Discards the oldest lines beyond the scrollback limit
+
+  if ( max_lines == 0 || getRows() <= max_lines )
+    return;
+
+  std::size_t excess = getRows() - max_lines;
+
+  // The evicted lines are released immediately, but their slots
+  // stay in front of the list until a compaction is worthwhile
+  for (std::size_t n{first_line}; n < first_line + excess; n++)
+    data[n].clear();
+
+  first_line += excess;
+  evicted_lines += excess;
+
+  // Keep the same text in view while the user scrolls back
+  yoffset -= int(excess);
+
+  if ( yoffset < 0 )
+    yoffset = 0;
+
+  // Compaction after max_lines evictions keeps the cost per line constant
+  if ( first_line >= max_lines )
+    compactLines();
+}
+
+//----------------------------------------------------------------------
+void FTextView::compactLines() const
+{
+  if ( first_line == 0 )
+    return;
+
+  auto iter = data.begin();
+  data.erase (iter, iter + int(first_line));
+  first_line = 0;
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateVerticalScrollBar()
+{
+  int vmax = ( getRows() > getTextHeight() )
+             ? int(getRows()) - int(getTextHeight())
+             : 0;
+  vbar->setMaximum (vmax);
+  vbar->setPageSize (int(getRows()), int(getTextHeight()));
+  vbar->setValue (yoffset);
+  vbar->calculateSliderValues();
+
+  if ( isShown() && ! vbar->isShown() && isVerticallyScrollable() )
+    vbar->show();
+
+  if ( isShown() && vbar->isShown() && ! isVerticallyScrollable() )
+    vbar->hide();
+}
+
 //----------------------------------------------------------------------
 void FTextView::processChanged()
 {
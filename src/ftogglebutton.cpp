@@ -184,6 +184,7 @@ bool FToggleButton::setChecked (bool enable)
     processToggle();
   }
 
+  invalidate();
   return checked;
 }
 
@@ -200,6 +201,8 @@ void FToggleButton::setText (const FString& txt)
     delAccelerator();
     setHotkeyAccelerator();
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -520,7 +523,7 @@ void FToggleButton::init()
 }
 
 //----------------------------------------------------------------------
-void FToggleButton::drawText (FString&& label_text, std::size_t hotkeypos)
+void FToggleButton::drawText (const FString& label_text, std::size_t hotkeypos)
 {
   if ( isMonochron() )
     setReverse(true);
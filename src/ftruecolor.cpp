@@ -0,0 +1,305 @@
+/***********************************************************************
+* ftruecolor.cpp - Direct colors and their palette approximation       *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <limits>
+#include <utility>
+
+#include "final/ftruecolor.h"
+
+namespace finalcut
+{
+
+// static class attributes
+constexpr uInt                   FTrueColor::FIRST_ID;
+constexpr uInt                   FTrueColor::MAX_COUNT;
+constexpr int                    FTrueColor::LEVEL_BITS;
+constexpr uInt8                  FTrueColor::FREE;
+constexpr uInt8                  FTrueColor::UNMARKED;
+constexpr uInt8                  FTrueColor::MARKED;
+FTrueColor::FColorStorage        FTrueColor::storage{};
+std::vector<uInt8>               FTrueColor::lookup_table{};
+int                              FTrueColor::table_colors{0};
+bool                             FTrueColor::perceptual{false};
+
+
+//----------------------------------------------------------------------
+// class FTrueColor
+//----------------------------------------------------------------------
+
+// public methods of FTrueColor
+//----------------------------------------------------------------------
+uInt FTrueColor::getRGB (FColor color)
+{
+  // Returns the color as 0xRRGGBB value
+
+  if ( color == fc::Default )
+    return 0;
+
+  if ( ! isDirectColor(color) )
+    return getPaletteRGB(color);
+
+  const std::size_t index = color - FIRST_ID;
+
+  if ( index >= storage.entries.size() || storage.state[index] == FREE )
+    return 0;
+
+  return storage.entries[index];
+}
+
+//----------------------------------------------------------------------
+void FTrueColor::setPerceptual (bool enable)
+{
+  // Weights the color distance by the sensitivity of the human eye
+
+  if ( perceptual == enable )
+    return;
+
+  perceptual = enable;
+  table_colors = 0;  // Rebuild the lookup table on the next use
+}
+
+//----------------------------------------------------------------------
+FColor FTrueColor::rgb (uInt8 r, uInt8 g, uInt8 b)
+{
+  // Returns the color number of the direct color r, g, b
+
+  const uInt value = (uInt(r) << 16) | (uInt(g) << 8) | uInt(b);
+  const auto iter = storage.lookup.find(value);
+
+  if ( iter != storage.lookup.end() )
+    return iter->second;
+
+  FColor color{};
+
+  if ( ! storage.free_ids.empty() )  // Reuse a released color number
+  {
+    color = storage.free_ids.back();
+    storage.free_ids.pop_back();
+    const std::size_t index = color - FIRST_ID;
+    storage.entries[index] = value;
+    storage.state[index] = UNMARKED;
+  }
+  else if ( storage.entries.size() < MAX_COUNT )
+  {
+    color = FColor(FIRST_ID + storage.entries.size());
+    storage.entries.push_back(value);
+    storage.state.push_back(UNMARKED);
+  }
+  else  // All color numbers are in use
+    return quantize (r, g, b, 256);
+
+  storage.lookup.insert ({value, color});
+  return color;
+}
+
+//----------------------------------------------------------------------
+FColor FTrueColor::quantize (uInt8 r, uInt8 g, uInt8 b, int max_color)
+{
+  // Returns the nearest color of a terminal with max_color colors
+
+  int colors{8};
+
+  if ( max_color >= 256 )
+    colors = 256;
+  else if ( max_color >= 16 )
+    colors = 16;
+
+  if ( table_colors != colors )
+    buildLookupTable (colors);
+
+  constexpr int shift = 8 - LEVEL_BITS;
+  const std::size_t index = ( std::size_t(r >> shift) << (2 * LEVEL_BITS) )
+                          | ( std::size_t(g >> shift) << LEVEL_BITS )
+                          | std::size_t(b >> shift);
+  return FColor(lookup_table[index]);
+}
+
+//----------------------------------------------------------------------
+FColor FTrueColor::quantize (FColor color, int max_color)
+{
+  if ( ! isDirectColor(color) )
+    return color;
+
+  return quantize ( getRed(color), getGreen(color)
+                  , getBlue(color), max_color );
+}
+
+//----------------------------------------------------------------------
+void FTrueColor::startSweep()
+{
+  // Color numbers that are still in use must be
+  // marked with mark() before finishSweep() is called
+
+  for (auto&& state : storage.state)
+  {
+    if ( state == MARKED )
+      state = UNMARKED;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTrueColor::mark (FColor color)
+{
+  if ( ! isDirectColor(color) )
+    return;
+
+  const std::size_t index = color - FIRST_ID;
+
+  if ( index < storage.state.size() && storage.state[index] == UNMARKED )
+    storage.state[index] = MARKED;
+}
+
+//----------------------------------------------------------------------
+std::size_t FTrueColor::finishSweep()
+{
+  // Releases all unmarked color numbers and returns their count
+
+  std::size_t released{0};
+
+  for (std::size_t index{0}; index < storage.state.size(); index++)
+  {
+    if ( storage.state[index] != UNMARKED )
+      continue;
+
+    storage.lookup.erase(storage.entries[index]);
+    storage.state[index] = FREE;
+    storage.free_ids.push_back(FColor(FIRST_ID + index));
+    released++;
+  }
+
+  return released;
+}
+
+//----------------------------------------------------------------------
+void FTrueColor::clear()
+{
+  storage = FColorStorage{};
+}
+
+
+// private methods of FTrueColor
+//----------------------------------------------------------------------
+void FTrueColor::buildLookupTable (int colors)
+{
+  // Precomputes the nearest palette color for each cell
+  // of a 32 x 32 x 32 RGB cube
+
+  constexpr int levels = 1 << LEVEL_BITS;
+  constexpr int shift = 8 - LEVEL_BITS;
+  constexpr uInt center = 1 << (shift - 1);
+
+  // The first 16 colors of a 256-color terminal could be redefined
+  const FColor first = ( colors == 256 ) ? 16 : 0;
+  lookup_table.resize (std::size_t(levels * levels * levels));
+  std::size_t index{0};
+
+  for (int r{0}; r < levels; r++)
+  {
+    for (int g{0}; g < levels; g++)
+    {
+      for (int b{0}; b < levels; b++)
+      {
+        const uInt value = ((uInt(r << shift) | center) << 16)
+                         | ((uInt(g << shift) | center) << 8)
+                         | (uInt(b << shift) | center);
+        uInt min_distance = std::numeric_limits<uInt>::max();
+        FColor nearest{first};
+
+        for (FColor color = first; color < FColor(colors); color++)
+        {
+          const uInt distance = getDistance(value, getPaletteRGB(color));
+
+          if ( distance < min_distance )
+          {
+            min_distance = distance;
+            nearest = color;
+          }
+        }
+
+        lookup_table[index] = uInt8(nearest);
+        index++;
+      }
+    }
+  }
+
+  table_colors = colors;
+}
+
+//----------------------------------------------------------------------
+uInt FTrueColor::getPaletteRGB (FColor color)
+{
+  // Returns the RGB value of a palette color (VGA colors,
+  // followed by the xterm color cube and grayscale ramp)
+
+  static constexpr uInt vga_colors[16] =
+  {
+    0x000000, 0x0000aa, 0x00aa00, 0x00aaaa,
+    0xaa0000, 0xaa00aa, 0xaa5500, 0xaaaaaa,
+    0x555555, 0x5555ff, 0x55ff55, 0x55ffff,
+    0xff5555, 0xff55ff, 0xffff55, 0xffffff
+  };
+
+  static constexpr uInt cube_levels[6] =
+  {
+    0x00, 0x5f, 0x87, 0xaf, 0xd7, 0xff
+  };
+
+  if ( color < 16 )
+    return vga_colors[color];
+
+  if ( color < 232 )  // 6 x 6 x 6 color cube
+  {
+    const uInt index = color - 16;
+    return ( cube_levels[index / 36] << 16 )
+         | ( cube_levels[(index / 6) % 6] << 8 )
+         | cube_levels[index % 6];
+  }
+
+  if ( color < 256 )  // Grayscale ramp
+  {
+    const uInt level = 8 + 10 * uInt(color - 232);
+    return (level << 16) | (level << 8) | level;
+  }
+
+  return 0;
+}
+
+//----------------------------------------------------------------------
+uInt FTrueColor::getDistance (uInt rgb1, uInt rgb2)
+{
+  const int r1 = int(rgb1 >> 16);
+  const int r2 = int(rgb2 >> 16);
+  const int dr = r1 - r2;
+  const int dg = int((rgb1 >> 8) & 0xff) - int((rgb2 >> 8) & 0xff);
+  const int db = int(rgb1 & 0xff) - int(rgb2 & 0xff);
+
+  if ( ! perceptual )
+    return uInt(dr * dr + dg * dg + db * db);
+
+  // "Redmean" approximation of the perceived color difference
+  const int rmean = (r1 + r2) / 2;
+  return uInt( (((512 + rmean) * dr * dr) >> 8)
+             + 4 * dg * dg
+             + (((767 - rmean) * db * db) >> 8) );
+}
+
+}  // namespace finalcut
@@ -20,6 +20,10 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <sys/ioctl.h>
+
+#include <algorithm>
+#include <limits>
 #include <queue>
 #include <string>
 #include <vector>
@@ -28,6 +32,7 @@
 #include "final/fc.h"
 #include "final/fcharmap.h"
 #include "final/fcolorpair.h"
+#include "final/fglyphstore.h"
 #include "final/fkeyboard.h"
 #include "final/foptiattr.h"
 #include "final/foptimove.h"
@@ -36,6 +41,10 @@
 #include "final/ftermdata.h"
 #include "final/ftermbuffer.h"
 #include "final/ftermcap.h"
+#include "final/ftermios.h"
+#include "final/ftermoutput.h"
+#include "final/ftermvcsa.h"
+#include "final/ftruecolor.h"
 #include "final/ftypes.h"
 #include "final/fvterm.h"
 #include "final/fwidget.h"
@@ -48,17 +57,27 @@ namespace finalcut
 static FVTerm* init_object{nullptr};
 
 // static class attributes
+constexpr int        FVTerm::TERMINAL_OUTPUT_QUEUE_LIMIT;
+constexpr uInt64     FVTerm::MAX_FRAME_INTERVAL;
 bool                 FVTerm::terminal_update_complete{false};
 bool                 FVTerm::terminal_update_pending{false};
 bool                 FVTerm::force_terminal_update{false};
 bool                 FVTerm::stop_terminal_updates{false};
+bool                 FVTerm::direct_color_sweep{true};
 int                  FVTerm::skipped_terminal_update{};
+uInt                 FVTerm::max_frames_per_second{60};
+uInt64               FVTerm::frame_interval{1000000 / 60};
+timeval              FVTerm::last_frame_time{};
 uInt                 FVTerm::erase_char_length{};
 uInt                 FVTerm::repeat_char_length{};
 uInt                 FVTerm::clr_bol_length{};
 uInt                 FVTerm::clr_eol_length{};
 uInt                 FVTerm::cursor_address_length{};
+uInt                 FVTerm::cursor_move_length{};
 std::queue<int>*     FVTerm::output_buffer{nullptr};
+std::vector<FVTerm::FTermArea*>* FVTerm::area_list{nullptr};
+std::vector<FVTerm::FOutputSpan>* FVTerm::span_list{nullptr};
+std::vector<FVTerm::FTermScroll>* FVTerm::scroll_list{nullptr};
 FPoint*              FVTerm::term_pos{nullptr};
 FSystem*             FVTerm::fsystem{nullptr};
 FTerm*               FVTerm::fterm{nullptr};
@@ -176,10 +195,33 @@ FColor FVTerm::rgb2ColorIndex (uInt8 r, uInt8 g, uInt8 b)
 {
   // Converts a 24-bit RGB color to a 256-color compatible approximation
 
-  FColor ri = (((r * 5) + 127) / 255) * 36;
-  FColor gi = (((g * 5) + 127) / 255) * 6;
-  FColor bi = (((b * 5) + 127) / 255);
-  return 16 + ri + gi + bi;
+  return FTrueColor::quantize (r, g, b, 256);
+}
+
+//----------------------------------------------------------------------
+FColor FVTerm::rgb2Color (uInt8 r, uInt8 g, uInt8 b)
+{
+  // Returns a 24-bit direct color if the terminal can display it,
+  // otherwise the nearest color of the terminal palette
+
+  if ( FTerm::hasTrueColor() )
+  {
+    if ( FTrueColor::isFull() && direct_color_sweep )
+      sweepDirectColors();
+
+    return FTrueColor::rgb (r, g, b);
+  }
+
+  return FTrueColor::quantize (r, g, b, FTerm::getMaxColor());
+}
+
+//----------------------------------------------------------------------
+void FVTerm::setMaxFramesPerSecond (uInt fps)
+{
+  // Limits the number of terminal updates per second (0 = unlimited)
+
+  max_frames_per_second = fps;
+  frame_interval = ( fps > 0 ) ? 1000000 / fps : 0;
 }
 
 //----------------------------------------------------------------------
@@ -206,6 +248,10 @@ void FVTerm::resizeVTerm (const FSize& size)
   const FRect box(0, 0, size.getWidth(), size.getHeight());
   const FSize shadow(0, 0);
   resizeArea (box, shadow, vterm);
+
+  // Queued scrolls refer to the old terminal size
+  if ( scroll_list )
+    scroll_list->clear();
 }
 
 //----------------------------------------------------------------------
@@ -252,7 +298,8 @@ void FVTerm::updateTerminal()
     if ( ! terminal_update_complete )
       return;
 
-    if ( keyboard->isInputDataPending() )
+    // Changes within a frame interval are merged into one update
+    if ( keyboard->isInputDataPending() || ! isFrameDue() )
     {
       terminal_update_pending = true;
       return;
@@ -272,6 +319,13 @@ void FVTerm::updateTerminal()
     return;
   }
 
+  // A stalled terminal gets no new frames until the output drains
+  if ( ! isOutputReady() )
+  {
+    terminal_update_pending = true;
+    return;
+  }
+
   // Update data on VTerm
   updateVTerm();
 
@@ -279,13 +333,39 @@ void FVTerm::updateTerminal()
   if ( ! vterm->has_changes )
     return;
 
-  for (uInt y{0}; y < uInt(vterm->height); y++)
-    updateTerminalLine (y);
+  FObject::getCurrentTime (&last_frame_time);
+  flush();
+
+  // The console memory is written directly if possible
+  const bool use_vcsa = FTermVcsa::isActive() && FTermVcsa::readHeader();
+
+  // Queued escape sequences must arrive before the memory changes
+  if ( use_vcsa )
+    FTermOutput::drain();
+
+  FTermOutput::beginFrame();
+
+  // The terminal scrolls first, the lines are then updated
+  // on top of the moved content
+  applyTermScrolls();
+
+  if ( use_vcsa )
+  {
+    for (uInt y{0}; y < uInt(vterm->height); y++)
+      updateVcsaLine (y);
+  }
+  else
+  {
+    for (uInt y{0}; y < uInt(vterm->height); y++)
+      updateTerminalLine (y);
+  }
 
   vterm->has_changes = false;
 
   // sets the new input cursor position
   updateTerminalCursor();
+  FTermOutput::endFrame();
+  flush();
 }
 
 //----------------------------------------------------------------------
@@ -324,7 +404,7 @@ void FVTerm::delPreprocessingHandler (FVTerm* instance)
 }
 
 //----------------------------------------------------------------------
-int FVTerm::print (const FString& s)
+int FVTerm::print (const FStringView& s)
 {
   if ( s.isNull() )
     return -1;
@@ -338,33 +418,39 @@ int FVTerm::print (const FString& s)
 }
 
 //----------------------------------------------------------------------
-int FVTerm::print (FTermArea* area, const FString& s)
+int FVTerm::print (FTermArea* area, const FStringView& s)
 {
   if ( s.isNull() || ! area )
     return -1;
 
   std::vector<FChar> term_string{};
-  const wchar_t* p = s.wc_str();
+  term_string.reserve(s.getSize());
 
-  if ( p )
+  for (auto&& ch : s)
   {
-    while ( *p )
+    if ( ch == L'\0' )
+      break;
+
+    if ( ! term_string.empty()
+      && FGlyphStore::extendsGlyph(term_string.back().ch, ch) )
     {
-      FChar nc{};  // next character
-      nc.ch           = *p;
-      nc.fg_color     = next_attribute.fg_color;
-      nc.bg_color     = next_attribute.bg_color;
-      nc.attr.byte[0] = next_attribute.attr.byte[0];
-      nc.attr.byte[1] = next_attribute.attr.byte[1];
-      nc.attr.byte[2] = 0;
-      term_string.push_back(nc);
-      p++;
-    }  // end of while
+      // Add ch to the grapheme cluster of the previous character
+      auto& last = term_string.back();
+      last.ch = FGlyphStore::combine(last.ch, ch);
+      continue;
+    }
 
-    return print (area, term_string);
+    FChar nc{};  // next character
+    nc.ch           = ch;
+    nc.fg_color     = next_attribute.fg_color;
+    nc.bg_color     = next_attribute.bg_color;
+    nc.attr.byte[0] = next_attribute.attr.byte[0];
+    nc.attr.byte[1] = next_attribute.attr.byte[1];
+    nc.attr.byte[2] = 0;
+    term_string.push_back(nc);
   }
 
-  return 0;
+  return print (area, term_string);
 }
 
 //----------------------------------------------------------------------
@@ -414,8 +500,22 @@ int FVTerm::print (FTermArea* area, const std::vector<FChar>& term_string)
   if ( term_string.empty() )
     return 0;
 
-  for (auto&& fchar : term_string)
+  auto iter = term_string.begin();
+  const auto last = term_string.end();
+
+  while ( iter != last )
   {
+    // Printable single-column characters are written as a whole run
+    const std::size_t span_len = printSpan (area, iter, last);
+
+    if ( span_len > 0 )
+    {
+      iter += std::ptrdiff_t(span_len);
+      len += int(span_len);
+      continue;
+    }
+
+    const auto& fchar = *iter;
     bool printable_character{false};
 
     switch ( fchar.ch )
@@ -455,6 +555,7 @@ int FVTerm::print (FTermArea* area, const std::vector<FChar>& term_string)
       break;  // end of area reached
 
     len++;
+    ++iter;
   }
 
   return len;
@@ -517,7 +618,10 @@ int FVTerm::print (FTermArea* area, FChar& term_char)
   std::size_t char_width = getColumnWidth(nc);  // add column width
 
   if ( char_width == 0 && ! nc.attr.bit.fullwidth_padding )
+  {
+    combineWithPreviousCell (area, nc.ch);
     return 0;
+  }
 
   if ( area->cursor_x > 0
     && area->cursor_y > 0
@@ -529,21 +633,7 @@ int FVTerm::print (FTermArea* area, FChar& term_char)
 
     if ( *ac != nc )  // compare with an overloaded operator
     {
-      if ( ( ! ac->attr.bit.transparent  && nc.attr.bit.transparent )
-        || ( ! ac->attr.bit.trans_shadow && nc.attr.bit.trans_shadow )
-        || ( ! ac->attr.bit.inherit_bg   && nc.attr.bit.inherit_bg ) )
-      {
-        // add one transparent character form line
-        area->changes[ay].trans_count++;
-      }
-
-      if ( ( ac->attr.bit.transparent  && ! nc.attr.bit.transparent )
-        || ( ac->attr.bit.trans_shadow && ! nc.attr.bit.trans_shadow )
-        || ( ac->attr.bit.inherit_bg   && ! nc.attr.bit.inherit_bg ) )
-      {
-        // remove one transparent character from line
-        area->changes[ay].trans_count--;
-      }
+      updateTransCount (area->changes[ay], *ac, nc);
 
       // copy character to area
       std::memcpy (ac, &nc, sizeof(*ac));
@@ -595,6 +685,19 @@ void FVTerm::flush()
 {
   // Flush the output buffer
 
+  if ( output_buffer->empty() )
+  {
+    std::fflush(stdout);
+
+    if ( ! FTermOutput::isFrameActive() )
+      FTermOutput::write();
+
+    return;
+  }
+
+  timeval start{};
+  FObject::getCurrentTime (&start);
+
   while ( ! output_buffer->empty() )
   {
     static FTerm::defaultPutChar& FTermPutchar = FTerm::putchar();
@@ -603,6 +706,16 @@ void FVTerm::flush()
   }
 
   std::fflush(stdout);
+
+  // A frame is sent as a whole after its completion
+  if ( ! FTermOutput::isFrameActive() )
+    FTermOutput::write();
+
+  // The write time is a measure for the terminal throughput
+  timeval now{};
+  FObject::getCurrentTime (&now);
+  const timeval diff = now - start;
+  adjustFrameInterval (uInt64(diff.tv_sec) * 1000000 + uInt64(diff.tv_usec));
 }
 
 
@@ -631,6 +744,22 @@ FVTerm::FTermArea* FVTerm::getPrintArea()
   return vdesktop;
 }
 
+//----------------------------------------------------------------------
+uInt64 FVTerm::getFrameWaitTime()
+{
+  // Returns the time in microseconds until the next frame is due
+
+  if ( ! terminal_update_pending )
+    return MAX_FRAME_INTERVAL;
+
+  const uInt64 elapsed = getFrameElapsedTime();
+
+  if ( elapsed >= frame_interval )
+    return 0;
+
+  return frame_interval - elapsed;
+}
+
 //----------------------------------------------------------------------
 void FVTerm::createArea ( const FRect& box
                         , const FSize& shadow
@@ -650,6 +779,9 @@ void FVTerm::createArea ( const FRect& box
 
   area->widget = reinterpret_cast<FWidget*>(this);
   resizeArea (box, shadow, area);
+
+  if ( area_list )
+    area_list->push_back(area);
 }
 
 //----------------------------------------------------------------------
@@ -729,6 +861,14 @@ void FVTerm::removeArea (FTermArea*& area)
 
   if ( area != 0 )
   {
+    if ( area_list )
+    {
+      auto iter = std::find(area_list->begin(), area_list->end(), area);
+
+      if ( iter != area_list->end() )
+        area_list->erase(iter);
+    }
+
     if ( area->changes != 0 )
     {
       delete[] area->changes;
@@ -1084,6 +1224,87 @@ void FVTerm::putArea (const FPoint& pos, FTermArea* area)
   vterm->has_changes = true;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::saveAreaRegion ( const FTermArea* area
+                            , const FRect& box
+                            , std::vector<FChar>& cells )
+{
+  // Copies the character cells of a rectangle from the area.
+  // The box position is relative to the area (first cell = 1,1).
+
+  const int w = int(box.getWidth());
+  const int h = int(box.getHeight());
+  cells.assign (std::size_t(w * h), FChar{});
+
+  if ( ! area || ! area->data )
+    return;
+
+  const int line_len = area->width + area->right_shadow;
+  const int area_height = area->height + area->bottom_shadow;
+  const int ax = box.getX() - 1;
+  const int ay = box.getY() - 1;
+  const int x_start = std::max(0, -ax);
+  const int x_end = std::min(w, line_len - ax);
+
+  if ( x_start >= x_end )
+    return;
+
+  for (int y{std::max(0, -ay)}; y < h && ay + y < area_height; y++)
+  {
+    const auto ac = &area->data[(ay + y) * line_len + ax + x_start];
+    std::memcpy ( &cells[std::size_t(y * w + x_start)], ac
+                , sizeof(*ac) * std::size_t(x_end - x_start) );
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::restoreAreaRegion ( FTermArea* area
+                               , const FRect& box
+                               , const std::vector<FChar>& cells )
+{
+  // Writes the character cells saved by saveAreaRegion()
+  // back into the area and marks the changed cells
+
+  const int w = int(box.getWidth());
+  const int h = int(box.getHeight());
+
+  if ( ! area || ! area->data || cells.size() != std::size_t(w * h) )
+    return;
+
+  const int line_len = area->width + area->right_shadow;
+  const int area_height = area->height + area->bottom_shadow;
+  const int ax = box.getX() - 1;
+  const int ay = box.getY() - 1;
+  const int x_start = std::max(0, -ax);
+  const int x_end = std::min(w, line_len - ax);
+
+  if ( x_start >= x_end )
+    return;
+
+  for (int y{std::max(0, -ay)}; y < h && ay + y < area_height; y++)
+  {
+    auto& line_changes = area->changes[ay + y];
+    auto ac = &area->data[(ay + y) * line_len + ax + x_start];  // area character
+    auto sc = &cells[std::size_t(y * w + x_start)];  // saved character
+
+    for (int x{ax + x_start}; x < ax + x_end; x++, ac++, sc++)
+    {
+      if ( *ac == *sc )  // compare with an overloaded operator
+        continue;
+
+      updateTransCount (line_changes, *ac, *sc);
+      std::memcpy (ac, sc, sizeof(*ac));
+      area->has_changes = true;
+
+      if ( x < int(line_changes.xmin) )
+        line_changes.xmin = uInt(x);
+
+      if ( x > int(line_changes.xmax) )
+        line_changes.xmax = uInt(x);
+    }
+  }
+}
+
 //----------------------------------------------------------------------
 void FVTerm::scrollAreaForward (FTermArea* area)
 {
@@ -1127,6 +1348,7 @@ void FVTerm::scrollAreaForward (FTermArea* area)
   {
     if ( TCAP(fc::t_scroll_forward)  )
     {
+      applyTermScrolls();
       setTermXY (0, vdesktop->height);
       FTerm::scrollTermForward();
       putArea (FPoint(1, 1), vdesktop);
@@ -1185,6 +1407,7 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   {
     if ( TCAP(fc::t_scroll_reverse)  )
     {
+      applyTermScrolls();
       setTermXY (0, 0);
       FTerm::scrollTermReverse();
       putArea (FPoint(1, 1), vdesktop);
@@ -1199,6 +1422,24 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   }
 }
 
+//----------------------------------------------------------------------
+void FVTerm::scrollAreaForward ( FTermArea* area, const FRect& box
+                               , std::size_t num )
+{
+  // Scrolls the area region box (terminal positions) num lines up
+
+  scrollAreaRegion (area, box, int(num));
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollAreaReverse ( FTermArea* area, const FRect& box
+                               , std::size_t num )
+{
+  // Scrolls the area region box (terminal positions) num lines down
+
+  scrollAreaRegion (area, box, -int(num));
+}
+
 //----------------------------------------------------------------------
 void FVTerm::clearArea (FTermArea* area, int fillchar)
 {
@@ -1258,14 +1499,19 @@ void FVTerm::processTerminalUpdate()
   // Retains terminal updates if there are unprocessed inputs
   static constexpr int max_skip = 8;
 
+  // Continue sending the output of previous frames
+  if ( FTermOutput::hasPendingData() )
+    FTermOutput::write();
+
   if ( ! terminal_update_pending )
     return;
 
   if ( ! keyboard->isInputDataPending() )
   {
-    updateTerminal();
+    // Remains pending if the next frame is not yet due
     terminal_update_pending = false;
     skipped_terminal_update = 0;
+    updateTerminal();
   }
   else if ( skipped_terminal_update > max_skip )
   {
@@ -1556,12 +1802,10 @@ void FVTerm::updateCharacter ( FTermArea* area
   auto ac = &area->data[y * width + x];
   // Terminal character
   auto tc = &vterm->data[ty * vterm->width + tx];
+  // Compare with the character on the terminal before it is overwritten
+  bool no_changes = bool(tc->attr.bit.printed && *tc == *ac);
   std::memcpy (tc, ac, sizeof(*tc));
-
-  if ( tc->attr.bit.printed && *tc == *ac )
-    tc->attr.bit.no_changes = true;
-  else
-    tc->attr.bit.no_changes = false;
+  tc->attr.bit.no_changes = no_changes;
 }
 
 //----------------------------------------------------------------------
@@ -1871,6 +2115,9 @@ void FVTerm::init (bool disable_alt_screen)
     fterm         = new FTerm (disable_alt_screen);
     term_pos      = new FPoint(-1, -1);
     output_buffer = new std::queue<int>;
+    area_list     = new std::vector<FTermArea*>;
+    span_list     = new std::vector<FOutputSpan>;
+    scroll_list   = new std::vector<FTermScroll>;
   }
   catch (const std::bad_alloc& ex)
   {
@@ -1919,6 +2166,10 @@ void FVTerm::init_characterLengths (FOptiMove* optimove)
     repeat_char_length    = optimove->getRepeatCharLength();
     clr_bol_length        = optimove->getClrBolLength();
     clr_eol_length        = optimove->getClrEolLength();
+    // Shortest cursor movement within a line
+    cursor_move_length    = std::min ({ cursor_address_length
+                                      , optimove->getColumnAddressLength()
+                                      , optimove->getParmRightCursorLength() });
   }
   else
   {
@@ -1927,6 +2178,7 @@ void FVTerm::init_characterLengths (FOptiMove* optimove)
     repeat_char_length    = INT_MAX;
     clr_bol_length        = INT_MAX;
     clr_eol_length        = INT_MAX;
+    cursor_move_length    = INT_MAX;
   }
 }
 
@@ -1951,6 +2203,27 @@ void FVTerm::finish()
   removeArea (vdesktop);
   removeArea (vterm);
 
+  if ( area_list )
+  {
+    delete area_list;
+    area_list = nullptr;
+  }
+
+  if ( span_list )
+  {
+    delete span_list;
+    span_list = nullptr;
+  }
+
+  if ( scroll_list )
+  {
+    delete scroll_list;
+    scroll_list = nullptr;
+  }
+
+  FGlyphStore::clear();
+  FTrueColor::clear();
+
   if ( term_pos )
     delete term_pos;
 
@@ -1958,6 +2231,118 @@ void FVTerm::finish()
     delete fterm;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::compactGlyphStore()
+{
+  // Rebuilds the glyph store with the clusters
+  // of all areas and term buffers
+
+  if ( ! area_list || FGlyphStore::getCount() == 0 )
+    return;
+
+  FGlyphStore::startCompaction();
+
+  for (auto&& area : *area_list)
+  {
+    if ( ! area->data )
+      continue;
+
+    int size = (area->width + area->right_shadow)
+             * (area->height + area->bottom_shadow);
+
+    for (int i{0}; i < size; i++)
+    {
+      auto& fchar = area->data[i];
+      fchar.ch = FGlyphStore::relocate(fchar.ch);
+    }
+  }
+
+  // Term buffers (e.g. a list view header) keep their cells
+  auto buffer = FTermBuffer::first_buffer;
+
+  while ( buffer )
+  {
+    for (auto&& fchar : buffer->data)
+    {
+      fchar.ch = FGlyphStore::relocate(fchar.ch);
+    }
+
+    buffer = buffer->next_buffer;
+  }
+
+  FGlyphStore::finishCompaction();
+}
+
+//----------------------------------------------------------------------
+void FVTerm::sweepDirectColors()
+{
+  // Releases the direct color numbers that no cell, term buffer,
+  // terminal state or widget color uses. The numbers in use keep
+  // their value, so no cell has to be rewritten.
+
+  FTrueColor::startSweep();
+
+  if ( area_list )
+  {
+    for (auto&& area : *area_list)
+    {
+      if ( ! area->data )
+        continue;
+
+      int size = (area->width + area->right_shadow)
+               * (area->height + area->bottom_shadow);
+
+      for (int i{0}; i < size; i++)
+      {
+        FTrueColor::mark (area->data[i].fg_color);
+        FTrueColor::mark (area->data[i].bg_color);
+      }
+    }
+  }
+
+  auto buffer = FTermBuffer::first_buffer;
+
+  while ( buffer )
+  {
+    for (auto&& fchar : buffer->data)
+    {
+      FTrueColor::mark (fchar.fg_color);
+      FTrueColor::mark (fchar.bg_color);
+    }
+
+    buffer = buffer->next_buffer;
+  }
+
+  FTrueColor::mark (term_attribute.fg_color);
+  FTrueColor::mark (term_attribute.bg_color);
+  FTrueColor::mark (next_attribute.fg_color);
+  FTrueColor::mark (next_attribute.bg_color);
+  markWidgetColors (FApplication::getApplicationObject());
+  const std::size_t released = FTrueColor::finishSweep();
+
+  // A sweep that releases only a few numbers is not
+  // repeated before the next clearing of the desktop
+  if ( released < FTrueColor::getCount() / 16 )
+    direct_color_sweep = false;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::markWidgetColors (const FObject* obj)
+{
+  if ( ! obj )
+    return;
+
+  if ( obj->isWidget() )
+  {
+    const auto widget = static_cast<const FWidget*>(obj);
+    FTrueColor::mark (widget->getForegroundColor());
+    FTrueColor::mark (widget->getBackgroundColor());
+  }
+
+  for (auto&& child : obj->getChildren())
+    markWidgetColors (child);
+}
+
 //----------------------------------------------------------------------
 void FVTerm::putAreaLine (FChar* ac, FChar* tc, int length)
 {
@@ -2049,85 +2434,418 @@ void FVTerm::getAreaCharacter ( const FPoint& pos, FTermArea* area
 }
 
 //----------------------------------------------------------------------
-bool FVTerm::clearTerm (int fillchar)
+void FVTerm::scrollAreaRegion (FTermArea* area, const FRect& box, int num)
 {
-  // Clear the real terminal and put cursor at home
+  // Moves the content of the area region box by num lines
+  // (num > 0: up, num < 0: down). The exposed lines are cleared
+  // and must be redrawn together with the rest of the region.
+  // If possible, the terminal scrolls the same region itself
+  // at the start of the next frame, so that only the exposed
+  // lines have to be transferred.
+
+  if ( ! area || num == 0 )
+    return;
 
-  auto& cl = TCAP(fc::t_clear_screen);
-  auto& cd = TCAP(fc::t_clr_eos);
-  auto& cb = TCAP(fc::t_clr_eol);
-  bool ut = FTermcap::background_color_erase;
-  auto next = &next_attribute;
-  bool normal = FTerm::isNormal(next);
-  appendAttributes(next);
+  // Only the virtual desktop and window areas
+  // have a fixed position on the terminal
+  if ( area != vdesktop
+    && ! (area->widget && area->widget->getVWin() == area) )
+    return;
 
-  if ( ! ( (cl || cd || cb) && (normal || ut) )
-    || fillchar != ' ' )
-  {
-    return false;
-  }
+  // Region in area coordinates
+  FRect region ( box.getX1() - 1 - area->offset_left
+               , box.getY1() - 1 - area->offset_top
+               , box.getWidth()
+               , box.getHeight() );
 
-  if ( cl )  // Clear screen
-  {
-    appendOutputBuffer (cl);
-    term_pos->setPoint(0, 0);
-  }
-  else if ( cd )  // Clear to end of screen
+  if ( region.getX1() < 0 || region.getY1() < 0
+    || region.getX2() >= area->width || region.getY2() >= area->height
+    || std::size_t(std::abs(num)) >= region.getHeight() )
+    return;
+
+  for (int y = region.getY1(); y <= region.getY2(); y++)
   {
-    setTermXY (0, 0);
-    appendOutputBuffer (cd);
-    term_pos->setPoint(-1, -1);
+    // Transparent characters depend on the content below
+    if ( area->changes[y].trans_count > 0 )
+      return;
   }
-  else if ( cb )  // Clear to end of line
-  {
-    term_pos->setPoint(-1, -1);
 
-    for (int i{0}; i < int(getLineNumber()); i++)
-    {
-      setTermXY (0, i);
-      appendOutputBuffer (cb);
-    }
+  // Region in terminal coordinates
+  FRect term_region ( region.getX1() + area->offset_left
+                    , region.getY1() + area->offset_top
+                    , region.getWidth()
+                    , region.getHeight() );
 
-    setTermXY (0, 0);
+  if ( canScrollTermRegion(area, term_region, num) )
+  {
+    // The pending changes of both areas move with the lines,
+    // so vterm keeps describing the scrolled terminal content
+    queueTermScroll (term_region, num);
+    shiftAreaLines (vterm, term_region, num, false);
+    shiftAreaLines (area, region, num, false);
+    vterm->has_changes = true;
   }
+  else
+    shiftAreaLines (area, region, num, true);
 
-  flush();
-  return true;
+  area->has_changes = true;
 }
 
 //----------------------------------------------------------------------
-bool FVTerm::clearFullArea (FTermArea* area, FChar& nc)
+bool FVTerm::canScrollTermRegion ( FTermArea* area
+                                 , const FRect& term_region
+                                 , int num )
 {
-  // Clear area
-  int area_size = area->width * area->height;
-  std::fill_n (area->data, area_size, nc);
+  // Checks whether the terminal can scroll the region term_region
 
-  if ( area != vdesktop )  // Is the area identical to the desktop?
+  if ( stop_terminal_updates || ! terminal_update_complete )
     return false;
 
-  // Try to clear the terminal rapidly with a control sequence
-  if ( clearTerm (nc.ch) )
-  {
-    nc.attr.bit.printed = true;
-    std::fill_n (vterm->data, area_size, nc);
-  }
-  else
-  {
-    for (int i{0}; i < vdesktop->height; i++)
-    {
-      vdesktop->changes[i].xmin = 0;
-      vdesktop->changes[i].xmax = uInt(vdesktop->width) - 1;
-      vdesktop->changes[i].trans_count = 0;
-    }
+  // The console memory is written without escape sequences.
+  // Rewriting the region there is cheap and cannot overtake
+  // the queued scroll sequences.
+  if ( FTermVcsa::isActive() )
+    return false;
 
-    vdesktop->has_changes = true;
-  }
+  if ( term_region.getX2() >= vterm->width
+    || term_region.getY2() >= vterm->height )
+    return false;
 
-  return true;
-}
+  auto& cs = TCAP(fc::t_change_scroll_region);
+  auto& ml = TCAP(fc::t_set_lr_margin);
+  auto& mc = TCAP(fc::t_clear_margins);
+  bool full_lines = term_region.getX1() == 0
+                 && term_region.getX2() == vterm->width - 1;
 
-//----------------------------------------------------------------------
-void FVTerm::clearAreaWithShadow (FTermArea* area, FChar& nc)
+  if ( ! cs || ( ! full_lines && ! (ml && mc) ) )
+    return false;
+
+  if ( num > 0 && ! TCAP(fc::t_parm_index) && ! TCAP(fc::t_scroll_forward) )
+    return false;
+
+  if ( num < 0 && ! TCAP(fc::t_parm_rindex) && ! TCAP(fc::t_scroll_reverse) )
+    return false;
+
+  if ( ! FWidget::getWindowList() || FWidget::getWindowList()->empty() )
+    return true;
+
+  // The region must not be covered by a window above this area
+  bool found( area == vdesktop );
+
+  for (auto& win_obj : *FWidget::getWindowList())
+  {
+    auto win = win_obj->getVWin();
+
+    if ( win == area )
+    {
+      found = true;
+      continue;
+    }
+
+    if ( ! (found && win && win->visible) )
+      continue;
+
+    FRect geometry ( win->offset_left
+                   , win->offset_top
+                   , std::size_t(win->width + win->right_shadow)
+                   , std::size_t(win->height + win->bottom_shadow) );
+
+    if ( geometry.overlap(term_region) )
+      return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollTermRegion (const FRect& term_region, int num)
+{
+  // Scrolls the terminal lines inside term_region (0-based) by num
+  // lines with a scroll region (DECSTBM) and, for partial lines,
+  // with left and right margins (DECSLRM)
+
+  auto& cs = TCAP(fc::t_change_scroll_region);
+  int x1 = term_region.getX1();
+  int x2 = term_region.getX2();
+  int y1 = term_region.getY1();
+  int y2 = term_region.getY2();
+  bool full_lines = x1 == 0 && x2 == vterm->width - 1;
+  std::size_t count = std::size_t(std::abs(num));
+
+  if ( ! full_lines )
+    appendOutputBuffer (tparm(TCAP(fc::t_set_lr_margin), x1, x2, 0, 0, 0, 0, 0, 0, 0));
+
+  appendOutputBuffer (tparm(cs, y1, y2, 0, 0, 0, 0, 0, 0, 0));
+
+  // The cursor position is undefined after setting the scroll region
+  term_pos->setPoint(-1, -1);
+
+  if ( num > 0 )
+  {
+    auto& sf = TCAP(fc::t_scroll_forward);
+    auto& parm_sf = TCAP(fc::t_parm_index);
+    setTermXY (x1, y2);
+
+    if ( parm_sf && ( count > 1 || ! sf ) )
+      appendOutputBuffer (tparm(parm_sf, int(count), 0, 0, 0, 0, 0, 0, 0, 0));
+    else
+      for (std::size_t i{0}; i < count; i++)
+        appendOutputBuffer (sf);
+  }
+  else
+  {
+    auto& sr = TCAP(fc::t_scroll_reverse);
+    auto& parm_sr = TCAP(fc::t_parm_rindex);
+    setTermXY (x1, y1);
+
+    if ( parm_sr && ( count > 1 || ! sr ) )
+      appendOutputBuffer (tparm(parm_sr, int(count), 0, 0, 0, 0, 0, 0, 0, 0));
+    else
+      for (std::size_t i{0}; i < count; i++)
+        appendOutputBuffer (sr);
+  }
+
+  if ( ! full_lines )
+    appendOutputBuffer (TCAP(fc::t_clear_margins));
+
+  appendOutputBuffer (tparm(cs, 0, vterm->height - 1, 0, 0, 0, 0, 0, 0, 0));
+  term_pos->setPoint(-1, -1);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::queueTermScroll (const FRect& term_region, int num)
+{
+  // Adds a terminal scroll to the next frame. Scrolls of the same
+  // region are merged: lines that the merged scroll moves
+  // differently are exposed lines and are redrawn anyway.
+
+  if ( ! scroll_list->empty() )
+  {
+    auto& last = scroll_list->back();
+
+    if ( last.x1 == term_region.getX1() && last.y1 == term_region.getY1()
+      && last.x2 == term_region.getX2() && last.y2 == term_region.getY2() )
+    {
+      last.num += num;
+
+      // Without moved lines, the whole region is redrawn
+      if ( last.num == 0
+        || std::size_t(std::abs(last.num)) >= term_region.getHeight() )
+        scroll_list->pop_back();
+
+      return;
+    }
+  }
+
+  scroll_list->push_back ({ term_region.getX1(), term_region.getY1()
+                          , term_region.getX2(), term_region.getY2()
+                          , num });
+}
+
+//----------------------------------------------------------------------
+void FVTerm::applyTermScrolls()
+{
+  // Sends the queued terminal scrolls in their original order
+
+  if ( ! scroll_list || scroll_list->empty() )
+    return;
+
+  for (auto&& scroll : *scroll_list)
+  {
+    const FRect term_region ( FPoint(scroll.x1, scroll.y1)
+                            , FPoint(scroll.x2, scroll.y2) );
+    scrollTermRegion (term_region, scroll.num);
+  }
+
+  scroll_list->clear();
+}
+
+//----------------------------------------------------------------------
+void FVTerm::shiftAreaLines ( FTermArea* area, const FRect& region
+                            , int num, bool mark_all )
+{
+  // Shifts the lines of the area region by num lines (num > 0: up)
+  // and clears the exposed lines. With mark_all, the moved lines
+  // are also marked as changed, otherwise their pending changes
+  // move with them.
+
+  int total_width = area->width + area->right_shadow;
+  int x1 = region.getX1();
+  int x2 = region.getX2();
+  int y1 = region.getY1();
+  int y2 = region.getY2();
+  int count = std::abs(num);
+  auto length = std::size_t(x2 - x1 + 1);
+
+  auto mark_line = [&] (int y)
+  {
+    if ( uInt(x1) < area->changes[y].xmin )
+      area->changes[y].xmin = uInt(x1);
+
+    if ( uInt(x2) > area->changes[y].xmax )
+      area->changes[y].xmax = uInt(x2);
+  };
+
+  auto move_changes = [&] (int to, int from)
+  {
+    // Changes outside the region stay, changes inside the
+    // region are taken from the source line
+    auto& dst = area->changes[to];
+    const auto& src = area->changes[from];
+    uInt xmin = uInt(total_width);
+    uInt xmax{0};
+
+    auto add_range = [&xmin, &xmax] (uInt min, uInt max)
+    {
+      if ( min > max )
+        return;
+
+      xmin = std::min(xmin, min);
+      xmax = std::max(xmax, max);
+    };
+
+    if ( dst.xmin < uInt(x1) )
+      add_range (dst.xmin, std::min(dst.xmax, uInt(x1 - 1)));
+
+    if ( dst.xmax > uInt(x2) )
+      add_range (std::max(dst.xmin, uInt(x2 + 1)), dst.xmax);
+
+    add_range (std::max(src.xmin, uInt(x1)), std::min(src.xmax, uInt(x2)));
+    dst.xmin = xmin;
+    dst.xmax = xmax;
+  };
+
+  auto move_line = [&] (int to, int from)
+  {
+    auto dc = &area->data[to * total_width + x1];
+    auto sc = &area->data[from * total_width + x1];
+    std::memcpy (dc, sc, sizeof(*dc) * length);
+
+    if ( mark_all )
+      mark_line (to);
+    else
+      move_changes (to, from);
+  };
+
+  auto clear_line = [&] (int y)
+  {
+    auto dc = &area->data[y * total_width + x1];
+
+    for (std::size_t x{0}; x < length; x++)
+    {
+      dc[x].ch = ' ';
+      dc[x].attr.bit.no_changes = false;
+      dc[x].attr.bit.printed = false;
+    }
+
+    mark_line (y);
+  };
+
+  if ( num > 0 )
+  {
+    for (int y = y1; y <= y2 - count; y++)
+      move_line (y, y + count);
+
+    for (int y = y2 - count + 1; y <= y2; y++)
+      clear_line (y);
+  }
+  else
+  {
+    for (int y = y2; y >= y1 + count; y--)
+      move_line (y, y - count);
+
+    for (int y = y1; y < y1 + count; y++)
+      clear_line (y);
+  }
+}
+
+//----------------------------------------------------------------------
+bool FVTerm::clearTerm (int fillchar)
+{
+  // Clear the real terminal and put cursor at home
+
+  auto& cl = TCAP(fc::t_clear_screen);
+  auto& cd = TCAP(fc::t_clr_eos);
+  auto& cb = TCAP(fc::t_clr_eol);
+  bool ut = FTermcap::background_color_erase;
+  auto next = &next_attribute;
+  bool normal = FTerm::isNormal(next);
+  appendAttributes(next);
+
+  if ( ! ( (cl || cd || cb) && (normal || ut) )
+    || fillchar != ' ' )
+  {
+    return false;
+  }
+
+  // Moving the lines of a cleared terminal changes nothing
+  scroll_list->clear();
+
+  if ( cl )  // Clear screen
+  {
+    appendOutputBuffer (cl);
+    term_pos->setPoint(0, 0);
+  }
+  else if ( cd )  // Clear to end of screen
+  {
+    setTermXY (0, 0);
+    appendOutputBuffer (cd);
+    term_pos->setPoint(-1, -1);
+  }
+  else if ( cb )  // Clear to end of line
+  {
+    term_pos->setPoint(-1, -1);
+
+    for (int i{0}; i < int(getLineNumber()); i++)
+    {
+      setTermXY (0, i);
+      appendOutputBuffer (cb);
+    }
+
+    setTermXY (0, 0);
+  }
+
+  flush();
+  return true;
+}
+
+//----------------------------------------------------------------------
+bool FVTerm::clearFullArea (FTermArea* area, FChar& nc)
+{
+  // Clear area
+  int area_size = area->width * area->height;
+  std::fill_n (area->data, area_size, nc);
+
+  if ( area != vdesktop )  // Is the area identical to the desktop?
+    return false;
+
+  // Release the grapheme clusters that are no longer in use
+  compactGlyphStore();
+  direct_color_sweep = true;  // Allows a new sweep of a full color store
+
+  // Try to clear the terminal rapidly with a control sequence
+  if ( clearTerm (nc.ch) )
+  {
+    nc.attr.bit.printed = true;
+    std::fill_n (vterm->data, area_size, nc);
+  }
+  else
+  {
+    for (int i{0}; i < vdesktop->height; i++)
+    {
+      vdesktop->changes[i].xmin = 0;
+      vdesktop->changes[i].xmax = uInt(vdesktop->width) - 1;
+      vdesktop->changes[i].trans_count = 0;
+    }
+
+    vdesktop->has_changes = true;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::clearAreaWithShadow (FTermArea* area, FChar& nc)
 {
   FChar t_char = nc;
   int total_width = area->width + area->right_shadow;
@@ -2186,151 +2904,395 @@ bool FVTerm::canClearToEOL (uInt xmin, uInt y)
 }
 
 //----------------------------------------------------------------------
-bool FVTerm::canClearLeadingWS (uInt& xmin, uInt y)
+bool FVTerm::isFrameDue()
+{
+  if ( frame_interval == 0 )
+    return true;
+
+  // Input echo is not delayed
+  if ( keyboard && last_frame_time < *keyboard->getKeyPressedTime() )
+    return true;
+
+  return getFrameElapsedTime() >= frame_interval;
+}
+
+//----------------------------------------------------------------------
+uInt64 FVTerm::getFrameElapsedTime()
+{
+  // Returns the time in microseconds since the last frame
+
+  timeval now{};
+  FObject::getCurrentTime (&now);
+
+  if ( now < last_frame_time )  // System time was changed
+    return MAX_FRAME_INTERVAL;
+
+  const timeval diff = now - last_frame_time;
+  return uInt64(diff.tv_sec) * 1000000 + uInt64(diff.tv_usec);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::adjustFrameInterval (uInt64 write_time)
+{
+  // Adaptive throttling: a slow output or a filled tty output queue
+  // doubles the frame interval, a free line returns to the frame rate
+
+  if ( max_frames_per_second == 0 )  // Frame limit disabled
+  {
+    frame_interval = 0;
+    return;
+  }
+
+  const uInt64 min_interval = 1000000 / max_frames_per_second;
+  int queued{0};
+
+#if defined(TIOCOUTQ)
+  if ( fsystem
+    && fsystem->ioctl (FTermios::getStdOut(), TIOCOUTQ, &queued) != 0 )
+    queued = 0;
+#endif
+
+  // Output that the terminal has not yet accepted
+  queued += int(FTermOutput::getPendingSize());
+
+  if ( queued > TERMINAL_OUTPUT_QUEUE_LIMIT
+    || write_time > min_interval )
+  {
+    uInt64 interval = std::max(frame_interval * 2, write_time);
+    interval = std::max(interval, uInt64(1000));  // at least 1 ms
+    frame_interval = std::min(interval, MAX_FRAME_INTERVAL);
+  }
+  else if ( frame_interval > min_interval )
+    frame_interval = std::max(frame_interval / 2, min_interval);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::printRange (uInt xmin, uInt xmax, uInt y)
+{
+  // Prints the changes from xmin to xmax with the fewest output bytes
+
+  if ( ! span_list )
+    return;
+
+  splitIntoSpans (xmin, xmax, y);
+  chooseSpanOutput (xmin, xmax, y);
+
+  for (auto&& span : *span_list)
+  {
+    bool min_and_not_max( span.xmin == xmin && xmin != xmax );
+    printOutputSpan (span, y, min_and_not_max);
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::splitIntoSpans (uInt xmin, uInt xmax, uInt y)
 {
-  // Line has leading whitespace
-  // => clear from xmin to beginning of line
+  // Divides the range into spans of unchanged characters, spans of
+  // equal characters and spans of different characters
 
   FTermArea*& vt = vterm;
-  auto& cb = TCAP(fc::t_clr_bol);
-  auto first_char = &vt->data[y * uInt(vt->width)];
+  auto line = &vt->data[y * uInt(vt->width)];
+  auto first_char = &line[xmin];
+  auto last_char = &line[xmax];
+  replaceNonPrintableFullwidth (xmin, first_char);
+  replaceNonPrintableFullwidth (xmax, last_char);
+  span_list->clear();
+
+  // A full-width character and its padding character form a unit
+  auto unit_end = [&line, xmax] (uInt x) -> uInt
+  {
+    if ( x < xmax
+      && line[x].attr.bit.char_width == 2
+      && line[x + 1].attr.bit.fullwidth_padding )
+      return x + 1;
+
+    return x;
+  };
 
-  if ( cb && first_char->ch == ' ' )
+  auto is_unchanged = [&line, &unit_end] (uInt x)
   {
-    uInt leading_whitespace = 1;
-    bool normal = FTerm::isNormal(first_char);
-    bool& ut = FTermcap::background_color_erase;
+    return line[x].attr.bit.no_changes
+        && line[unit_end(x)].attr.bit.no_changes;
+  };
 
-    for (uInt x{1}; x < uInt(vt->width); x++)
+  // Half-width character that can be printed without special handling
+  auto is_simple = [&line, xmin, xmax] (uInt x)
+  {
+    if ( line[x].attr.bit.no_changes
+      || line[x].attr.bit.char_width == 2
+      || line[x].attr.bit.fullwidth_padding )
+      return false;
+
+    // Covers the right half of a full-width character
+    return ! ( x == xmin && x > 0 && xmin != xmax
+            && line[x - 1].attr.bit.char_width == 2 );
+  };
+
+  auto starts_run = [&line, &is_simple, xmax] (uInt x)
+  {
+    return x < xmax
+        && is_simple(x)
+        && is_simple(x + 1)
+        && line[x] == line[x + 1];
+  };
+
+  // An equal unchanged character does not interrupt a run
+  auto continues_run = [&line, &is_simple] (uInt x)
+  {
+    const bool unchanged_simple( line[x].attr.bit.no_changes
+                              && line[x].attr.bit.char_width != 2
+                              && ! line[x].attr.bit.fullwidth_padding );
+    return ( is_simple(x) || unchanged_simple )
+        && line[x] == line[x - 1];
+  };
+
+  uInt x = xmin;
+
+  while ( x <= xmax )
+  {
+    FOutputSpan span{};
+    span.xmin = x;
+
+    if ( is_unchanged(x) )
     {
-      auto ch = &vt->data[y * uInt(vt->width) + x];
+      span.type = unchanged_span;
+      x = unit_end(x);
 
-      if ( *first_char == *ch )
-        leading_whitespace++;
-      else
-        break;
+      while ( x < xmax && is_unchanged(x + 1) )
+        x = unit_end(x + 1);
     }
+    else if ( starts_run(x) )
+    {
+      span.type = uniform_span;
+      x++;
 
-    if ( leading_whitespace > xmin
-      && (ut || normal)
-      && clr_bol_length < leading_whitespace )
+      while ( x < xmax && continues_run(x + 1) )
+        x++;
+
+      while ( line[x].attr.bit.no_changes )  // Unchanged end of the run
+        x--;
+    }
+    else
     {
-      xmin = leading_whitespace - 1;
-      return true;
+      span.type = mixed_span;
+      x = unit_end(x);
+
+      while ( x < xmax && ! is_unchanged(x + 1) && ! starts_run(x + 1) )
+        x = unit_end(x + 1);
     }
-  }
 
-  return false;
+    span.xmax = x;
+
+    for (uInt i = span.xmin; i <= span.xmax; i++)
+      span.length += getOutputLength(&line[i]);
+
+    span_list->push_back(span);
+    x++;
+  }
 }
 
 //----------------------------------------------------------------------
-bool FVTerm::canClearTrailingWS (uInt& xmax, uInt y)
+void FVTerm::chooseSpanOutput (uInt xmin, uInt xmax, uInt y)
 {
-  // Line has trailing whitespace
-  // => clear from xmax to end of line
-
+  // Selects the output with the lowest total byte cost for each span.
+  // The cursor state 0 means the cursor stands behind the last output,
+  // in the cursor state 1 it must be moved before the next output.
+  // Attribute and color changes are deliberately not part of the cost.
+  // They are the same for every output of a changed span. Only the
+  // literal output of an unchanged span can need extra attribute
+  // changes, which are rare enough to be ignored here.
+
+  static constexpr uInt64 unreachable = std::numeric_limits<uInt64>::max();
   FTermArea*& vt = vterm;
-  auto& ce = TCAP(fc::t_clr_eol);
-  auto last_char = &vt->data[(y + 1) * uInt(vt->width) - 1];
+  const uInt width = uInt(vt->width);
+  auto line = &vt->data[y * width];
+  const auto& ec = TCAP(fc::t_erase_chars);
+  const auto& rp = TCAP(fc::t_repeat_char);
+  const auto& ce = TCAP(fc::t_clr_eol);
+  const auto& cb = TCAP(fc::t_clr_bol);
+  const bool& ut = FTermcap::background_color_erase;
+  const bool last_line( y == uInt(vt->height - 1) );
+  uInt64 cost[2]{unreachable, unreachable};
+
+  if ( term_pos->getX() == int(xmin) && term_pos->getY() == int(y) )
+    cost[0] = 0;
+  else
+    cost[1] = 0;
 
-  if ( ce && last_char->ch == ' ' )
+  for (auto&& span : *span_list)
   {
-    uInt trailing_whitespace = 1;
-    bool normal = FTerm::isNormal(last_char);
-    bool& ut = FTermcap::background_color_erase;
+    auto first_char = &line[span.xmin];
+    span.cost[0] = span.cost[1] = unreachable;
 
-    for (uInt x = uInt(vt->width) - 1; x >  0 ; x--)
+    auto choose = [&span] ( int state, uInt64 total
+                          , span_output output, int previous )
     {
-      auto ch = &vt->data[y * uInt(vt->width) + x];
+      if ( total < span.cost[state] )
+      {
+        span.cost[state] = total;
+        span.choice[state] = output;
+        span.previous[state] = previous;
+      }
+    };
 
-      if ( *last_char == *ch )
-        trailing_whitespace++;
-      else
-        break;
-    }
+    // Blank characters can be erased with the background color
+    bool erasable( span.type == uniform_span
+                && first_char->ch == ' '
+                && (ut || FTerm::isNormal(first_char)) );
+    bool blank_to_eol( erasable && span.xmax == xmax );
+    bool blank_to_bol( erasable && span.xmin == xmin );
 
-    if ( trailing_whitespace > uInt(vt->width) - xmax
-      && (ut || normal)
-      && clr_bol_length < trailing_whitespace )
+    for (uInt x = span.xmax + 1; blank_to_eol && x < width; x++)
+      blank_to_eol = ( line[x] == *first_char );
+
+    for (uInt x{0}; blank_to_bol && x < span.xmin; x++)
+      blank_to_bol = ( line[x] == *first_char );
+
+    for (int state{0}; state < 2; state++)
     {
-      xmax = uInt(vt->width) - trailing_whitespace;
-      return true;
+      if ( cost[state] == unreachable )
+        continue;
+
+      const uInt64 start = cost[state] + uInt64(( state == 1 )
+                                                ? cursor_move_length : 0);
+      choose (0, start + span.length, literal_output, state);
+
+      if ( span.type == unchanged_span )
+        choose (1, cost[state], skip_output, state);
+
+      if ( span.type != uniform_span )
+        continue;
+
+      // Repeating into the lower right corner would scroll the screen
+      if ( rp && first_char->ch < 128
+        && ! (last_line && span.xmax == width - 1) )
+        choose (0, start + repeat_char_length, repeat_output, state);
+
+      if ( ec && erasable )
+        choose (1, start + erase_char_length, erase_output, state);
+
+      if ( ce && blank_to_eol )
+        choose (1, start + clr_eol_length, clr_eol_output, state);
+
+      // The cursor must stand on the last character of the span
+      if ( cb && blank_to_bol )
+        choose ( 1, cost[state] + cursor_move_length + clr_bol_length
+               , clr_bol_output, state );
     }
+
+    cost[0] = span.cost[0];
+    cost[1] = span.cost[1];
+  }
+
+  // Follow the cheapest way back to the beginning of the range
+  int state = ( cost[0] <= cost[1] ) ? 0 : 1;
+
+  for (auto iter = span_list->rbegin(); iter != span_list->rend(); ++iter)
+  {
+    iter->output = iter->choice[state];
+    state = iter->previous[state];
   }
-
-  return false;
 }
 
 //----------------------------------------------------------------------
-bool FVTerm::skipUnchangedCharacters(uInt& x, uInt xmax, uInt y)
+void FVTerm::printOutputSpan ( const FOutputSpan& span, uInt y
+                             , bool min_and_not_max )
 {
-  // Skip characters without changes if it is faster than redrawing
-
   FTermArea*& vt = vterm;
-  auto print_char = &vt->data[y * uInt(vt->width) + x];
-  print_char->attr.bit.printed = true;
+  auto line = &vt->data[y * uInt(vt->width)];
+  auto print_char = &line[span.xmin];
+  const uInt count = span.xmax - span.xmin + 1;
 
-  if ( print_char->attr.bit.no_changes )
+  switch ( span.output )
   {
-    uInt count{1};
+    case skip_output:
+      markAsPrinted (span.xmin, span.xmax, y);
+      break;
 
-    for (uInt i = x + 1; i <= xmax; i++)
-    {
-      auto ch = &vt->data[y * uInt(vt->width) + i];
+    case literal_output:
+      setTermXY (int(span.xmin), int(y));
 
-      if ( ch->attr.bit.no_changes )
-        count++;
-      else
-        break;
-    }
+      for (uInt x = span.xmin; x <= span.xmax; x++)
+      {
+        print_char = &line[x];
+        print_char->attr.bit.printed = true;
+        printCharacter (x, y, min_and_not_max && x == span.xmin, print_char);
+      }
 
-    if ( count > cursor_address_length )
-    {
-      setTermXY (int(x + count), int(y));
-      x = x + count - 1;
-      return true;
-    }
-  }
+      break;
 
-  return false;
+    case repeat_output:
+      setTermXY (int(span.xmin), int(y));
+      newFontChanges (print_char);
+      charsetChanges (print_char);
+      appendAttributes (print_char);
+      appendOutputBuffer (tparm ( TCAP(fc::t_repeat_char)
+                                , print_char->ch, count
+                                , 0, 0, 0, 0, 0, 0, 0 ));
+      term_pos->x_ref() += int(count);
+      markAsPrinted (span.xmin, span.xmax, y);
+      break;
+
+    case erase_output:
+      setTermXY (int(span.xmin), int(y));
+      appendAttributes (print_char);
+      appendOutputBuffer (tparm ( TCAP(fc::t_erase_chars), count
+                                , 0, 0, 0, 0, 0, 0, 0, 0 ));
+      markAsPrinted (span.xmin, span.xmax, y);
+      break;
+
+    case clr_eol_output:
+      setTermXY (int(span.xmin), int(y));
+      appendAttributes (print_char);
+      appendOutputBuffer (TCAP(fc::t_clr_eol));
+      markAsPrinted (span.xmin, uInt(vt->width - 1), y);
+      break;
+
+    case clr_bol_output:
+      setTermXY (int(span.xmax), int(y));
+      appendAttributes (print_char);
+      appendOutputBuffer (TCAP(fc::t_clr_bol));
+      markAsPrinted (0, span.xmax, y);
+      break;
+  }
 }
 
 //----------------------------------------------------------------------
-void FVTerm::printRange ( uInt xmin, uInt xmax, uInt y
-                        , bool draw_trailing_ws )
+uInt FVTerm::getOutputLength (const FChar* ch)
 {
-  for (uInt x = xmin; x <= xmax; x++)
+  // Returns the number of bytes for printing the character
+
+  if ( ch->attr.bit.fullwidth_padding )
+    return 0;
+
+  if ( getEncoding() != fc::UTF8 )
+    return 1;
+
+  auto utf8_length = [] (wchar_t code_point) -> uInt
   {
-    FTermArea*& vt = vterm;
-    auto& ec = TCAP(fc::t_erase_chars);
-    auto& rp = TCAP(fc::t_repeat_char);
-    auto print_char = &vt->data[y * uInt(vt->width) + x];
-    print_char->attr.bit.printed = true;
-    replaceNonPrintableFullwidth (x, print_char);
+    if ( code_point < 0x80 )
+      return 1;
+    else if ( code_point < 0x800 )
+      return 2;
+    else if ( code_point < 0x10000 )
+      return 3;
 
-    // skip character with no changes
-    if ( skipUnchangedCharacters(x, xmax, y) )
-      continue;
+    return 4;
+  };
 
-    // Erase character
-    if ( ec && print_char->ch == ' ' )
-    {
-      exit_state erase_state = \
-          eraseCharacters(x, xmax, y, draw_trailing_ws);
+  if ( FGlyphStore::isCluster(ch->ch) )
+  {
+    std::size_t length{0};
+    const wchar_t* code_points = FGlyphStore::getCodePoints(ch->ch, length);
+    uInt bytes{0};
 
-      if ( erase_state == line_completely_printed )
-        break;
-    }
-    else if ( rp )  // Repeat one character n-fold
-    {
-      repeatCharacter(x, xmax, y);
-    }
-    else  // General character output
-    {
-      bool min_and_not_max( x == xmin && xmin != xmax );
-      printCharacter (x, y, min_and_not_max, print_char);
-    }
+    for (std::size_t i{0}; i < length; i++)
+      bytes += utf8_length(code_points[i]);
+
+    return bytes;
   }
+
+  return utf8_length(ch->ch);
 }
 
 //----------------------------------------------------------------------
@@ -2512,126 +3474,6 @@ inline void FVTerm::skipPaddingCharacter ( uInt& x, uInt y
   }
 }
 
-//----------------------------------------------------------------------
-FVTerm::exit_state FVTerm::eraseCharacters ( uInt& x, uInt xmax, uInt y
-                                           , bool draw_trailing_ws )
-{
-  // Erase a number of characters to draw simple whitespaces
-
-  FTermArea*& vt = vterm;
-  auto& ec = TCAP(fc::t_erase_chars);
-  auto print_char = &vt->data[y * uInt(vt->width) + x];
-
-  if ( ! ec || print_char->ch != ' ' )
-    return not_used;
-
-  uInt whitespace{1};
-  bool normal = FTerm::isNormal(print_char);
-
-  for (uInt i = x + 1; i <= xmax; i++)
-  {
-    auto ch = &vt->data[y * uInt(vt->width) + i];
-
-    if ( *print_char == *ch )
-      whitespace++;
-    else
-      break;
-  }
-
-  if ( whitespace == 1 )
-  {
-    appendCharacter (print_char);
-    markAsPrinted (x, y);
-  }
-  else
-  {
-    uInt start_pos = x;
-    bool& ut = FTermcap::background_color_erase;
-
-    if ( whitespace > erase_char_length + cursor_address_length
-      && (ut || normal) )
-    {
-      appendAttributes (print_char);
-      appendOutputBuffer (tparm(ec, whitespace, 0, 0, 0, 0, 0, 0, 0, 0));
-
-      if ( x + whitespace - 1 < xmax || draw_trailing_ws )
-        setTermXY (int(x + whitespace), int(y));
-      else
-        return line_completely_printed;
-
-      x = x + whitespace - 1;
-    }
-    else
-    {
-      x--;
-
-      for (uInt i{0}; i < whitespace; i++, x++)
-        appendCharacter (print_char);
-    }
-
-    markAsPrinted (start_pos, x, y);
-  }
-
-  return used;
-}
-
-//----------------------------------------------------------------------
-FVTerm::exit_state FVTerm::repeatCharacter (uInt& x, uInt xmax, uInt y)
-{
-  // Repeat one character n-fold
-
-  FTermArea*& vt = vterm;
-  auto& rp = TCAP(fc::t_repeat_char);
-  auto print_char = &vt->data[y * uInt(vt->width) + x];
-
-  if ( ! rp )
-    return not_used;
-
-  uInt repetitions{1};
-
-  for (uInt i = x + 1; i <= xmax; i++)
-  {
-    auto ch = &vt->data[y * uInt(vt->width) + i];
-
-    if ( *print_char == *ch )
-      repetitions++;
-    else
-      break;
-  }
-
-  if ( repetitions == 1 )
-  {
-    appendCharacter (print_char);
-    markAsPrinted (x, y);
-  }
-  else
-  {
-    uInt start_pos = x;
-
-    if ( repetitions > repeat_char_length
-      && print_char->ch < 128 )
-    {
-      newFontChanges (print_char);
-      charsetChanges (print_char);
-      appendAttributes (print_char);
-      appendOutputBuffer (tparm(rp, print_char->ch, repetitions, 0, 0, 0, 0, 0, 0, 0));
-      term_pos->x_ref() += int(repetitions);
-      x = x + repetitions - 1;
-    }
-    else
-    {
-      x--;
-
-      for (uInt i{0}; i < repetitions; i++, x++)
-        appendCharacter (print_char);
-    }
-
-    markAsPrinted (start_pos, x, y);
-  }
-
-  return used;
-}
-
 //----------------------------------------------------------------------
 inline bool FVTerm::isFullWidthChar (FChar*& ch)
 {
@@ -2697,6 +3539,153 @@ bool FVTerm::printWrap (FTermArea* area)
   return end_of_area;
 }
 
+//----------------------------------------------------------------------
+std::size_t FVTerm::printSpan ( FTermArea* area
+                              , std::vector<FChar>::const_iterator first
+                              , std::vector<FChar>::const_iterator last )
+{
+  // Writes a run of printable single-column characters directly
+  // into the current line of the area and returns its length.
+  // Anything else is left to the character-by-character output.
+
+  const int line_len = area->width + area->right_shadow;
+  const int ax = area->cursor_x - 1;
+  const int ay = area->cursor_y - 1;
+
+  if ( area->cursor_x <= 0
+    || area->cursor_y <= 0
+    || ax >= line_len
+    || ay >= area->height + area->bottom_shadow )
+    return 0;
+
+  auto& line_changes = area->changes[ay];
+  auto ac = &area->data[ay * line_len + ax];  // area character
+  int x{ax};
+  int xmin{line_len};
+  int xmax{-1};
+  auto iter = first;
+
+  while ( iter != last && x < line_len )
+  {
+    FChar nc = *iter;  // next character
+
+    if ( nc.ch < L' ' || nc.attr.bit.fullwidth_padding )
+      break;  // Control or padding character
+
+    if ( nc.ch < L'\x7f' )  // 7-bit ASCII
+      nc.attr.bit.char_width = 1;
+    else if ( getColumnWidth(nc) != 1 )
+      break;  // Zero-width or full-width character
+
+    if ( *ac != nc )  // compare with an overloaded operator
+    {
+      updateTransCount (line_changes, *ac, nc);
+      std::memcpy (ac, &nc, sizeof(*ac));
+
+      if ( xmax < 0 )
+        xmin = x;
+
+      xmax = x;
+    }
+
+    ++ac;
+    ++x;
+    ++iter;
+  }
+
+  const auto span_len = std::size_t(x - ax);
+
+  if ( span_len == 0 )
+    return 0;
+
+  // Update the changed range of the line once
+  if ( xmax >= 0 )
+  {
+    if ( xmin < int(line_changes.xmin) )
+      line_changes.xmin = uInt(xmin);
+
+    if ( xmax > int(line_changes.xmax) )
+      line_changes.xmax = uInt(xmax);
+  }
+
+  area->cursor_x += int(span_len);
+  area->has_changes = true;
+
+  // Line break at right margin
+  if ( area->cursor_x > line_len )
+  {
+    area->cursor_x = 1;
+    area->cursor_y++;
+  }
+
+  // Prevent up scrolling
+  if ( area->cursor_y > area->height + area->bottom_shadow )
+    area->cursor_y--;
+
+  return span_len;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::combineWithPreviousCell (FTermArea* area, wchar_t ch)
+{
+  // Adds a combining character to the grapheme cluster
+  // of the character left of the cursor
+
+  const int line_len = area->width + area->right_shadow;
+  int ax = area->cursor_x - 2;
+  const int ay = area->cursor_y - 1;
+
+  if ( ax < 0 || ay < 0
+    || ax >= line_len || ay >= area->height + area->bottom_shadow )
+    return;
+
+  auto ac = &area->data[ay * line_len + ax];  // area character
+
+  if ( ac->attr.bit.fullwidth_padding && ax > 0 )
+  {
+    ac--;  // Full-width character
+    ax--;
+  }
+
+  if ( ! FGlyphStore::extendsGlyph(ac->ch, ch) )
+    return;
+
+  ac->ch = FGlyphStore::combine(ac->ch, ch);
+  ac->attr.bit.no_changes = false;
+  ac->attr.bit.printed = false;
+  area->has_changes = true;
+
+  if ( ax < int(area->changes[ay].xmin) )
+    area->changes[ay].xmin = uInt(ax);
+
+  if ( ax > int(area->changes[ay].xmax) )
+    area->changes[ay].xmax = uInt(ax);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::updateTransCount ( FLineChanges& line_changes
+                              , const FChar& ac, const FChar& nc )
+{
+  // Adjusts the number of transparent characters in a line
+  // when the area character ac is replaced by nc
+
+  if ( ( ! ac.attr.bit.transparent  && nc.attr.bit.transparent )
+    || ( ! ac.attr.bit.trans_shadow && nc.attr.bit.trans_shadow )
+    || ( ! ac.attr.bit.inherit_bg   && nc.attr.bit.inherit_bg ) )
+  {
+    // add one transparent character form line
+    line_changes.trans_count++;
+  }
+
+  if ( ( ac.attr.bit.transparent  && ! nc.attr.bit.transparent )
+    || ( ac.attr.bit.trans_shadow && ! nc.attr.bit.trans_shadow )
+    || ( ac.attr.bit.inherit_bg   && ! nc.attr.bit.inherit_bg ) )
+  {
+    // remove one transparent character from line
+    line_changes.trans_count--;
+  }
+}
+
 //----------------------------------------------------------------------
 void FVTerm::printPaddingCharacter (FTermArea* area, FChar& term_char)
 {
@@ -2736,59 +3725,53 @@ void FVTerm::updateTerminalLine (uInt y)
 
   if ( xmin <= xmax )  // Line has changes
   {
-    bool draw_leading_ws = false;
-    bool draw_trailing_ws = false;
     auto& ce = TCAP(fc::t_clr_eol);
-    auto first_char = &vt->data[y * uInt(vt->width)];
-    auto last_char  = &vt->data[(y + 1) * uInt(vt->width) - 1];
-    auto min_char   = &vt->data[y * uInt(vt->width) + xmin];
+    auto min_char = &vt->data[y * uInt(vt->width) + xmin];
 
     // Clear rest of line
-    bool is_eol_clean = canClearToEOL (xmin, y);
-
-    if ( ! is_eol_clean )
-    {
-      // leading whitespace
-      draw_leading_ws = canClearLeadingWS (xmin, y);
-
-      // trailing whitespace
-      draw_trailing_ws = canClearTrailingWS (xmax, y);
-    }
-
-    setTermXY (int(xmin), int(y));
-
-    if ( is_eol_clean )
+    if ( canClearToEOL (xmin, y) )
     {
+      setTermXY (int(xmin), int(y));
       appendAttributes (min_char);
       appendOutputBuffer (ce);
       markAsPrinted (xmin, uInt(vt->width - 1), y);
     }
     else
-    {
-      if ( draw_leading_ws )
-      {
-        auto& cb = TCAP(fc::t_clr_bol);
-        appendAttributes (first_char);
-        appendOutputBuffer (cb);
-        markAsPrinted (0, xmin, y);
-      }
+      printRange (xmin, xmax, y);
+
+    // Reset line changes
+    xmin = uInt(vt->width);
+    xmax = 0;
+  }
 
-      printRange (xmin, xmax, y, draw_trailing_ws);
+  cursorWrap();
+}
 
-      if ( draw_trailing_ws )
-      {
-        appendAttributes (last_char);
-        appendOutputBuffer (ce);
-        markAsPrinted (xmax + 1, uInt(vt->width - 1), y);
-      }
+//----------------------------------------------------------------------
+void FVTerm::updateVcsaLine (uInt y)
+{
+  // Writes pending changes from line y into the console memory
+
+  FTermArea*& vt = vterm;
+  uInt& xmin = vt->changes[y].xmin;
+  uInt& xmax = vt->changes[y].xmax;
+
+  if ( xmin <= xmax )  // Line has changes
+  {
+    auto min_char = &vt->data[y * uInt(vt->width) + xmin];
+
+    if ( FTermVcsa::write (xmin, y, min_char, xmax - xmin + 1) )
+      markAsPrinted (xmin, xmax, y);
+    else
+    {
+      printRange (xmin, xmax, y);
+      cursorWrap();
     }
 
     // Reset line changes
     xmin = uInt(vt->width);
     xmax = 0;
   }
-
-  cursorWrap();
 }
 
 //----------------------------------------------------------------------
@@ -2845,6 +3828,71 @@ inline bool FVTerm::isTermSizeChanged()
   return false;
 }
 
+//----------------------------------------------------------------------
+bool FVTerm::isOutputReady()
+{
+  // Back-pressure of the non-blocking terminal output
+
+  if ( ! FTermOutput::hasPendingData() )
+    return true;
+
+  FTermOutput::write();
+
+  if ( ! FTermOutput::isOverloaded() )
+    return true;
+
+  // Outdated frames are replaced by one frame with all changes
+  if ( FTermOutput::discardFrames() )
+    invalidateTerminal();
+
+  return ! FTermOutput::isOverloaded();
+}
+
+//----------------------------------------------------------------------
+void FVTerm::invalidateTerminal()
+{
+  // After discarded frames, the terminal content, the cursor position
+  // and the attributes are unknown
+
+  for (int y{0}; y < vterm->height; y++)
+  {
+    auto line = &vterm->data[y * vterm->width];
+
+    for (int x{0}; x < vterm->width; x++)
+    {
+      line[x].attr.bit.no_changes = false;
+      line[x].attr.bit.printed = false;
+    }
+
+    vterm->changes[y].xmin = 0;
+    vterm->changes[y].xmax = uInt(vterm->width - 1);
+  }
+
+  vterm->has_changes = true;
+  term_pos->setPoint(-1, -1);
+
+  // The whole terminal is redrawn, moving lines is pointless
+  scroll_list->clear();
+
+  if ( TCAP(fc::t_exit_attribute_mode) )
+  {
+    appendOutputBuffer (TCAP(fc::t_exit_attribute_mode));
+    term_attribute.fg_color     = fc::Default;
+    term_attribute.bg_color     = fc::Default;
+    term_attribute.attr.byte[0] = 0;
+    term_attribute.attr.byte[1] = 0;
+  }
+
+  // The next cursor update sets the visibility again
+  auto data = getFTerm().getFTermData();
+
+  if ( data )
+  {
+    data->setCursorHidden (false);
+    hideCursor();
+  }
+}
+
 //----------------------------------------------------------------------
 inline void FVTerm::markAsPrinted (uInt pos, uInt line)
 {
@@ -2881,12 +3929,15 @@ inline void FVTerm::newFontChanges (FChar*& next_char)
 //----------------------------------------------------------------------
 inline void FVTerm::charsetChanges (FChar*& next_char)
 {
-  wchar_t& ch = next_char->ch;
-  next_char->encoded_char = ch;
+  next_char->encoded_char = next_char->ch;
 
   if ( getEncoding() == fc::UTF8 )
     return;
 
+  // Without unicode only the base character of a cluster is shown
+  const wchar_t ch = FGlyphStore::getBaseCharacter(next_char->ch);
+  next_char->encoded_char = ch;
+
   wchar_t ch_enc = FTerm::charEncode(ch);
 
   if ( ch_enc == ch )
@@ -2944,7 +3995,19 @@ inline void FVTerm::appendChar (FChar*& next_char)
   charsetChanges (next_char);
   appendAttributes (next_char);
   characterFilter (next_char);
-  appendOutputBuffer (next_char->encoded_char);
+
+  if ( FGlyphStore::isCluster(next_char->encoded_char) )
+  {
+    // Write all code points of the grapheme cluster
+    std::size_t length{0};
+    const wchar_t* code_points = \
+        FGlyphStore::getCodePoints(next_char->encoded_char, length);
+
+    for (std::size_t i{0}; i < length; i++)
+      appendOutputBuffer (code_points[i]);
+  }
+  else
+    appendOutputBuffer (next_char->encoded_char);
 }
 
 //----------------------------------------------------------------------
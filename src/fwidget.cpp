@@ -24,6 +24,7 @@
 
 #include "final/fapplication.h"
 #include "final/fevent.h"
+#include "final/fglyphstore.h"
 #include "final/fmenubar.h"
 #include "final/fstatusbar.h"
 #include "final/fstring.h"
@@ -51,6 +52,7 @@ FWidgetColors         FWidget::wcolors{};
 bool                  FWidget::init_desktop{false};
 bool                  FWidget::hideable{false};
 uInt                  FWidget::modal_dialog_counter{};
+uInt                  FWidget::backing_store_generation{0};
 
 //----------------------------------------------------------------------
 // class FWidget
@@ -97,6 +99,7 @@ FWidget::FWidget (FWidget* parent, bool disable_alt_screen)
     double_flatline_mask.right.resize (getHeight(), false);
     double_flatline_mask.bottom.resize (getWidth(), false);
     double_flatline_mask.left.resize (getHeight(), false);
+    parent->invalidate();  // The parent gets a new child
   }
 }
 
@@ -132,6 +135,17 @@ FWidget::~FWidget()  // destructor
 
   accelerator_list.clear();
 
+  // The parent no longer contains the cells of this widget.
+  // Child widgets are deleted after this destructor.
+  auto parent = getParentWidget();
+
+  if ( parent && ! backing_store.orphaned )
+    parent->invalidate();
+
+  for (auto&& child : getChildren())
+    if ( child->isWidget() )
+      static_cast<FWidget*>(child)->backing_store.orphaned = true;
+
   // finish the program
   if ( rootObject == this )
     finish();
@@ -267,6 +281,9 @@ bool FWidget::setVisible (bool enable)
 //----------------------------------------------------------------------
 bool FWidget::setEnable (bool enable)
 {
+  if ( bool(flags.active) != enable )
+    invalidate();
+
   return (flags.active = enable);
 }
 
@@ -295,9 +312,32 @@ bool FWidget::setFocus (bool enable)
 
   // Set status bar text for widget focus
   setStatusbarText (enable);
+  invalidate();
   return (flags.focus = enable);
 }
 
+//----------------------------------------------------------------------
+bool FWidget::setBackingStore (bool enable)
+{
+  // Keeps a copy of the drawn character cells of the widget and its
+  // children. A redraw of an unchanged widget only copies these cells
+  // back into the print area instead of drawing the widget again.
+  // The widget mutators call invalidate() on a state change. Derived
+  // widgets with their own state have to do the same.
+
+  if ( isRootWidget() || isWindowWidget() )  // Have their own area
+    enable = false;
+
+  if ( ! enable )
+  {
+    std::vector<FChar>().swap(backing_store.data);
+    backing_store.area = nullptr;
+  }
+
+  backing_store.dirty = true;
+  return (flags.backing_store = enable);
+}
+
 //----------------------------------------------------------------------
 void FWidget::setColor()
 {
@@ -317,6 +357,8 @@ void FWidget::setX (int x, bool adjust)
   wsize.setX(x);
   adjust_wsize.setX(x);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 }
@@ -333,6 +375,8 @@ void FWidget::setY (int y, bool adjust)
   wsize.setY(y);
   adjust_wsize.setY(y);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 }
@@ -360,6 +404,8 @@ void FWidget::setPos (const FPoint& p, bool adjust)
   wsize.setPos(pos);
   adjust_wsize.setPos(pos);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 }
@@ -379,6 +425,8 @@ void FWidget::setWidth (std::size_t width, bool adjust)
   wsize.setWidth(width);
   adjust_wsize.setWidth(width);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 
@@ -401,6 +449,8 @@ void FWidget::setHeight (std::size_t height, bool adjust)
   wsize.setHeight(height);
   adjust_wsize.setHeight(height);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 
@@ -433,6 +483,8 @@ void FWidget::setSize (const FSize& size, bool adjust)
   adjust_wsize.setWidth(width);
   adjust_wsize.setHeight(height);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 
@@ -585,6 +637,8 @@ void FWidget::setGeometry (const FPoint& p, const FSize& s, bool adjust)
   double_flatline_mask.bottom.resize (getWidth(), false);
   double_flatline_mask.left.resize (getHeight(), false);
 
+  invalidate();
+
   if ( adjust )
     adjustSize();
 }
@@ -665,6 +719,8 @@ void FWidget::setDoubleFlatLine (fc::sides side, bool bit)
       double_flatline_mask.left.assign(length, bit);
       break;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -714,6 +770,8 @@ void FWidget::setDoubleFlatLine (fc::sides side, int pos, bool bit)
 
       break;
   }
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -862,7 +920,7 @@ void FWidget::delCallbacks()
 }
 
 //----------------------------------------------------------------------
-void FWidget::emitCallback (const FString& emit_signal)
+void FWidget::emitCallback (const FStringView& emit_signal)
 {
   // Initiate callback for the given signal
 
@@ -934,16 +992,23 @@ void FWidget::redraw()
     // clean desktop
     setColor (wcolors.term_fg, wcolors.term_bg);
     clearArea (getVirtualDesktop());
+    // All saved character cells are outdated
+    backing_store_generation++;
   }
   else if ( ! isShown() )
     return;
 
-  draw();
+  if ( ! restoreBackingStore() )
+  {
+    draw();
 
-  if ( isRootWidget() )
-    drawWindows();
-  else
-    drawChildren();
+    if ( isRootWidget() )
+      drawWindows();
+    else
+      drawChildren();
+
+    saveBackingStore();
+  }
 
   if ( isRootWidget() )
     finishTerminalUpdate();
@@ -956,6 +1021,25 @@ void FWidget::redraw()
   }
 }
 
+//----------------------------------------------------------------------
+void FWidget::invalidate()
+{
+  // Marks the widget as changed. The parent widgets up to the
+  // window contain its character cells and are marked as well.
+
+  auto widget = this;
+
+  while ( widget )
+  {
+    widget->backing_store.dirty = true;
+
+    if ( widget->isWindowWidget() )  // A window has its own area
+      break;
+
+    widget = widget->getParentWidget();
+  }
+}
+
 //----------------------------------------------------------------------
 void FWidget::resize()
 {
@@ -1009,6 +1093,7 @@ void FWidget::show()
     show_root_widget = this;
   }
 
+  invalidate();
   draw();
   flags.hidden = false;
   flags.shown = true;
@@ -1045,6 +1130,7 @@ void FWidget::hide()
   // Hide the widget
 
   flags.hidden = true;
+  invalidate();
 
   if ( isVisible() )
   {
@@ -1510,6 +1596,9 @@ bool FWidget::focusPrevChild()
 //----------------------------------------------------------------------
 bool FWidget::event (FEvent* ev)
 {
+  // An event handler can change the widget content
+  invalidate();
+
   switch ( uInt(ev->type()) )
   {
     case fc::KeyPress_Event:
@@ -1975,6 +2064,74 @@ void FWidget::drawChildren()
   }
 }
 
+//----------------------------------------------------------------------
+FRect FWidget::getBackingStoreBox (const FTermArea* area) const
+{
+  // Widget geometry with shadow relative to the print area
+  const FPoint pos ( getTermX() - area->offset_left
+                   , getTermY() - area->offset_top );
+  return FRect(pos, getSize() + getShadow());
+}
+
+//----------------------------------------------------------------------
+bool FWidget::restoreBackingStore()
+{
+  // Copies the saved character cells of an unchanged widget
+  // back into the print area. A widget that was asked directly
+  // to redraw itself is always drawn again.
+
+  if ( ! flags.backing_store
+    || backing_store.dirty
+    || redraw_root_widget == this
+    || backing_store.data.empty()
+    || isRootWidget()
+    || isWindowWidget() )
+    return false;
+
+  auto area = getPrintArea();
+
+  if ( ! area
+    || area != backing_store.area
+    || backing_store.generation != backing_store_generation
+    || backing_store.glyph_generation != FGlyphStore::getGeneration()
+    || getBackingStoreBox(area) != backing_store.box )
+    return false;
+
+  restoreAreaRegion (area, backing_store.box, backing_store.data);
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FWidget::saveBackingStore()
+{
+  // The widget is drawn now. Its parent widgets contain
+  // the new cells and must not restore their saved cells.
+
+  auto parent = getParentWidget();
+
+  if ( parent && ! isWindowWidget() )
+    parent->invalidate();
+
+  backing_store.dirty = false;
+
+  if ( ! flags.backing_store || isRootWidget() || isWindowWidget() )
+    return;
+
+  auto area = getPrintArea();
+
+  if ( ! area )
+  {
+    backing_store.dirty = true;
+    return;
+  }
+
+  backing_store.area = area;
+  backing_store.box = getBackingStoreBox(area);
+  backing_store.generation = backing_store_generation;
+  backing_store.glyph_generation = FGlyphStore::getGeneration();
+  saveAreaRegion (area, backing_store.box, backing_store.data);
+}
+
 //----------------------------------------------------------------------
 void FWidget::setColorTheme()
 {
@@ -1117,6 +1117,11 @@ enum termcaps
   t_cursor_style,
   t_scroll_forward,
   t_scroll_reverse,
+  t_change_scroll_region,
+  t_parm_index,
+  t_parm_rindex,
+  t_set_lr_margin,
+  t_clear_margins,
   t_enter_ca_mode,
   t_exit_ca_mode,
   t_enable_acs,
@@ -48,6 +48,19 @@ extern const std::size_t lastCP437Item;
 extern const wchar_t halfWidth_fullWidth[][2];
 extern const std::size_t lastHalfWidthItem;
 
+// Constant-time lookup of a table row (returns -1 if not found)
+int getCharacterItem (wchar_t);     // by character[][UTF8]
+int getCP437Item (uChar);           // by cp437_ucs[][0]
+int getCP437UnicodeItem (wchar_t);  // by cp437_ucs[][1]
+int getHalfWidthItem (wchar_t);     // by halfWidth_fullWidth[][0]
+int getFullWidthItem (wchar_t);     // by halfWidth_fullWidth[][1]
+
+// Column width (0, 1 or 2) from the built-in unicode table
+int getCharacterWidth (wchar_t);
+
+// Combining mark (Mn, Me) or zero width joiner
+bool isCombiningCharacter (wchar_t);
+
 }  // namespace fc
 
 }  // namespace finalcut
@@ -125,8 +125,9 @@ class FFileDialog : public FDialog
     bool                 setShowHiddenFiles();
     bool                 unsetShowHiddenFiles();
 
-    // Event handler
+    // Event handlers
     void                 onKeyPress (FKeyEvent*) override;
+    void                 onTimer (FTimerEvent*) override;
 
     // Methods
     static const FString fileOpenChooser ( FWidget*
@@ -145,6 +146,8 @@ class FFileDialog : public FDialog
     struct dir_entry
     {
       char* name;
+      // Case-folded name prefix for sorting
+      uInt64 sort_key;
       // Type of file
       uChar fifo             : 1;
       uChar character_device : 1;
@@ -162,13 +165,20 @@ class FFileDialog : public FDialog
     void                 init();
     void                 widgetSettings (const FPoint&);
     void                 initCallbacks();
-    bool                 pattern_match (const char* const, char[]);
+    bool                 pattern_match (const char* const, const char[]);
+    void                 compileFilter();
+    bool                 matchFilter (const char[]);
+    static uInt64        getSortKey (const char* const);
     void                 clear();
-    sInt64               numOfDirs();
     void                 sortDir();
     int                  readDir();
+    bool                 readDirEntries();
+    int                  finishReadDir();
+    void                 stopReadDir();
     void                 getEntry (const char* const, struct dirent*);
+    void                 getEntryType (const char* const, dir_entry&);
     void                 followSymLink (const char* const, dir_entry&);
+    void                 showDirEntries();
     void                 dirEntriesToList();
     void                 selectDirectoryEntry (const char* const);
     int                  changeDir (const FString&);
@@ -187,21 +197,28 @@ class FFileDialog : public FDialog
     static FSystem*  fsystem;
     DIR*             directory_stream{nullptr};
     dirEntries       dir_entries{};
+    dirEntries       scan_entries{};
     FString          directory{};
+    FString          select_entry{};
     FString          filter_pattern{};
+    std::string      filter_glob{};
     FLineEdit        filename{this};
     FListBox         filebrowser{this};
     FCheckBox        hidden_check{this};
     FButton          cancel_btn{this};
     FButton          open_btn{this};
     DialogType       dlg_type{FFileDialog::Open};
+    int              scan_timer_id{0};
     bool             show_hidden{false};
+    bool             filter_is_suffix{false};
 
     // Friend functions
     friend bool sortByName ( const FFileDialog::dir_entry&
                            , const FFileDialog::dir_entry& );
     friend bool sortDirFirst ( const FFileDialog::dir_entry&
                              , const FFileDialog::dir_entry& );
+    friend bool sortDirEntries ( const FFileDialog::dir_entry&
+                               , const FFileDialog::dir_entry& );
     friend const FString fileChooser ( FWidget*
                                      , const FString&
                                      , const FString&
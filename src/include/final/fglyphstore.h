@@ -0,0 +1,172 @@
+/***********************************************************************
+* fglyphstore.h - Interned storage for grapheme clusters               *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FGlyphStore ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  A glyph is the content of one character cell (FChar::ch).
+ *  Single code points are stored inline. A grapheme cluster of
+ *  several code points (base character + combining marks, variation
+ *  selectors or zero width joiner sequences) is interned and
+ *  represented by an id outside of the unicode range. Identical
+ *  clusters share the same id, so glyphs remain comparable as
+ *  integers.
+ */
+
+#ifndef FGLYPHSTORE_H
+#define FGLYPHSTORE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cwchar>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "final/fcharmap.h"
+#include "final/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FGlyphStore
+//----------------------------------------------------------------------
+
+class FGlyphStore final
+{
+  public:
+    // Constructors
+    FGlyphStore() = default;
+
+    // Destructor
+    ~FGlyphStore() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static const wchar_t* getCodePoints (wchar_t, std::size_t&);
+    static wchar_t        getBaseCharacter (wchar_t);
+    static std::wstring   getString (wchar_t);
+    static std::size_t    getCount();
+    static std::size_t    getArenaSize();
+    static uInt           getGeneration();
+
+    // Inquiries
+    static bool           isCluster (wchar_t);
+    static bool           isExtendingCharacter (wchar_t);
+    static bool           extendsGlyph (wchar_t, wchar_t);
+
+    // Methods
+    static wchar_t        intern (const wchar_t[], std::size_t);
+    static wchar_t        combine (wchar_t, wchar_t);
+    static void           startCompaction();
+    static wchar_t        relocate (wchar_t);
+    static void           finishCompaction();
+    static void           clear();
+
+  private:
+    // Typedefs
+    typedef struct
+    {
+      std::size_t offset;  // Position in the arena
+      std::size_t length;  // Number of code points
+    } FGlyphEntry;
+
+    typedef struct
+    {
+      std::vector<wchar_t> arena{};
+      std::vector<FGlyphEntry> entries{};
+      std::unordered_multimap<std::size_t, std::size_t> lookup{};
+    } FGlyphStorage;
+
+    // Constants
+#if WCHAR_MAX > 0xffff
+    static constexpr uInt FIRST_ID = 0x200000;  // Beyond unicode
+    static constexpr uInt MAX_COUNT = 0x1000000;
+#else
+    // A 16-bit wchar_t (e.g. on Cygwin) has no room beyond unicode.
+    // The surrogate code points never occur alone in a cell.
+    static constexpr uInt FIRST_ID = 0xd800;
+    static constexpr uInt MAX_COUNT = 0x800;
+#endif
+    static constexpr wchar_t ZERO_WIDTH_JOINER = L'\x200d';
+
+    // Methods
+    static std::size_t    hash (const wchar_t[], std::size_t);
+    static const wchar_t* getCodePoints ( const FGlyphStorage&
+                                        , wchar_t, std::size_t& );
+
+    // Data members
+    static FGlyphStorage  storage;
+    static FGlyphStorage  old_storage;  // During compaction
+    static uInt           generation;   // Changes when ids are reassigned
+};
+
+
+// FGlyphStore inline functions
+//----------------------------------------------------------------------
+inline const FString FGlyphStore::getClassName() const
+{ return "FGlyphStore"; }
+
+//----------------------------------------------------------------------
+inline const wchar_t* FGlyphStore::getCodePoints ( wchar_t glyph
+                                                 , std::size_t& length )
+{ return getCodePoints (storage, glyph, length); }
+
+//----------------------------------------------------------------------
+inline std::size_t FGlyphStore::getCount()
+{ return storage.entries.size(); }
+
+//----------------------------------------------------------------------
+inline std::size_t FGlyphStore::getArenaSize()
+{ return storage.arena.size(); }
+
+//----------------------------------------------------------------------
+inline uInt FGlyphStore::getGeneration()
+{ return generation; }
+
+//----------------------------------------------------------------------
+inline bool FGlyphStore::isCluster (wchar_t glyph)
+{ return uInt(glyph) - FIRST_ID < MAX_COUNT; }
+
+//----------------------------------------------------------------------
+inline bool FGlyphStore::isExtendingCharacter (wchar_t ch)
+{
+  // Combining marks (including the variation selectors), the zero
+  // width joiner and emoji skin tone modifiers extend the previous
+  // character. Other characters of width 0 (e.g. U+200B) stand alone.
+  // The modifiers are beyond the range of a 16-bit wchar_t.
+
+  return fc::isCombiningCharacter(ch)
+      || ( uInt(ch) >= 0x1f3fb && uInt(ch) <= 0x1f3ff );
+}
+
+}  // namespace finalcut
+
+#endif  // FGLYPHSTORE_H
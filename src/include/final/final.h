@@ -38,6 +38,7 @@
 #include <final/fcolorpair.h>
 #include <final/fcombobox.h>
 #include <final/fcharmap.h>
+#include <final/fglyphstore.h>
 #include <final/fcheckbox.h>
 #include <final/fcheckmenuitem.h>
 #include <final/fdialog.h>
@@ -68,6 +69,7 @@
 #include <final/fstartoptions.h>
 #include <final/fstatusbar.h>
 #include <final/fstring.h>
+#include <final/fstringview.h>
 #include <final/fswitch.h>
 #include <final/fsystem.h>
 #include <final/fterm.h>
@@ -77,11 +79,18 @@
 #include <final/ftermdata.h>
 #include <final/ftermdebugdata.h>
 #include <final/ftermdetection.h>
+#include <final/ftermquery.h>
+#include <final/ftermcache.h>
+#include <final/ftermemulator.h>
+#include <final/ftermheadless.h>
+#include <final/ftermvcsa.h>
+#include <final/ftermoutput.h>
 #include <final/ftermios.h>
 #include <final/ftermxterminal.h>
 #include <final/ftextview.h>
 #include <final/ftogglebutton.h>
 #include <final/ftooltip.h>
+#include <final/ftruecolor.h>
 #include <final/ftypes.h>
 #include <final/fvterm.h>
 #include <final/fwidgetcolors.h>
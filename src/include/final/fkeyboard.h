@@ -122,7 +122,7 @@ class FKeyboard final
     // Methods
     static void           init();
     bool&                 unprocessedInput();
-    bool                  isKeyPressed();
+    bool                  isKeyPressed (uInt64 = 100000);
     void                  clearKeyBuffer();
     void                  clearKeyBufferOnTimeout();
     void                  fetchKeyCode();
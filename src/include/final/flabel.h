@@ -135,7 +135,7 @@ class FLabel : public FWidget
     void                draw() override;
     void                drawMultiLine();
     void                drawSingleLine();
-    void                printLine (FString&&);
+    void                printLine (const FString&);
 
     // Data members
     FStringList         multiline_text{};
@@ -181,7 +181,10 @@ inline FString& FLabel::getText()
 
 //----------------------------------------------------------------------
 inline bool FLabel::setEmphasis (bool enable)
-{ return (emphasis = enable); }
+{
+  invalidate();
+  return (emphasis = enable);
+}
 
 //----------------------------------------------------------------------
 inline bool FLabel::setEmphasis()
@@ -193,7 +196,10 @@ inline bool FLabel::unsetEmphasis()
 
 //----------------------------------------------------------------------
 inline bool FLabel::setReverseMode (bool enable)
-{ return (reverse_mode = enable); }
+{
+  invalidate();
+  return (reverse_mode = enable);
+}
 
 //----------------------------------------------------------------------
 inline bool FLabel::setReverseMode()
@@ -233,7 +239,10 @@ inline bool FLabel::hasReverseMode()
 
 //----------------------------------------------------------------------
 inline void FLabel::clear()
-{ text.clear(); }
+{
+  text.clear();
+  invalidate();
+}
 
 }  // namespace finalcut
 
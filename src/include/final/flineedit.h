@@ -186,8 +186,8 @@ class FLineEdit : public FWidget
     std::size_t         getCursorColumnPos();
     const FString       getPasswordText() const;
     bool                isPasswordField() const;
-    offsetPair          endPosToOffset (std::size_t);
-    std::size_t         clickPosToCursorPos (std::size_t);
+    offsetPair          endPosToOffset (std::size_t) const;
+    std::size_t         clickPosToCursorPos (std::size_t) const;
     void                adjustTextOffset();
     void                cursorLeft();
     void                cursorRight();
@@ -48,6 +48,7 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -72,6 +73,7 @@ class FListBoxItem
     // Constructors
     FListBoxItem ();
     FListBoxItem (const FListBoxItem&);  // copy constructor
+    FListBoxItem (FListBoxItem&&) noexcept;  // move constructor
     explicit FListBoxItem (const FString&, FDataPtr = nullptr);
 
     // Destructor
@@ -79,6 +81,7 @@ class FListBoxItem
 
     // Assignment operator (=)
     FListBoxItem& operator = (const FListBoxItem&);
+    FListBoxItem& operator = (FListBoxItem&&) noexcept;
 
     // Accessors
     virtual const FString getClassName() const;
@@ -88,6 +91,10 @@ class FListBoxItem
     // Mutators
     void                  setText (const FString&);
     void                  setData (FDataPtr);
+    void                  setBrackets (fc::brackets_type);
+
+    // Inquiry
+    bool                  isSelected() const;
 
     // Methods
     void                  clear();
@@ -125,6 +132,14 @@ inline void FListBoxItem::setText (const FString& txt)
 inline void FListBoxItem::setData (FDataPtr data)
 { data_pointer = data; }
 
+//----------------------------------------------------------------------
+inline void FListBoxItem::setBrackets (fc::brackets_type b)
+{ brackets = b; }
+
+//----------------------------------------------------------------------
+inline bool FListBoxItem::isSelected() const
+{ return selected; }
+
 //----------------------------------------------------------------------
 inline void FListBoxItem::clear()
 { text.clear(); }
@@ -166,6 +181,7 @@ class FListBox : public FWidget
     const FListBoxItem& getItem (std::size_t) const;
     FListBoxItem&       getItem (listBoxItems::iterator);
     const FListBoxItem& getItem (listBoxItems::const_iterator) const;
+    FListBoxItem        getRowItem (std::size_t) const;
     std::size_t         currentItem() const;
     FString&            getText();
 
@@ -187,6 +203,9 @@ class FListBox : public FWidget
     void                unsetMultiSelection ();
     bool                setDisable() override;
     void                setText (const FString&);
+    template <typename RowProvider>
+    void                setRowProvider (std::size_t, RowProvider);
+    void                setRowCount (std::size_t);
 
     // Inquiries
     bool                isSelected (std::size_t);
@@ -202,6 +221,8 @@ class FListBox : public FWidget
     template <typename Container, typename LazyConverter>
     void                insert (Container, LazyConverter);
     void                insert (FListBoxItem);
+    void                insert ( listBoxItems::iterator
+                               , listBoxItems::iterator );
     template <typename T>
     void                insert ( const std::initializer_list<T>& list
                                , fc::brackets_type = fc::NoBrackets
@@ -237,13 +258,15 @@ class FListBox : public FWidget
     typedef std::unordered_map<int, std::function<void()>> keyMap;
     typedef std::unordered_map<int, std::function<bool()>> keyMapResult;
     typedef std::function<void(FListBoxItem&, FDataPtr, int)> lazyInsert;
+    typedef std::function<void(FListBoxItem&, std::size_t)> rowProvider;
 
     // Enumeration
     enum convert_type
     {
       no_convert     = 0,
       direct_convert = 1,
-      lazy_convert   = 2
+      lazy_convert   = 2,
+      virtual_rows   = 3
     };
 
     // Accessors
@@ -301,11 +324,16 @@ class FListBox : public FWidget
     bool                changeSelectionAndPosition();
     bool                deletePreviousCharacter();
     bool                keyIncSearchInput (FKey);
+    std::size_t         findIncSearchItem();
     void                processClick();
     void                processSelect();
     void                processChanged();
     void                changeOnResize();
     void                lazyConvert (listBoxItems::iterator, int);
+    void                loadRows (std::size_t);
+    std::size_t         loadPage (std::size_t) const;
+    FListBoxItem&       getRow (std::size_t) const;
+    void                setRowSelection (std::size_t, bool);
     listBoxItems::iterator index2iterator (std::size_t);
     listBoxItems::const_iterator index2iterator (std::size_t index) const;
     // Callback methods
@@ -314,9 +342,12 @@ class FListBox : public FWidget
 
     // Function Pointer
     lazyInsert      lazy_inserter{};
+    rowProvider     row_provider{};
 
     // Data members
-    listBoxItems    itemlist{};
+    mutable listBoxItems itemlist{};   // The page in virtual mode
+    mutable FListBoxItem row_item{};   // getItem() row in virtual mode
+    std::set<std::size_t> selected_rows{};  // Selection in virtual mode
     FDataPtr        source_container{nullptr};
     FScrollbarPtr   vbar{nullptr};
     FScrollbarPtr   hbar{nullptr};
@@ -336,6 +367,8 @@ class FListBox : public FWidget
     std::size_t     current{0};
     std::size_t     nf_offset{0};
     std::size_t     max_line_width{0};
+    std::size_t     row_count{0};
+    mutable std::size_t row_offset{0};
     bool            multi_select{false};
     bool            mouse_select{false};
     bool            scroll_timer{false};
@@ -378,11 +411,14 @@ inline const FString FListBox::getClassName() const
 
 //----------------------------------------------------------------------
 inline std::size_t FListBox::getCount() const
-{ return itemlist.size(); }
+{ return ( conv_type == virtual_rows ) ? row_count : itemlist.size(); }
 
 //----------------------------------------------------------------------
 inline FListBoxItem& FListBox::getItem (std::size_t index)
 {
+  if ( conv_type == virtual_rows )
+    return getRow(index - 1);
+
   listBoxItems::iterator iter = index2iterator(index - 1);
   return *iter;
 }
@@ -390,6 +426,9 @@ inline FListBoxItem& FListBox::getItem (std::size_t index)
 //----------------------------------------------------------------------
 inline const FListBoxItem& FListBox::getItem (std::size_t index) const
 {
+  if ( conv_type == virtual_rows )
+    return getRow(index - 1);
+
   listBoxItems::const_iterator iter = index2iterator(index - 1);
   return *iter;
 }
@@ -412,19 +451,25 @@ inline FString& FListBox::getText()
 
 //----------------------------------------------------------------------
 inline void FListBox::selectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = true; }
+{ setRowSelection (index - 1, true); }
 
 //----------------------------------------------------------------------
 inline void FListBox::selectItem (listBoxItems::iterator iter)
-{ iter->selected = true; }
+{
+  setRowSelection ( std::size_t(std::distance(itemlist.begin(), iter))
+                    + row_offset, true );
+}
 
 //----------------------------------------------------------------------
 inline void FListBox::unselectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = false; }
+{ setRowSelection (index - 1, false); }
 
 //----------------------------------------------------------------------
 inline void FListBox::unselectItem (listBoxItems::iterator iter)
-{ iter->selected = false; }
+{
+  setRowSelection ( std::size_t(std::distance(itemlist.begin(), iter))
+                    + row_offset, false );
+}
 
 //----------------------------------------------------------------------
 inline void FListBox::showNoBrackets (std::size_t index)
@@ -452,7 +497,12 @@ inline bool FListBox::setDisable()
 
 //----------------------------------------------------------------------
 inline bool FListBox::isSelected (std::size_t index)
-{ return index2iterator(index - 1)->selected; }
+{
+  if ( conv_type == virtual_rows )
+    return selected_rows.count(index - 1) > 0;
+
+  return index2iterator(index - 1)->selected;
+}
 
 //----------------------------------------------------------------------
 inline bool FListBox::isSelected (listBoxItems::iterator iter) const
@@ -474,25 +524,59 @@ inline bool FListBox::hasBrackets(listBoxItems::iterator iter) const
 inline void FListBox::reserve (std::size_t new_cap)
 { itemlist.reserve(new_cap); }
 
+//----------------------------------------------------------------------
+template <typename RowProvider>
+void FListBox::setRowProvider (std::size_t count, RowProvider provider)
+{
+  // Virtual mode: only the visible rows are held as list items.
+  // The selection is kept as a set of row numbers. getRowItem()
+  // returns a copy of a row, getItem() a copy that remains valid
+  // until the next getItem() call. Changes to a copy are not kept.
+
+  clear();
+  conv_type = virtual_rows;
+  row_provider = provider;
+  setRowCount (count);
+}
+
 //----------------------------------------------------------------------
 template <typename Iterator, typename InsertConverter>
 inline void FListBox::insert ( Iterator first
                              , Iterator last
                              , InsertConverter convert )
 {
+  if ( conv_type == virtual_rows )  // The rows come from the provider
+    return;
+
   conv_type = direct_convert;
+  itemlist.reserve (itemlist.size() + std::size_t(std::distance(first, last)));
+  std::size_t max_width{0};
 
   while ( first != last )
   {
-    insert (convert(first), fc::NoBrackets, false, &(*first));
+    itemlist.emplace_back (FString() << convert(first), &(*first));
+    std::size_t column_width = getColumnWidth(itemlist.back().text);
+
+    if ( column_width > max_width )
+      max_width = column_width;
+
     ++first;
   }
+
+  if ( current == 0 && ! itemlist.empty() )
+    current = 1;
+
+  recalculateHorizontalBar (max_width, false);
+  recalculateVerticalBar (getCount());
 }
 
 //----------------------------------------------------------------------
 template <typename Container, typename LazyConverter>
 void FListBox::insert (Container container, LazyConverter convert)
 {
+  if ( conv_type == virtual_rows )  // The rows come from the provider
+    return;
+
   conv_type = lazy_convert;
   source_container = container;
   lazy_inserter = convert;
@@ -545,8 +629,13 @@ inline bool FListBox::isVerticallyScrollable()
 inline FListBox::listBoxItems::iterator \
     FListBox::index2iterator (std::size_t index)
 {
+  // In virtual mode itemlist starts with row row_offset
+  if ( conv_type == virtual_rows
+    && ( index < row_offset || index >= row_offset + itemlist.size() ) )
+    loadRows (index);
+
   listBoxItems::iterator iter = itemlist.begin();
-  std::advance (iter, index);
+  std::advance (iter, index - row_offset);
   return iter;
 }
 
@@ -554,8 +643,13 @@ inline FListBox::listBoxItems::iterator \
 inline FListBox::listBoxItems::const_iterator \
     FListBox::index2iterator (std::size_t index) const
 {
+  // In virtual mode itemlist starts with row row_offset
+  if ( conv_type == virtual_rows
+    && ( index < row_offset || index >= row_offset + itemlist.size() ) )
+    loadPage (index);
+
   listBoxItems::const_iterator iter = itemlist.begin();
-  std::advance (iter, index);
+  std::advance (iter, index - row_offset);
   return iter;
 }
 
@@ -108,6 +108,19 @@ class FListViewItem : public FObject
     void                collapse();
 
   private:
+    // Typedef
+    typedef struct
+    {
+      FString     text{};             // Visible part of the line
+      std::size_t xoffset{0};
+      std::size_t width{0};
+      uInt        header_revision{0};
+      uInt        revision{0};
+      uInt        depth{0};
+      uInt8       state{0};           // Tree view and check box flags
+      bool        valid{false};
+    } FLineLayout;
+
     // Inquiry
     bool                isExpandable() const;
     bool                isCheckable() const;
@@ -119,12 +132,15 @@ class FListViewItem : public FObject
     void                replaceControlCodes();
     std::size_t         getVisibleLines();
     void                resetVisibleLineCounter();
+    void                invalidateListView() const;
 
     // Data members
     FStringList         column_list{};
     FDataPtr            data_pointer{nullptr};
     iterator            root{};
     std::size_t         visible_lines{1};
+    mutable FLineLayout line_layout{};  // Cached line of drawListLine()
+    uInt                revision{0};    // Incremented on text changes
     bool                expandable{false};
     bool                is_expand{false};
     bool                checkable{false};
@@ -155,7 +171,10 @@ inline void FListViewItem::setData (FDataPtr data)
 
 //----------------------------------------------------------------------
 inline void FListViewItem::setChecked (bool checked)
-{ is_checked = checked; }
+{
+  is_checked = checked;
+  invalidateListView();
+}
 
 //----------------------------------------------------------------------
 inline bool FListViewItem::isChecked() const
@@ -390,6 +409,9 @@ class FListView : public FWidget
     void                 drawList();
     void                 drawListLine (const FListViewItem*, bool, bool);
     void                 setLineAttributes (bool, bool);
+    const FString&       getLineText (const FListViewItem*);
+    FString              createLineText (const FListViewItem*, std::size_t);
+    uInt8                getLineState (const FListViewItem*);
     FString              getCheckBox (const FListViewItem* item);
     FString              getLinePrefix (const FListViewItem*, std::size_t);
     void                 drawSortIndicator (std::size_t&, std::size_t);
@@ -458,12 +480,15 @@ class FListView : public FWidget
     const FListViewItem* clicked_checkbox_item{nullptr};
     std::size_t          nf_offset{0};
     std::size_t          max_line_width{1};
+    std::size_t          visible_line_count{0};  // 0 = not counted
     fc::dragScroll       drag_scroll{fc::noScroll};
     int                  first_line_position_before{-1};
+    int                  last_first_line_position{-1};
     int                  scroll_repeat{100};
     int                  scroll_distance{1};
     int                  xoffset{0};
     int                  sort_column{-1};
+    uInt                 header_revision{0};  // Column layout changes
     fc::sorting_order    sort_order{fc::unsorted};
     bool                 scroll_timer{false};
     bool                 tree_view{false};
@@ -199,7 +199,7 @@ class FMenu : public FWindow, public FMenuList
     void         drawSeparator (int);
     void         drawMenuLine (FMenuItem*, int);
     void         drawCheckMarkPrefix (FMenuItem*);
-    void         drawMenuText (menuText&);
+    void         drawMenuText (const menuText&);
     void         drawSubMenuIndicator (std::size_t&);
     void         drawAcceleratorKey (std::size_t&, FKey);
     void         drawTrailingSpaces (std::size_t);
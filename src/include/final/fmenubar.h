@@ -127,7 +127,7 @@ class FMenuBar : public FWindow, public FMenuList
     void          drawItem (FMenuItem*, std::size_t&);
     void          setLineAttributes (FMenuItem*);
     void          setCursorToHotkeyPosition (FMenuItem*, std::size_t);
-    void          drawMenuText (menuText&);
+    void          drawMenuText (const menuText&);
     void          drawEllipsis (const menuText&, std::size_t);
     void          drawLeadingSpace (std::size_t&);
     void          drawTrailingSpace (std::size_t&);
@@ -135,6 +135,8 @@ class FOptiAttr final
     void          setNoColorVideo (int);
     void          setDefaultColorSupport();
     void          unsetDefaultColorSupport();
+    void          setTrueColor();
+    void          unsetTrueColor();
     void          set_enter_bold_mode (char[]);
     void          set_exit_bold_mode (char[]);
     void          set_enter_dim_mode (char[]);
@@ -272,6 +274,8 @@ class FOptiAttr final
     void          change_color (FChar*&, FChar*&);
     void          change_to_default_color (FChar*&, FChar*&, FColor&, FColor&);
     void          change_current_color (FChar*&, FColor, FColor);
+    void          quantize_direct_color (FChar*&);
+    bool          append_direct_color (int, FColor);
     void          resetAttribute (FChar*&);
     void          reset (FChar*&);
     bool          caused_reset_attributes (char[], uChar = all_tests);
@@ -330,6 +334,7 @@ class FOptiAttr final
     char*         attr_ptr{attr_buf};
     char          attr_buf[SGRoptimizer::ATTR_BUF_SIZE]{'\0'};
     bool          ansi_default_color{false};
+    bool          true_color{false};
     bool          alt_equal_pc_charset{false};
     bool          monochron{true};
     bool          fake_reverse{false};
@@ -357,6 +362,14 @@ inline void FOptiAttr::setDefaultColorSupport()
 inline void FOptiAttr::unsetDefaultColorSupport()
 { ansi_default_color = false; }
 
+//----------------------------------------------------------------------
+inline void FOptiAttr::setTrueColor()
+{ true_color = true; }
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::unsetTrueColor()
+{ true_color = false; }
+
 
 // FChar operator functions
 //----------------------------------------------------------------------
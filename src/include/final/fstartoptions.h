@@ -81,8 +81,13 @@ class FStartOptions final
     uInt8 sgr_optimizer       : 1;
     uInt8 vgafont             : 1;
     uInt8 newfont             : 1;
-    uInt8                     : 1;  // padding bits
+    uInt8 terminal_cache      : 1;
+    uInt8 headless            : 1;
+    uInt8 vcsa                : 1;
+    uInt8 async_output        : 1;
+    uInt8                     : 5;  // padding bits
     fc::encoding encoding;
+    FString vcsa_device;
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
     uInt8 meta_sends_escape   : 1;
@@ -66,6 +66,7 @@ namespace finalcut
 
 // class forward declaration
 class FString;
+class FStringView;
 
 // Global typedef
 typedef std::vector<FString> FStringList;
@@ -88,7 +89,7 @@ class FString
     explicit FString (std::size_t);
     FString (std::size_t, wchar_t);
     FString (const FString&);        // implicit conversion copy constructor
-    FString (FString&&);             // implicit conversion move constructor
+    FString (FString&&) noexcept;    // implicit conversion move constructor
     FString (const std::wstring&);   // implicit conversion constructor
     FString (const wchar_t[]);       // implicit conversion constructor
     FString (const std::string&);    // implicit conversion constructor
@@ -96,19 +97,19 @@ class FString
     FString (fc::SpecialCharacter);  // implicit conversion constructor
     FString (const wchar_t);         // implicit conversion constructor
     FString (const char);            // implicit conversion constructor
+    FString (const FStringView&);    // implicit conversion constructor
 
     // Destructor
     virtual ~FString ();
 
     // Overloaded operators
     FString& operator = (const FString&);
-    FString& operator = (FString&&);
+    FString& operator = (FString&&) noexcept;
 
     const FString& operator += (const FString&);
-
-    const FString operator + (const FString&);
-    const FString operator + (const wchar_t);
-    const FString operator + (const char);
+    const FString& operator += (fc::SpecialCharacter);
+    const FString& operator += (const wchar_t);
+    const FString& operator += (const char);
 
     FString& operator << (const FString&);
     FString& operator << (fc::SpecialCharacter);
@@ -147,9 +148,11 @@ class FString
     template <typename CharT>
     bool operator <= (const CharT&) const;
     bool operator == (const FString&) const;
+    bool operator == (const FStringView&) const;
     template <typename CharT>
     bool operator == (const CharT&) const;
     bool operator != (const FString&) const;
+    bool operator != (const FStringView&) const;
     template <typename CharT>
     bool operator != (const CharT&) const;
     bool operator >= (const FString&) const;
@@ -243,12 +246,23 @@ class FString
   private:
     // Constants
     static constexpr uInt FWDBUFFER = 15;
+    static constexpr uInt SSOBUFFER = 16;  // inline characters incl. '\0'
     static constexpr uInt INPBUFFER = 200;
     static constexpr uInt CHAR_SIZE = sizeof(wchar_t);  // bytes per character
+    static constexpr std::size_t UNKNOWN_WIDTH = ~std::size_t(0);
+
+    // Inquiry
+    bool     isHeapAllocated() const;
 
     // Methods
+    void     invalidateCache();
+    void     exposeBuffer();
+    bool     allocateBuffer (std::size_t);
+    void     releaseBuffer();
     void     initLength (std::size_t);
     void     _assign (const wchar_t[]);
+    void     _assign (const char[]);
+    void     _move (FString&&) noexcept;
     void     _insert (std::size_t, const wchar_t[]);
     void     _insert (std::size_t, std::size_t, const wchar_t[]);
     void     _remove (std::size_t, std::size_t);
@@ -260,25 +274,36 @@ class FString
     wchar_t*      string{nullptr};
     std::size_t   length{0};
     std::size_t   bufsize{0};
+    mutable std::size_t column_width{UNKNOWN_WIDTH};  // see getColumnWidth()
     mutable char* c_string{nullptr};
+    mutable std::size_t c_string_size{0};
+    mutable bool  c_string_valid{false};
+    bool          exposed{false};  // see exposeBuffer()
+    wchar_t       sso_buffer[SSOBUFFER]{};  // storage for short strings
     static wchar_t null_char;
     static const wchar_t const_null_char;
 
     // Friend Non-member operator functions
-    friend const FString operator + (const FString&, const FString&);
-    friend const FString operator + (const FString&, const wchar_t);
-    friend const FString operator + (const std::wstring&, const FString&);
-    friend const FString operator + (const wchar_t[], const FString&);
-    friend const FString operator + (const std::string&, const FString&);
-    friend const FString operator + (const char[], const FString&);
-    friend const FString operator + (const wchar_t, const FString&);
-    friend const FString operator + (const char, const FString&);
-    friend const FString operator + (const FString&, const char);
+    friend FString operator + (const FString&, const FString&);
+    friend FString operator + (FString&&, const FString&);
+    friend FString operator + (const FString&, const wchar_t);
+    friend FString operator + (FString&&, const wchar_t);
+    friend FString operator + (const std::wstring&, const FString&);
+    friend FString operator + (const wchar_t[], const FString&);
+    friend FString operator + (const std::string&, const FString&);
+    friend FString operator + (const char[], const FString&);
+    friend FString operator + (const wchar_t, const FString&);
+    friend FString operator + (const char, const FString&);
+    friend FString operator + (const FString&, const char);
+    friend FString operator + (FString&&, const char);
 
     friend std::ostream&  operator << (std::ostream&, const FString&);
     friend std::istream&  operator >> (std::istream&, FString& s);
     friend std::wostream& operator << (std::wostream&, const FString&);
     friend std::wistream& operator >> (std::wistream&, FString&);
+
+    // Friend function
+    friend std::size_t getColumnWidth (const FString&);
 };
 
 
@@ -305,6 +330,7 @@ inline wchar_t& FString::operator [] (const IndexT pos)
   if ( std::size_t(pos) == length )
     return null_char;
 
+  exposeBuffer();  // The character can be changed
   return string[std::size_t(pos)];
 }
 
@@ -391,11 +417,17 @@ inline std::size_t FString::capacity() const
 
 //----------------------------------------------------------------------
 inline FString::iterator FString::begin()
-{ return string; }
+{
+  exposeBuffer();
+  return string;
+}
 
 //----------------------------------------------------------------------
 inline FString::iterator FString::end()
-{ return string + length; }
+{
+  exposeBuffer();
+  return string + length;
+}
 
 //----------------------------------------------------------------------
 inline FString::const_iterator FString::begin() const
@@ -419,6 +451,30 @@ inline wchar_t FString::back() const
   return string[length - 1];
 }
 
+//----------------------------------------------------------------------
+inline bool FString::isHeapAllocated() const
+{ return string && string != sso_buffer; }
+
+//----------------------------------------------------------------------
+inline void FString::invalidateCache()
+{
+  // The cached column width and c-string no longer match the content.
+  // As with std::string, a modification invalidates the pointers and
+  // references handed out before, so the caches can be used again.
+  column_width = UNKNOWN_WIDTH;
+  c_string_valid = false;
+  exposed = false;
+}
+
+//----------------------------------------------------------------------
+inline void FString::exposeBuffer()
+{
+  // The characters can now be changed via a pointer or a reference
+  // at any later time, so the caches are no longer used
+  invalidateCache();
+  exposed = true;
+}
+
 //----------------------------------------------------------------------
 template<typename... Args>
 inline FString& FString::sprintf (const FString& format, Args&&... args)
@@ -0,0 +1,305 @@
+/***********************************************************************
+* fstringview.h - Non-owning view of a wide or UTF-8 string            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FStringView ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FSTRINGVIEW_H
+#define FSTRINGVIEW_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cstring>
+#include <cwchar>
+#include <iterator>
+#include <string>
+
+#include "final/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FStringView
+//----------------------------------------------------------------------
+
+class FStringView
+{
+  public:
+    // Forward iterator that returns wide characters
+    class const_iterator;
+
+    // Constructors
+    FStringView() = default;
+    FStringView (const wchar_t[]);          // implicit conversion constructor
+    FStringView (const wchar_t[], std::size_t);
+    FStringView (const std::wstring&);      // implicit conversion constructor
+    FStringView (const FString&);           // implicit conversion constructor
+    FStringView (const char[]);             // implicit conversion constructor
+    FStringView (const char[], std::size_t);
+    FStringView (const std::string&);       // implicit conversion constructor
+
+    // Accessors
+    const FString       getClassName() const;
+    const wchar_t*      getWideData() const;
+    const char*         getMultibyteData() const;
+
+    // Inquiries
+    bool                isNull() const;
+    bool                isEmpty() const;
+    bool                isWide() const;
+
+    // Methods
+    std::size_t         getSize() const;
+    const_iterator      begin() const;
+    const_iterator      end() const;
+
+  private:
+    // Data members
+    const wchar_t*      wide_string{nullptr};
+    const char*         mb_string{nullptr};  // UTF-8 or locale encoding
+    std::size_t         size{0};             // code units
+};
+
+
+//----------------------------------------------------------------------
+// class FStringView::const_iterator
+//----------------------------------------------------------------------
+
+class FStringView::const_iterator
+{
+  public:
+    // Typedefs
+    typedef std::forward_iterator_tag  iterator_category;
+    typedef wchar_t                    value_type;
+    typedef std::ptrdiff_t             difference_type;
+    typedef const wchar_t*             pointer;
+    typedef wchar_t                    reference;
+
+    // Constructors
+    const_iterator() = default;
+    explicit const_iterator (const wchar_t[]);
+    const_iterator (const char[], const char[]);
+
+    // Overloaded operators
+    wchar_t         operator * () const;
+    const_iterator& operator ++ ();
+    const_iterator  operator ++ (int);
+    bool            operator == (const const_iterator&) const;
+    bool            operator != (const const_iterator&) const;
+
+  private:
+    // Method
+    void                decode();
+
+    // Data members
+    const wchar_t*      wide_pos{nullptr};
+    const char*         mb_pos{nullptr};
+    const char*         mb_end{nullptr};
+    std::size_t         char_size{0};  // bytes of the current character
+    wchar_t             ch{L'\0'};
+    std::mbstate_t      state{};
+};
+
+
+// FStringView inline functions
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const wchar_t s[])
+  : wide_string{s}
+  , size{( s ) ? std::wcslen(s) : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const wchar_t s[], std::size_t len)
+  : wide_string{s}
+  , size{( s ) ? len : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const std::wstring& s)
+  : wide_string{s.c_str()}
+  , size{s.length()}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const FString& s)
+  : wide_string{s.wc_str()}
+  , size{s.getLength()}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const char s[])
+  : mb_string{s}
+  , size{( s ) ? std::strlen(s) : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const char s[], std::size_t len)
+  : mb_string{s}
+  , size{( s ) ? len : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const std::string& s)
+  : mb_string{s.c_str()}
+  , size{s.length()}
+{ }
+
+//----------------------------------------------------------------------
+inline const FString FStringView::getClassName() const
+{ return "FStringView"; }
+
+//----------------------------------------------------------------------
+inline const wchar_t* FStringView::getWideData() const
+{ return wide_string; }
+
+//----------------------------------------------------------------------
+inline const char* FStringView::getMultibyteData() const
+{ return mb_string; }
+
+//----------------------------------------------------------------------
+inline bool FStringView::isNull() const
+{ return ! (wide_string || mb_string); }
+
+//----------------------------------------------------------------------
+inline bool FStringView::isEmpty() const
+{ return size == 0; }
+
+//----------------------------------------------------------------------
+inline bool FStringView::isWide() const
+{ return bool(wide_string); }
+
+//----------------------------------------------------------------------
+inline std::size_t FStringView::getSize() const
+{ return size; }
+
+//----------------------------------------------------------------------
+inline FStringView::const_iterator FStringView::begin() const
+{
+  if ( mb_string )
+    return const_iterator(mb_string, mb_string + size);
+
+  return const_iterator(wide_string);
+}
+
+//----------------------------------------------------------------------
+inline FStringView::const_iterator FStringView::end() const
+{
+  if ( mb_string )
+    return const_iterator(mb_string + size, mb_string + size);
+
+  return const_iterator(wide_string + size);
+}
+
+
+// FStringView::const_iterator inline functions
+//----------------------------------------------------------------------
+inline FStringView::const_iterator::const_iterator (const wchar_t s[])
+  : wide_pos{s}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::const_iterator::const_iterator ( const char s[]
+                                                   , const char end[] )
+  : mb_pos{s}
+  , mb_end{end}
+{
+  decode();
+}
+
+//----------------------------------------------------------------------
+inline wchar_t FStringView::const_iterator::operator * () const
+{ return ( mb_pos ) ? ch : *wide_pos; }
+
+//----------------------------------------------------------------------
+inline FStringView::const_iterator& FStringView::const_iterator::operator ++ ()
+{
+  if ( mb_pos )
+  {
+    mb_pos += char_size;
+    decode();
+  }
+  else
+    wide_pos++;
+
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FStringView::const_iterator FStringView::const_iterator::operator ++ (int)
+{
+  const_iterator tmp(*this);
+  ++(*this);
+  return tmp;
+}
+
+//----------------------------------------------------------------------
+inline bool FStringView::const_iterator::operator == \
+    (const const_iterator& iter) const
+{ return wide_pos == iter.wide_pos && mb_pos == iter.mb_pos; }
+
+//----------------------------------------------------------------------
+inline bool FStringView::const_iterator::operator != \
+    (const const_iterator& iter) const
+{ return ! (*this == iter); }
+
+//----------------------------------------------------------------------
+inline void FStringView::const_iterator::decode()
+{
+  if ( mb_pos >= mb_end )
+  {
+    char_size = 0;
+    return;
+  }
+
+  if ( uChar(*mb_pos) < 0x80 )  // 7-bit ASCII
+  {
+    ch = wchar_t(*mb_pos);
+    char_size = 1;
+    return;
+  }
+
+  const std::size_t len = std::mbrtowc ( &ch, mb_pos
+                                       , std::size_t(mb_end - mb_pos)
+                                       , &state );
+
+  if ( len == std::size_t(-1) || len == std::size_t(-2) )
+  {
+    // Invalid or incomplete multibyte sequence
+    ch = L'\xfffd';  // Replacement character
+    char_size = 1;
+    state = std::mbstate_t();
+  }
+  else
+    char_size = ( len == 0 ) ? 1 : len;
+}
+
+}  // namespace finalcut
+
+#endif  // FSTRINGVIEW_H
@@ -0,0 +1,69 @@
+/***********************************************************************
+* fsystemheadless.h - FSystem implementation for the virtual terminal  *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FSystemImpl ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *        ▲
+ *        │
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FSystemHeadless ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FSYSTEMHEADLESS_H
+#define FSYSTEMHEADLESS_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include "final/fsystemimpl.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSystemHeadless
+//----------------------------------------------------------------------
+
+class FSystemHeadless final : public FSystemImpl
+{
+  public:
+    // Constructor
+    FSystemHeadless();
+
+    // Destructor
+    virtual ~FSystemHeadless();
+
+    // Methods
+    int isTTY (int) override;
+    int ioctl (int, uLong, ...) override;
+    int putchar (int) override;
+};
+
+}  // namespace finalcut
+
+#endif  // FSYSTEMHEADLESS_H
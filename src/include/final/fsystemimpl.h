@@ -81,6 +81,7 @@
 
 #include "final/fc.h"
 #include "final/fsystem.h"
+#include "final/ftermoutput.h"
 namespace finalcut
 {
 
@@ -163,6 +164,10 @@ class FSystemImpl : public FSystem
 
     int putchar (int c) override
     {
+      // The non-blocking output takes over the characters
+      if ( FTermOutput::isActive() )
+        return FTermOutput::putchar(c);
+
 #if defined(__sun) && defined(__SVR4)
       return std::putchar(char(c));
 #else
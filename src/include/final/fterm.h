@@ -242,6 +242,7 @@ class FTerm final
     static bool            hasHalfBlockCharacter();
     static bool            hasAlternateScreen();
     static bool            canChangeColorPalette();
+    static bool            hasTrueColor();
 
     // Mutators
     static void            setFSystem (FSystem*);
@@ -301,6 +302,7 @@ class FTerm final
     // Methods
     static FStartOptions&  getStartOptions();
     static void            init_global_values (bool);
+    static void            init_headless();
     static void            init_terminal_device_path();
     static void            oscPrefix();
     static void            oscPostfix();
@@ -309,6 +311,9 @@ class FTerm final
     static void            init_cygwin_charmap();
     static void            init_teraterm_charmap();
     static void            init_fixed_max_color();
+    static void            init_true_color();
+    static void            init_vcsa();
+    static void            init_output();
     static void            init_keyboard();
     static void            init_termcap();
     static void            init_quirks();
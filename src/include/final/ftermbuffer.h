@@ -59,14 +59,18 @@ class FTermBuffer
     typedef FCharVector::const_iterator const_iterator;
 
     // Constructor
-    FTermBuffer() = default;
+    FTermBuffer();
     template<typename Iterator>
     FTermBuffer (Iterator, Iterator);
 
+    // Copy constructor
+    FTermBuffer (const FTermBuffer&);
+
     // Destructor
     virtual ~FTermBuffer();
 
     // Overloaded operators
+    FTermBuffer& operator = (const FTermBuffer&);
     template <typename typeT>
     FTermBuffer& operator << (const typeT&);
     FTermBuffer& operator << (const FCharVector&);
@@ -99,7 +103,18 @@ class FTermBuffer
     FTermBuffer&           write ();
 
   private:
+    // Methods
+    void                   attach();
+    void                   detach();
+
+    // Data members
     FCharVector            data{};
+    FTermBuffer*           prev_buffer{nullptr};
+    FTermBuffer*           next_buffer{nullptr};
+    static FTermBuffer*    first_buffer;  // All buffers for compaction
+
+    // Friend class
+    friend class FVTerm;
 
     // Non-member operators
     friend FCharVector& operator << ( FCharVector&
@@ -113,6 +128,7 @@ template<typename Iterator>
 inline FTermBuffer::FTermBuffer(Iterator first, Iterator last)
 {
   data.assign(first, last);
+  attach();
 }
 
 //----------------------------------------------------------------------
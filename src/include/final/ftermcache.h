@@ -0,0 +1,157 @@
+/***********************************************************************
+* ftermcache.h - Persistent cache of the terminal replies              *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermCache ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  The terminal detection waits for the answers of the terminal.
+ *  FTermCache stores these answers in a file under $XDG_CACHE_HOME
+ *  (default: ~/.cache/finalcut), so that a later start in the same
+ *  terminal can skip the queries. The cache entry is keyed by the
+ *  environment variables that identify the terminal emulator and by
+ *  the terminal device, and it expires after one week. The entry is
+ *  only used if the creation time of the terminal device and the
+ *  terminal size are unchanged. No query is needed for this check.
+ */
+
+#ifndef FTERMCACHE_H
+#define FTERMCACHE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <ctime>
+#include <string>
+
+#include "final/fstring.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermCache
+//----------------------------------------------------------------------
+
+class FTermCache final
+{
+  public:
+    // Constructors
+    FTermCache() = default;
+
+    // Destructor
+    ~FTermCache() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static const FString  getAnswerback();
+    static const FString  getPrimaryDA();
+    static const FString  getSecondaryDA();
+    static int            getMaxColor();
+    static const FString  getFileName();
+
+    // Inquiry
+    static bool           isLoaded();
+
+    // Mutators
+    static void           setAnswerback (const FString&);
+    static void           setPrimaryDA (const FString&);
+    static void           setSecondaryDA (const FString&);
+    static void           setMaxColor (int);
+
+    // Methods
+    static bool           load();
+    static bool           save();
+    static void           clear();
+
+  private:
+    // Constant
+    static constexpr std::time_t MAX_AGE = 7 * 24 * 60 * 60;  // One week
+
+    // Methods
+    static const std::string  getKey();
+    static const std::string  getSession();
+    static const std::string  getDirectory();
+    static bool               makeDirectory (const std::string&);
+    static const std::string  encode (const std::string&);
+    static const std::string  decode (const std::string&);
+    static uInt64             hash (const std::string&);
+
+    // Data members
+    static std::string  answerback;
+    static std::string  primary_da;
+    static std::string  sec_da;
+    static int          max_color;
+    static bool         loaded;
+};
+
+
+// FTermCache inline functions
+//----------------------------------------------------------------------
+inline const FString FTermCache::getClassName() const
+{ return "FTermCache"; }
+
+//----------------------------------------------------------------------
+inline const FString FTermCache::getAnswerback()
+{ return FString(answerback); }
+
+//----------------------------------------------------------------------
+inline const FString FTermCache::getPrimaryDA()
+{ return FString(primary_da); }
+
+//----------------------------------------------------------------------
+inline const FString FTermCache::getSecondaryDA()
+{ return FString(sec_da); }
+
+//----------------------------------------------------------------------
+inline int FTermCache::getMaxColor()
+{ return max_color; }
+
+//----------------------------------------------------------------------
+inline bool FTermCache::isLoaded()
+{ return loaded; }
+
+//----------------------------------------------------------------------
+inline void FTermCache::setAnswerback (const FString& str)
+{ answerback = str.isNull() ? std::string{} : std::string(str.c_str()); }
+
+//----------------------------------------------------------------------
+inline void FTermCache::setPrimaryDA (const FString& str)
+{ primary_da = str.isNull() ? std::string{} : std::string(str.c_str()); }
+
+//----------------------------------------------------------------------
+inline void FTermCache::setSecondaryDA (const FString& str)
+{ sec_da = str.isNull() ? std::string{} : std::string(str.c_str()); }
+
+//----------------------------------------------------------------------
+inline void FTermCache::setMaxColor (int color)
+{ max_color = color; }
+
+}  // namespace finalcut
+
+#endif  // FTERMCACHE_H
@@ -83,6 +83,14 @@ class FTermcap final
     }
     tcap_map;
 
+    typedef struct
+    {
+      const char* name;          // Terminal name
+      const char* base;          // Entry with further capabilities
+      const char* capabilities;  // Zero-separated capability list
+    }
+    builtin_entry;
+
     // Constructors
     FTermcap() = default;
 
@@ -104,6 +112,7 @@ class FTermcap final
     static bool      ansi_default_color;
     static bool      osc_support;
     static bool      no_utf8_acs_chars;
+    static bool      true_color;
     static int       max_color;
     static int       tabstop;
     static int       attr_without_color;
@@ -112,6 +121,12 @@ class FTermcap final
   private:
     // Methods
     static void      termcap();
+    static const builtin_entry* getBuiltinEntry (const char[]);
+    static const builtin_entry* findBuiltinEntry (const char[]);
+    static const char* getBuiltinCapability (const char[]);
+    static bool      getFlag (char[]);
+    static int       getNumber (char[]);
+    static char*     getString (char[], char*&);
     static void      termcapError (int);
     static void      termcapVariables (char*&);
     static void      termcapBoleans();
@@ -123,6 +138,8 @@ class FTermcap final
     // Data member
     static FTermData*      fterm_data;
     static FTermDetection* term_detection;
+    static const builtin_entry  builtin[];
+    static const builtin_entry* builtin_term;
 };
 
 
@@ -119,7 +119,9 @@ class FTermDetection final
     static bool           isScreenTerm();
     static bool           isTmuxTerm();
     static bool           canDisplay256Colors();
+    static bool           canDisplayTrueColor();
     static bool           hasTerminalDetection();
+    static bool           hasTerminalCache();
     static bool           hasSetCursorStyleSupport();
 
     // Mutators
@@ -143,6 +145,7 @@ class FTermDetection final
     static void           setScreenTerm (bool);
     static void           setTmuxTerm (bool);
     static void           setTerminalDetection (bool);
+    static void           setTerminalCache (bool);
     static void           setTtyTypeFileName (char[]);
 
     // Methods
@@ -160,8 +163,11 @@ class FTermDetection final
     static void           detectTerminal();
     static char*          init_256colorTerminal();
     static bool           get256colorEnvString();
+    static bool           getTrueColorEnvString();
     static char*          termtype_256color_quirks();
+    static void           queryTerminalIdentity();
     static char*          determineMaxColor (char[]);
+    static int            queryMaxColor();
     static const FString  getXTermColorName (FColor);
     static char*          parseAnswerbackMsg (char[]);
     static const FString  getAnswerbackMsg();
@@ -192,7 +198,9 @@ class FTermDetection final
     static char           ttytypename[256];
     static bool           decscusr_support;
     static bool           terminal_detection;
+    static bool           terminal_cache;
     static bool           color256;
+    static bool           true_color;
     static int            gnome_terminal_id;
     static const FString* answer_back;
     static const FString* sec_da;
@@ -254,6 +262,10 @@ inline const char* FTermDetection::getTermType_SecDA()
 inline bool FTermDetection::canDisplay256Colors()
 { return color256; }
 
+//----------------------------------------------------------------------
+inline bool FTermDetection::canDisplayTrueColor()
+{ return true_color; }
+
 //----------------------------------------------------------------------
 inline bool FTermDetection::hasSetCursorStyleSupport()
 { return decscusr_support; }
@@ -338,6 +350,10 @@ inline bool FTermDetection::isTmuxTerm()
 inline bool FTermDetection::hasTerminalDetection()
 { return terminal_detection; }
 
+//----------------------------------------------------------------------
+inline bool FTermDetection::hasTerminalCache()
+{ return terminal_cache; }
+
 //----------------------------------------------------------------------
 inline void FTermDetection::setXTerminal (bool enable)
 { terminal_type.xterm = enable; }
@@ -418,6 +434,10 @@ inline void FTermDetection::setTmuxTerm (bool enable)
 inline void FTermDetection::setTerminalDetection (bool enable)
 { terminal_detection = enable; }
 
+//----------------------------------------------------------------------
+inline void FTermDetection::setTerminalCache (bool enable)
+{ terminal_cache = enable; }
+
 }  // namespace finalcut
 
 #endif  // FTERMDETECTION_H
@@ -0,0 +1,312 @@
+/***********************************************************************
+* ftermemulator.h - In-memory emulation of a xterm-compatible terminal *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermEmulator ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  FTermEmulator interprets the output bytes of a program like a
+ *  xterm-256color terminal and keeps the result in a screen model.
+ *  Cell positions are zero-based, the cell colors are the color
+ *  numbers of the terminal (fc::Default for the default color).
+ *  Answers to terminal queries are collected and can be fetched
+ *  with takeReply().
+ */
+
+#ifndef FTERMEMULATOR_H
+#define FTERMEMULATOR_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cwchar>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "final/fc.h"
+#include "final/fpoint.h"
+#include "final/fstring.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermEmulator
+//----------------------------------------------------------------------
+
+class FTermEmulator final
+{
+  public:
+    // Constructors
+    FTermEmulator();
+    FTermEmulator (std::size_t, std::size_t);
+
+    // Disable copy constructor
+    FTermEmulator (const FTermEmulator&) = delete;
+
+    // Destructor
+    ~FTermEmulator();
+
+    // Disable assignment operator (=)
+    FTermEmulator& operator = (const FTermEmulator&) = delete;
+
+    // Accessors
+    const FString        getClassName() const;
+    std::size_t          getWidth() const;
+    std::size_t          getHeight() const;
+    const FPoint         getCursorPos() const;
+    const FChar&         getChar (std::size_t, std::size_t) const;
+    const FString        getCharString (std::size_t, std::size_t) const;
+    const FString        getLine (std::size_t) const;
+    const FString        getText() const;
+    const FString&       getTitle() const;
+    uInt64               getByteCount() const;
+    uInt64               getSequenceCount() const;
+    const std::string&   getRecording() const;
+
+    // Mutators
+    void                 setSize (std::size_t, std::size_t);
+    void                 setRecording (bool);
+
+    // Inquiries
+    bool                 isCursorVisible() const;
+    bool                 isAlternateScreen() const;
+    bool                 isMouseTracking() const;
+    bool                 hasReply() const;
+
+    // Methods
+    void                 write (char);
+    void                 write (const std::string&);
+    const std::string    takeReply();
+    void                 clearRecording();
+    void                 resetCounters();
+    void                 reset();
+
+  private:
+    // Enumeration
+    enum parser_state
+    {
+      text_state,        // Printable characters and control codes
+      esc_state,         // After ESC
+      esc_intermediate,  // ESC with an intermediate byte
+      csi_state,         // Control sequence
+      osc_state,         // Operating system command
+      osc_esc_state,     // ESC inside an operating system command
+      string_state,      // DCS, SOS, PM or APC (ignored)
+      string_esc_state   // ESC inside an ignored string
+    };
+
+    // Constants
+    static constexpr std::size_t MAX_PARAMETERS = 16;
+    static constexpr std::size_t MAX_STRING_LENGTH = 4096;
+#if WCHAR_MAX > 0xffff
+    static constexpr std::size_t MAX_CLUSTERS = 65536;
+    static constexpr uInt        CLUSTER_ID = 0x200000;  // Beyond unicode
+#else
+    static constexpr std::size_t MAX_CLUSTERS = 0x800;
+    static constexpr uInt        CLUSTER_ID = 0xd800;  // Surrogates
+#endif
+
+    // Methods
+    void                 parseText (uChar);
+    void                 parseEscape (char);
+    void                 parseControlSequence (char);
+    void                 executeControl (uChar);
+    void                 executeEscape (char, char);
+    void                 executeControlSequence (char);
+    void                 executePrivateSequence (char);
+    void                 executeOSC();
+    void                 setGraphicRendition();
+    void                 setMode (bool);
+    void                 setPrivateMode (bool);
+    void                 print (wchar_t);
+    void                 combine (wchar_t);
+    void                 lineFeed();
+    void                 reverseIndex();
+    void                 tabForward (std::size_t);
+    void                 tabBackward (std::size_t);
+    void                 setCursor (std::size_t, std::size_t);
+    void                 moveCursorUp (std::size_t);
+    void                 moveCursorDown (std::size_t);
+    void                 saveCursor();
+    void                 restoreCursor();
+    void                 setLeftRightMargins();
+    void                 scrollUp (std::size_t, std::size_t, std::size_t);
+    void                 scrollDown (std::size_t, std::size_t, std::size_t);
+    void                 eraseCells (std::size_t, std::size_t, std::size_t);
+    void                 eraseDisplay (int);
+    void                 eraseLine (int);
+    void                 insertCells (std::size_t);
+    void                 deleteCells (std::size_t);
+    void                 splitWideChar (std::size_t, std::size_t);
+    void                 switchScreen (bool, bool);
+    void                 softReset();
+    void                 resetTabStops();
+    bool                 isInsideLeftRightMargins() const;
+    int                  getParameter (std::size_t, int = 1) const;
+    std::size_t          getCount (std::size_t = 0) const;
+    FChar                getBlankChar() const;
+    FChar&               getCell (std::size_t, std::size_t);
+    const std::wstring   getGlyph (wchar_t) const;
+    FColor               getExtendedColor (std::size_t&, FColor) const;
+
+    // Data members
+    std::vector<FChar>   screen{};
+    std::vector<FChar>   inactive_screen{};  // Normal or alternate screen
+    std::vector<bool>    tab_stops{};
+    std::vector<std::wstring> clusters{};
+    std::unordered_map<std::wstring, std::size_t> cluster_index{};
+    std::string          sequence{};
+    std::string          reply{};
+    std::string          recording{};
+    FString              title{};
+    FChar                attribute{};
+    FChar                saved_attribute{};
+    int                  parameters[MAX_PARAMETERS]{};
+    std::size_t          parameter_count{0};
+    std::size_t          width{80};
+    std::size_t          height{24};
+    std::size_t          cursor_x{0};
+    std::size_t          cursor_y{0};
+    std::size_t          saved_x{0};
+    std::size_t          saved_y{0};
+    std::size_t          top_margin{0};
+    std::size_t          bottom_margin{23};
+    std::size_t          left_margin{0};
+    std::size_t          right_margin{79};
+    uInt64               byte_count{0};
+    uInt64               sequence_count{0};
+    uInt                 code_point{0};
+    std::size_t          utf8_bytes{0};
+    wchar_t              last_char{L'\0'};
+    parser_state         state{text_state};
+    char                 intermediate{'\0'};
+    int                  mouse_mode{0};
+    bool                 wrap_pending{false};
+    bool                 autowrap{true};
+    bool                 insert_mode{false};
+    bool                 show_cursor{true};
+    bool                 alternate_screen{false};
+    bool                 sgr_mouse{false};
+    bool                 g0_graphics{false};
+    bool                 g1_graphics{false};
+    bool                 shift_out{false};
+    bool                 saved_g0_graphics{false};
+    bool                 lr_margin_mode{false};
+    bool                 recording_enabled{false};
+};
+
+
+// FTermEmulator inline functions
+//----------------------------------------------------------------------
+inline const FString FTermEmulator::getClassName() const
+{ return "FTermEmulator"; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermEmulator::getWidth() const
+{ return width; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermEmulator::getHeight() const
+{ return height; }
+
+//----------------------------------------------------------------------
+inline const FPoint FTermEmulator::getCursorPos() const
+{ return FPoint(int(cursor_x), int(cursor_y)); }
+
+//----------------------------------------------------------------------
+inline const FChar& FTermEmulator::getChar ( std::size_t x
+                                           , std::size_t y ) const
+{ return screen[y * width + x]; }
+
+//----------------------------------------------------------------------
+inline const FString& FTermEmulator::getTitle() const
+{ return title; }
+
+//----------------------------------------------------------------------
+inline uInt64 FTermEmulator::getByteCount() const
+{ return byte_count; }
+
+//----------------------------------------------------------------------
+inline uInt64 FTermEmulator::getSequenceCount() const
+{ return sequence_count; }
+
+//----------------------------------------------------------------------
+inline const std::string& FTermEmulator::getRecording() const
+{ return recording; }
+
+//----------------------------------------------------------------------
+inline void FTermEmulator::setRecording (bool enable)
+{ recording_enabled = enable; }
+
+//----------------------------------------------------------------------
+inline bool FTermEmulator::isCursorVisible() const
+{ return show_cursor; }
+
+//----------------------------------------------------------------------
+inline bool FTermEmulator::isAlternateScreen() const
+{ return alternate_screen; }
+
+//----------------------------------------------------------------------
+inline bool FTermEmulator::isMouseTracking() const
+{ return mouse_mode != 0 && sgr_mouse; }
+
+//----------------------------------------------------------------------
+inline bool FTermEmulator::hasReply() const
+{ return ! reply.empty(); }
+
+//----------------------------------------------------------------------
+inline void FTermEmulator::write (const std::string& str)
+{
+  for (auto&& ch : str)
+    write (ch);
+}
+
+//----------------------------------------------------------------------
+inline void FTermEmulator::clearRecording()
+{ recording.clear(); }
+
+//----------------------------------------------------------------------
+inline void FTermEmulator::resetCounters()
+{
+  byte_count = 0;
+  sequence_count = 0;
+}
+
+//----------------------------------------------------------------------
+inline bool FTermEmulator::isInsideLeftRightMargins() const
+{ return cursor_x >= left_margin && cursor_x <= right_margin; }
+
+//----------------------------------------------------------------------
+inline FChar& FTermEmulator::getCell (std::size_t x, std::size_t y)
+{ return screen[y * width + x]; }
+
+}  // namespace finalcut
+
+#endif  // FTERMEMULATOR_H
@@ -0,0 +1,122 @@
+/***********************************************************************
+* ftermheadless.h - Virtual terminal without a tty                     *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermHeadless ▏- - - -▕ FTermEmulator ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  With the start option --headless, the terminal output goes into
+ *  an FTermEmulator instead of stdout. The keyboard input comes from
+ *  a pipe that replaces stdin, so that key presses, mouse events and
+ *  terminal size changes can be injected by the program itself.
+ */
+
+#ifndef FTERMHEADLESS_H
+#define FTERMHEADLESS_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <string>
+
+#include "final/fpoint.h"
+#include "final/fstring.h"
+#include "final/ftermemulator.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermHeadless
+//----------------------------------------------------------------------
+
+class FTermHeadless final
+{
+  public:
+    // Enumeration
+    enum mouse_button
+    {
+      left_button   = 0x00,
+      middle_button = 0x01,
+      right_button  = 0x02,
+      wheel_up      = 0x40,
+      wheel_down    = 0x41
+    };
+
+    // Constructors
+    FTermHeadless() = default;
+
+    // Destructor
+    ~FTermHeadless() = default;
+
+    // Accessors
+    const FString          getClassName() const;
+    static FTermEmulator&  getEmulator();
+    static const FString   getText();
+
+    // Inquiry
+    static bool            isActive();
+
+    // Methods
+    static bool            init (std::size_t, std::size_t);
+    static void            finish();
+    static void            write (char);
+    static bool            sendString (const std::string&);
+    static bool            sendKey (FKey);
+    static bool            sendMouse (mouse_button, const FPoint&, bool = true);
+    static void            resize (std::size_t, std::size_t);
+
+  private:
+    // Data members
+    static FTermEmulator   emulator;
+    static int             input_fd;
+    static int             saved_stdin_fd;
+    static bool            active;
+};
+
+
+// FTermHeadless inline functions
+//----------------------------------------------------------------------
+inline const FString FTermHeadless::getClassName() const
+{ return "FTermHeadless"; }
+
+//----------------------------------------------------------------------
+inline FTermEmulator& FTermHeadless::getEmulator()
+{ return emulator; }
+
+//----------------------------------------------------------------------
+inline const FString FTermHeadless::getText()
+{ return emulator.getText(); }
+
+//----------------------------------------------------------------------
+inline bool FTermHeadless::isActive()
+{ return active; }
+
+}  // namespace finalcut
+
+#endif  // FTERMHEADLESS_H
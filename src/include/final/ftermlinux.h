@@ -145,16 +145,34 @@ class FTermLinux final
       rgb color[16];
     } ColorMap;
 
+#if defined(__linux__)
+    typedef struct
+    {
+      std::vector<uChar> data{};  // Glyphs without unused lines
+      uInt   width{0};
+      uInt   height{0};
+      uInt   charcount{0};
+      uInt64 fingerprint{0};
+    } ConsoleFont;
+
+    typedef struct
+    {
+      std::vector<unipair> entries{};
+      uInt64 fingerprint{0};
+    } UnicodeMap;
+#endif  // defined(__linux__)
+
     // Accessors
     int                  getFramebuffer_bpp();
     bool                 getScreenFont();
     bool                 getUnicodeMap ();
+    struct unimapdesc    getSavedUnicodeMap();
     modifier_key&        getModifierKey();
 
     // Mutators
-    int                  setScreenFont ( uChar[], uInt, uInt, uInt
-                                       , bool = false );
+    int                  setScreenFont (const uChar[], uInt, uInt, uInt);
     int                  setUnicodeMap (struct unimapdesc*);
+    void                 setVcsaCharMap (const struct unimapdesc&, uInt);
     void                 setLinuxCursorStyle (fc::linuxConsoleCursorStyle);
 
     // Methods
@@ -180,6 +198,10 @@ class FTermLinux final
     FKey                 ctrlAltKeyCorrection (const FKey&);
     FKey                 shiftCtrlAltKeyCorrection (const FKey&);
     sInt16               getFontPos (wchar_t ucs);
+    static uInt64        getFontFingerprint (const uChar[], uInt, uInt, uInt);
+    static uInt64        getUnicodeMapFingerprint (const struct unimapdesc&);
+    static uInt64        getFingerprint ( const void*, std::size_t
+                                        , uInt64 = 0xcbf29ce484222325 );
     void                 initSpecialCharacter();
     void                 characterFallback (wchar_t, std::vector<wchar_t>);
 
@@ -192,8 +214,10 @@ class FTermLinux final
     FSystem*             fsystem{nullptr};
     FTermDetection*      term_detection{nullptr};
     CursorStyle          linux_console_cursor_style{};
-    console_font_op      screen_font{};
-    unimapdesc           screen_unicode_map{};
+    static ConsoleFont   saved_font;  // Shared by all instances
+    static UnicodeMap    saved_unicode_map;
+    static uInt64        font_fingerprint;  // Of the current console font
+    static uInt64        unimap_fingerprint;
     ColorMap             saved_color_map{};
     ColorMap             cmap{};
     int                  framebuffer_bpp{-1};
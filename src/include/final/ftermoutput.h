@@ -0,0 +1,145 @@
+/***********************************************************************
+* ftermoutput.h - Non-blocking terminal output with back-pressure      *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermOutput ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  The terminal output is collected in a pending buffer and written
+ *  to a separately opened, non-blocking file descriptor of the tty.
+ *  A stalled terminal (e.g. a slow ssh connection) therefore no longer
+ *  blocks the event loop. The output of a screen update is marked as
+ *  a frame. When the pending data exceeds the threshold, frames that
+ *  have not yet been started can be discarded, so that they can be
+ *  replaced by a single up-to-date frame.
+ */
+
+#ifndef FTERMOUTPUT_H
+#define FTERMOUTPUT_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <string>
+#include <vector>
+
+#include "final/fstring.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermOutput
+//----------------------------------------------------------------------
+
+class FTermOutput final
+{
+  public:
+    // Constructors
+    FTermOutput() = default;
+
+    // Destructor
+    ~FTermOutput() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static std::size_t    getPendingSize();
+    static std::size_t    getThreshold();
+
+    // Mutator
+    static void           setThreshold (std::size_t);
+
+    // Inquiries
+    static bool           isActive();
+    static bool           isFrameActive();
+    static bool           isOverloaded();
+    static bool           hasPendingData();
+
+    // Methods
+    static bool           open (const FString&);
+    static void           close();
+    static int            putchar (int);
+    static void           beginFrame();
+    static void           endFrame();
+    static bool           write();
+    static bool           drain();
+    static bool           discardFrames();
+
+  private:
+    // Constants
+    static constexpr std::size_t DEFAULT_THRESHOLD = 65536;
+
+    // Methods
+    static void           compact();
+
+    // Data members
+    static std::string               buffer;
+    static std::vector<std::size_t>  frame_starts;
+    static std::size_t               offset;
+    static std::size_t               threshold;
+    static int                       fd;
+    static bool                      frame_active;
+};
+
+
+// FTermOutput inline functions
+//----------------------------------------------------------------------
+inline const FString FTermOutput::getClassName() const
+{ return "FTermOutput"; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermOutput::getPendingSize()
+{ return buffer.size() - offset; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermOutput::getThreshold()
+{ return threshold; }
+
+//----------------------------------------------------------------------
+inline void FTermOutput::setThreshold (std::size_t size)
+{ threshold = size; }
+
+//----------------------------------------------------------------------
+inline bool FTermOutput::isActive()
+{ return fd >= 0; }
+
+//----------------------------------------------------------------------
+inline bool FTermOutput::isFrameActive()
+{ return frame_active; }
+
+//----------------------------------------------------------------------
+inline bool FTermOutput::isOverloaded()
+{ return getPendingSize() > threshold; }
+
+//----------------------------------------------------------------------
+inline bool FTermOutput::hasPendingData()
+{ return getPendingSize() > 0; }
+
+}  // namespace finalcut
+
+#endif  // FTERMOUTPUT_H
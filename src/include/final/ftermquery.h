@@ -0,0 +1,134 @@
+/***********************************************************************
+* ftermquery.h - Pipelined terminal queries                            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermQuery ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  Several terminal queries are sent in one batch, followed by a
+ *  primary device attributes request (DA1) as sentinel. Terminals
+ *  answer in the order of the requests, so the DA1 reply marks the
+ *  end of all answers. The replies are split by one parser while
+ *  they arrive. A batch costs one round trip instead of one timeout
+ *  per query.
+ */
+
+#ifndef FTERMQUERY_H
+#define FTERMQUERY_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <string>
+#include <vector>
+
+#include "final/fstring.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermQuery
+//----------------------------------------------------------------------
+
+class FTermQuery final
+{
+  public:
+    // Constructors
+    FTermQuery() = default;
+
+    // Destructor
+    ~FTermQuery() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static const FString  getAnswerback();
+    static const FString  getPrimaryDA();
+    static const FString  getSecondaryDA();
+    static const FString  getOSCString (const FString&);
+
+    // Inquiry
+    static bool           hasSentinelReply();
+
+    // Methods
+    static void           sendSentinel();
+    static bool           readReplies (uInt64);
+    static void           clear();
+
+  private:
+    // Enumeration
+    enum parser_state
+    {
+      text_state,     // Answerback characters
+      esc_state,      // After ESC
+      csi_state,      // Control sequence
+      osc_state,      // Operating system command
+      osc_esc_state   // ESC inside an operating system command
+    };
+
+    // Constant
+    static constexpr std::size_t MAX_REPLY_LENGTH = 512;
+
+    // Methods
+    static void           parse (char);
+    static void           finishReply();
+    static const FString  getCSIReply (char, char);
+
+    // Data members
+    static std::string               answerback;
+    static std::string               reply;
+    static std::vector<std::string>  replies;
+    static parser_state              state;
+    static bool                      sentinel_reply;
+};
+
+
+// FTermQuery inline functions
+//----------------------------------------------------------------------
+inline const FString FTermQuery::getClassName() const
+{ return "FTermQuery"; }
+
+//----------------------------------------------------------------------
+inline const FString FTermQuery::getAnswerback()
+{ return FString(answerback); }
+
+//----------------------------------------------------------------------
+inline const FString FTermQuery::getPrimaryDA()
+{ return getCSIReply ('?', 'c'); }
+
+//----------------------------------------------------------------------
+inline const FString FTermQuery::getSecondaryDA()
+{ return getCSIReply ('>', 'c'); }
+
+//----------------------------------------------------------------------
+inline bool FTermQuery::hasSentinelReply()
+{ return sentinel_reply; }
+
+}  // namespace finalcut
+
+#endif  // FTERMQUERY_H
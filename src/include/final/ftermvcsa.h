@@ -0,0 +1,150 @@
+/***********************************************************************
+* ftermvcsa.h - Direct screen output into a Linux /dev/vcsa device     *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermVcsa ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  With the start option --vcsa, the changed characters of the virtual
+ *  terminal are written directly into the screen memory of the Linux
+ *  console (/dev/vcsaN) instead of being sent as escape sequences.
+ *  The device starts with a 4-byte header (lines, columns, cursor x
+ *  and y), followed by a character and an attribute byte per cell.
+ *  The character byte is the position of the glyph in the console font.
+ *  The cursor and the terminal modes are still controlled by escape
+ *  sequences.
+ */
+
+#ifndef FTERMVCSA_H
+#define FTERMVCSA_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <unordered_map>
+#include <vector>
+
+#include "final/fc.h"
+#include "final/fstring.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermVcsa
+//----------------------------------------------------------------------
+
+class FTermVcsa final
+{
+  public:
+    // Constructors
+    FTermVcsa() = default;
+
+    // Destructor
+    ~FTermVcsa() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static std::size_t    getColumns();
+    static std::size_t    getLines();
+    static const FString  getDevicePath (const char[]);
+
+    // Mutators
+    static void           setMaxColor (int);
+    static void           setGlyphCount (std::size_t);
+    static void           setFontPosition (wchar_t, uInt16);
+    static void           setCharSubstitution (wchar_t, wchar_t);
+    static void           clearFontPositions();
+
+    // Inquiry
+    static bool           isActive();
+
+    // Methods
+    static bool           open (const FString&);
+    static void           close();
+    static bool           readHeader();
+    static bool           write ( std::size_t, std::size_t
+                                , const FChar[], std::size_t );
+    static uInt16         encode (const FChar&);
+
+  private:
+    // Constants
+    static constexpr std::size_t HEADER_SIZE = 4;
+    static constexpr std::size_t CELL_SIZE = 2;
+
+    // Methods
+    static uInt16         getFontPos (wchar_t);
+    static uInt8          getVGAColor (FColor);
+
+    // Data members
+    static std::unordered_map<wchar_t, uInt16> font_positions;
+    static std::vector<uInt8>  buffer;
+    static std::size_t         console_columns;
+    static std::size_t         console_lines;
+    static std::size_t         glyph_count;
+    static int                 max_color;
+    static int                 fd;
+};
+
+
+// FTermVcsa inline functions
+//----------------------------------------------------------------------
+inline const FString FTermVcsa::getClassName() const
+{ return "FTermVcsa"; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermVcsa::getColumns()
+{ return console_columns; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTermVcsa::getLines()
+{ return console_lines; }
+
+//----------------------------------------------------------------------
+inline void FTermVcsa::setMaxColor (int colors)
+{ max_color = colors; }
+
+//----------------------------------------------------------------------
+inline void FTermVcsa::setGlyphCount (std::size_t count)
+{ glyph_count = count; }
+
+//----------------------------------------------------------------------
+inline void FTermVcsa::setFontPosition (wchar_t ucs, uInt16 fontpos)
+{ font_positions.emplace (ucs, fontpos); }  // The first entry counts
+
+//----------------------------------------------------------------------
+inline void FTermVcsa::clearFontPositions()
+{ font_positions.clear(); }
+
+//----------------------------------------------------------------------
+inline bool FTermVcsa::isActive()
+{ return fd >= 0; }
+
+}  // namespace finalcut
+
+#endif  // FTERMVCSA_H
@@ -134,6 +134,8 @@ class FTermXTerminal final
     bool                  canResetColor();
     void                  oscPrefix();
     void                  oscPostfix();
+    void                  requestXTermFont();
+    void                  requestXTermTitle();
     const FString         captureXTermFont();
     const FString         captureXTermTitle();
     static void           enableXTermMouse();
@@ -92,6 +92,7 @@ class FTextView : public FWidget
     const FString       getClassName() const override;
     std::size_t         getColumns() const;
     std::size_t         getRows() const;
+    std::size_t         getMaxLines() const;
     const FString       getText() const;
     const FStringList&  getLines() const;
 
@@ -100,12 +101,19 @@ class FTextView : public FWidget
     void                setGeometry ( const FPoint&, const FSize&
                                     , bool = true ) override;
     void                setText (const FString&);
+    void                setMaxLines (std::size_t);
+    void                setFollowMode (bool);
+    void                setFollowMode ();
+    void                unsetFollowMode ();
     void                scrollToX (int);
     void                scrollToY (int);
     void                scrollTo (const FPoint&);
     void                scrollTo (int, int);
     void                scrollBy (int, int);
 
+    // Inquiry
+    bool                isFollowMode() const;
+
     // Methods
     void                hide() override;
     template<typename T>
@@ -143,6 +151,7 @@ class FTextView : public FWidget
     // Inquiry
     bool                isHorizontallyScrollable();
     bool                isVerticallyScrollable();
+    bool                isScrolledToBottom();
 
     // Methods
     void                init();
@@ -153,6 +162,9 @@ class FTextView : public FWidget
     void                drawText();
     bool                useFDialogBorder();
     bool                isPrintable (wchar_t);
+    void                evictLines();
+    void                compactLines() const;
+    void                updateVerticalScrollBar();
     void                processChanged();
     void                changeOnResize();
 
@@ -161,15 +173,21 @@ class FTextView : public FWidget
     void                cb_HBarChange (FWidget*, FDataPtr);
 
     // Data members
-    FStringList        data{};
+    mutable FStringList data{};
     FScrollbarPtr      vbar{nullptr};
     FScrollbarPtr      hbar{nullptr};
     keyMap             key_map{};
     bool               update_scrollbar{true};
+    bool               follow_mode{false};
     int                xoffset{0};
     int                yoffset{0};
     int                nf_offset{0};
+    int                last_yoffset{-1};
     std::size_t        maxLineWidth{0};
+    std::size_t        max_lines{0};
+    std::size_t        evicted_lines{0};
+    std::size_t        last_evicted_lines{0};
+    mutable std::size_t first_line{0};
 };
 
 // FListBox inline functions
@@ -217,16 +235,39 @@ inline std::size_t FTextView::getColumns() const
 
 //----------------------------------------------------------------------
 inline std::size_t FTextView::getRows() const
-{ return std::size_t(data.size()); }
+{ return std::size_t(data.size()) - first_line; }
+
+//----------------------------------------------------------------------
+inline std::size_t FTextView::getMaxLines() const
+{ return max_lines; }
 
 //----------------------------------------------------------------------
 inline const FStringList& FTextView::getLines() const
-{ return data; }
+{
+  compactLines();
+  return data;
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::setFollowMode (bool enable)
+{ follow_mode = enable; }
+
+//----------------------------------------------------------------------
+inline void FTextView::setFollowMode()
+{ setFollowMode(true); }
+
+//----------------------------------------------------------------------
+inline void FTextView::unsetFollowMode()
+{ setFollowMode(false); }
 
 //----------------------------------------------------------------------
 inline void FTextView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
 
+//----------------------------------------------------------------------
+inline bool FTextView::isFollowMode() const
+{ return follow_mode; }
+
 //----------------------------------------------------------------------
 template<typename T>
 void FTextView::append (const std::initializer_list<T>& list)
@@ -262,6 +303,10 @@ inline bool FTextView::isHorizontallyScrollable()
 inline bool FTextView::isVerticallyScrollable()
 { return bool( getRows() > getTextHeight() ); }
 
+//----------------------------------------------------------------------
+inline bool FTextView::isScrolledToBottom()
+{ return bool( yoffset >= int(getRows()) - int(getTextHeight()) ); }
+
 }  // namespace finalcut
 
 #endif  // FTEXTVIEW_H
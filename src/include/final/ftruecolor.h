@@ -0,0 +1,164 @@
+/***********************************************************************
+* ftruecolor.h - Direct colors and their palette approximation        *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTrueColor ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+/*  A direct color is a 24-bit RGB color. It is interned and
+ *  represented by a color number behind the 256 palette colors,
+ *  so that FChar keeps its size and equal colors remain comparable
+ *  as integers. Terminals without 24-bit color support get the
+ *  nearest palette color from a precomputed lookup table.
+ *  A color number is never renumbered. When all numbers are in use,
+ *  FVTerm sweeps the store: numbers that are not marked (not in any
+ *  cell, term buffer, terminal state or widget color) are released
+ *  and handed out again. Keep the RGB value of a color that is held
+ *  elsewhere and convert it again before use. If nothing can be
+ *  released, new colors get the nearest of 256 colors.
+ */
+
+#ifndef FTRUECOLOR_H
+#define FTRUECOLOR_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <unordered_map>
+#include <vector>
+
+#include "final/fc.h"
+#include "final/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTrueColor
+//----------------------------------------------------------------------
+
+class FTrueColor final
+{
+  public:
+    // Constructors
+    FTrueColor() = default;
+
+    // Destructor
+    ~FTrueColor() = default;
+
+    // Accessors
+    const FString         getClassName() const;
+    static uInt           getRGB (FColor);
+    static uInt8          getRed (FColor);
+    static uInt8          getGreen (FColor);
+    static uInt8          getBlue (FColor);
+    static std::size_t    getCount();
+
+    // Mutator
+    static void           setPerceptual (bool = true);
+
+    // Inquiries
+    static bool           isDirectColor (FColor);
+    static bool           isPerceptual();
+    static bool           isFull();
+
+    // Methods
+    static FColor         rgb (uInt8, uInt8, uInt8);
+    static FColor         quantize (uInt8, uInt8, uInt8, int);
+    static FColor         quantize (FColor, int);
+    static void           startSweep();
+    static void           mark (FColor);
+    static std::size_t    finishSweep();
+    static void           clear();
+
+  private:
+    // Typedef
+    typedef struct
+    {
+      std::vector<uInt> entries{};  // RGB values
+      std::vector<uInt8> state{};   // Free, unmarked or marked
+      std::vector<FColor> free_ids{};
+      std::unordered_map<uInt, FColor> lookup{};
+    } FColorStorage;
+
+    // Constants
+    static constexpr uInt FIRST_ID = 256;  // Behind the palette colors
+    static constexpr uInt MAX_COUNT = fc::Default - FIRST_ID;
+    static constexpr int  LEVEL_BITS = 5;  // Lookup table precision
+    static constexpr uInt8 FREE = 0;
+    static constexpr uInt8 UNMARKED = 1;
+    static constexpr uInt8 MARKED = 2;
+
+    // Methods
+    static void           buildLookupTable (int);
+    static uInt           getPaletteRGB (FColor);
+    static uInt           getDistance (uInt, uInt);
+
+    // Data members
+    static FColorStorage      storage;
+    static std::vector<uInt8> lookup_table;
+    static int                table_colors;
+    static bool               perceptual;
+};
+
+
+// FTrueColor inline functions
+//----------------------------------------------------------------------
+inline const FString FTrueColor::getClassName() const
+{ return "FTrueColor"; }
+
+//----------------------------------------------------------------------
+inline uInt8 FTrueColor::getRed (FColor color)
+{ return uInt8(getRGB(color) >> 16); }
+
+//----------------------------------------------------------------------
+inline uInt8 FTrueColor::getGreen (FColor color)
+{ return uInt8(getRGB(color) >> 8); }
+
+//----------------------------------------------------------------------
+inline uInt8 FTrueColor::getBlue (FColor color)
+{ return uInt8(getRGB(color)); }
+
+//----------------------------------------------------------------------
+inline std::size_t FTrueColor::getCount()
+{ return storage.entries.size() - storage.free_ids.size(); }
+
+//----------------------------------------------------------------------
+inline bool FTrueColor::isDirectColor (FColor color)
+{ return color >= FIRST_ID && color != fc::Default; }
+
+//----------------------------------------------------------------------
+inline bool FTrueColor::isFull()
+{ return storage.entries.size() >= MAX_COUNT && storage.free_ids.empty(); }
+
+//----------------------------------------------------------------------
+inline bool FTrueColor::isPerceptual()
+{ return perceptual; }
+
+}  // namespace finalcut
+
+#endif  // FTRUECOLOR_H
@@ -48,6 +48,8 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <sys/time.h>  // need for timeval
+
 #include <queue>
 #include <sstream>  // std::stringstream
 #include <string>
@@ -56,6 +58,7 @@
 
 #include "final/fc.h"
 #include "final/fterm.h"
+#include "final/fstringview.h"
 
 #define F_PREPROC_HANDLER(i,h) \
     reinterpret_cast<FVTerm*>((i)), \
@@ -69,6 +72,7 @@ namespace finalcut
 class FColorPair;
 class FKeyboard;
 class FMouseControl;
+class FObject;
 class FPoint;
 class FRect;
 class FSize;
@@ -137,7 +141,13 @@ class FVTerm
     template <typename typeT>
     FVTerm& operator << (const typeT&);
     FVTerm& operator << (fc::SpecialCharacter);
+    FVTerm& operator << (wchar_t);
+    FVTerm& operator << (const wchar_t[]);
+    FVTerm& operator << (const char[]);
+    FVTerm& operator << (const std::wstring&);
     FVTerm& operator << (const std::string&);
+    FVTerm& operator << (const FString&);
+    FVTerm& operator << (const FStringView&);
     FVTerm& operator << (const FTermBuffer&);
     FVTerm& operator << (const std::vector<FChar>&);
     FVTerm& operator << (const FPoint&);
@@ -158,6 +168,7 @@ class FVTerm
     static const FString  getKeyName (FKey);
     static char*          getTermType();
     static char*          getTermFileName();
+    static uInt           getMaxFramesPerSecond();
     FTerm&                getFTerm();
 
     // Mutators
@@ -167,8 +178,10 @@ class FVTerm
     void                  showCursor();
     void                  setPrintCursor (const FPoint&);
     FColor                rgb2ColorIndex (uInt8, uInt8, uInt8);
+    FColor                rgb2Color (uInt8, uInt8, uInt8);
     static void           setColor (FColor, FColor);
     static void           setNormal();
+    static void           setMaxFramesPerSecond (uInt);
 
     static bool           setBold (bool);
     static bool           setBold();
@@ -294,8 +307,8 @@ class FVTerm
     virtual void          delPreprocessingHandler (FVTerm*);
     template<typename... Args>
     int                   printf (const FString&, Args&&...);
-    int                   print (const FString&);
-    int                   print (FTermArea*, const FString&);
+    int                   print (const FStringView&);
+    int                   print (FTermArea*, const FStringView&);
     int                   print (const FTermBuffer&);
     int                   print (FTermArea*, const FTermBuffer&);
     int                   print (const std::vector<FChar>&);
@@ -323,6 +336,7 @@ class FVTerm
     static bool           charEncodable (wchar_t);
     static FKeyboard*     getFKeyboard();
     static FMouseControl* getFMouseControl();
+    static uInt64         getFrameWaitTime();
 
     // Mutators
     void                  setPrintArea (FTermArea*);
@@ -356,8 +370,16 @@ class FVTerm
     static void           getArea (const FRect&, FTermArea*);
     void                  putArea (FTermArea*);
     static void           putArea (const FPoint&, FTermArea*);
+    static void           saveAreaRegion ( const FTermArea*, const FRect&
+                                         , std::vector<FChar>& );
+    static void           restoreAreaRegion ( FTermArea*, const FRect&
+                                            , const std::vector<FChar>& );
     void                  scrollAreaForward (FTermArea*);
+    void                  scrollAreaForward ( FTermArea*, const FRect&
+                                            , std::size_t = 1 );
     void                  scrollAreaReverse (FTermArea*);
+    void                  scrollAreaReverse ( FTermArea*, const FRect&
+                                            , std::size_t = 1 );
     void                  clearArea (FTermArea*, int = ' ');
     void                  processTerminalUpdate();
     static void           startTerminalUpdate();
@@ -377,16 +399,52 @@ class FVTerm
       covered_character
     };
 
-    enum exit_state
+    enum span_type
+    {
+      unchanged_span,  // Characters without changes
+      uniform_span,    // Equal characters with changes
+      mixed_span       // Different characters with changes
+    };
+
+    enum span_output
     {
-      not_used,
-      used,
-      line_completely_printed
+      skip_output,     // Move the cursor over the characters
+      literal_output,  // Print the characters
+      repeat_output,   // Repeat one character (REP)
+      erase_output,    // Erase the characters (ECH)
+      clr_eol_output,  // Clear to the end of line (EL)
+      clr_bol_output   // Clear to the beginning of line (EL1)
     };
 
+    // Typedef
+    typedef struct
+    {
+      uInt        xmin;         // X-position of the first character
+      uInt        xmax;         // X-position of the last character
+      uInt        length;       // Number of bytes for printing
+      span_type   type;
+      span_output output;       // Chosen output
+      uInt64      cost[2];      // Lowest total cost for both cursor states
+      span_output choice[2];    // Output with the lowest total cost
+      int         previous[2];  // Cursor state before this span
+    } FOutputSpan;
+
+    typedef struct
+    {
+      int         x1;           // Region corners on the terminal
+      int         y1;           // (0-based)
+      int         x2;
+      int         y2;
+      int         num;          // Lines up (> 0) or down (< 0)
+    } FTermScroll;
+
     // Constants
     //   Buffer size for character output on the terminal
     static constexpr uInt TERMINAL_OUTPUT_BUFFER_SIZE = 32768;
+    //   Output queue size from which the frame rate is reduced
+    static constexpr int  TERMINAL_OUTPUT_QUEUE_LIMIT = 4096;
+    //   Longest frame interval of the adaptive throttling (1 s)
+    static constexpr uInt64 MAX_FRAME_INTERVAL = 1000000;
 
     // Methods
     void                  setTextToDefault (FTermArea*, const FSize&);
@@ -427,36 +485,57 @@ class FVTerm
     void                  init (bool);
     static void           init_characterLengths (FOptiMove*);
     void                  finish();
+    static void           compactGlyphStore();
+    static void           sweepDirectColors();
+    static void           markWidgetColors (const FObject*);
     static void           putAreaLine (FChar*, FChar*, int);
     static void           putAreaCharacter ( const FPoint&, FVTerm*
                                            , FChar*, FChar* );
     static void           getAreaCharacter ( const FPoint&, FTermArea*
                                            , FChar*& );
+    void                  scrollAreaRegion (FTermArea*, const FRect&, int);
+    bool                  canScrollTermRegion (FTermArea*, const FRect&, int);
+    void                  scrollTermRegion (const FRect&, int);
+    static void           queueTermScroll (const FRect&, int);
+    void                  applyTermScrolls();
+    static void           shiftAreaLines ( FTermArea*, const FRect&
+                                         , int, bool );
     bool                  clearTerm (int = ' ');
     bool                  clearFullArea (FTermArea*, FChar&);
     static void           clearAreaWithShadow (FTermArea*, FChar&);
     static bool           canClearToEOL (uInt, uInt);
-    static bool           canClearLeadingWS (uInt&, uInt);
-    static bool           canClearTrailingWS (uInt&, uInt);
-    bool                  skipUnchangedCharacters (uInt&, uInt, uInt);
-    void                  printRange (uInt, uInt, uInt, bool);
+    static bool           isFrameDue();
+    static uInt64         getFrameElapsedTime();
+    static void           adjustFrameInterval (uInt64);
+    void                  printRange (uInt, uInt, uInt);
+    void                  splitIntoSpans (uInt, uInt, uInt);
+    void                  chooseSpanOutput (uInt, uInt, uInt);
+    void                  printOutputSpan (const FOutputSpan&, uInt, bool);
+    static uInt           getOutputLength (const FChar*);
     void                  replaceNonPrintableFullwidth (uInt, FChar*&);
     void                  printCharacter (uInt&, uInt, bool, FChar*&);
     void                  printFullWidthCharacter (uInt&, uInt, FChar*&);
     void                  printFullWidthPaddingCharacter (uInt&, uInt, FChar*&);
     void                  printHalfCovertFullWidthCharacter (uInt&, uInt, FChar*&);
     void                  skipPaddingCharacter (uInt&, uInt, FChar*&);
-    exit_state            eraseCharacters (uInt&, uInt, uInt, bool);
-    exit_state            repeatCharacter (uInt&, uInt, uInt);
     bool                  isFullWidthChar (FChar*&);
     bool                  isFullWidthPaddingChar (FChar*&);
     static void           cursorWrap();
     bool                  printWrap (FTermArea*);
+    std::size_t           printSpan ( FTermArea*
+                                    , std::vector<FChar>::const_iterator
+                                    , std::vector<FChar>::const_iterator );
+    static void           combineWithPreviousCell (FTermArea*, wchar_t);
+    static void           updateTransCount ( FLineChanges&
+                                           , const FChar&, const FChar& );
     void                  printPaddingCharacter (FTermArea*, FChar&);
     void                  updateTerminalLine (uInt);
+    void                  updateVcsaLine (uInt);
     bool                  updateTerminalCursor();
     bool                  isInsideTerminal (const FPoint&);
     bool                  isTermSizeChanged();
+    bool                  isOutputReady();
+    void                  invalidateTerminal();
     static void           markAsPrinted (uInt, uInt);
     static void           markAsPrinted (uInt, uInt, uInt);
     static void           newFontChanges (FChar*&);
@@ -480,6 +559,9 @@ class FVTerm
     static FTermArea*       vdesktop;     // virtual desktop
     static FTermArea*       active_area;  // active area
     static std::queue<int>* output_buffer;
+    static std::vector<FTermArea*>* area_list;  // all allocated areas
+    static std::vector<FOutputSpan>* span_list;  // spans of a terminal line
+    static std::vector<FTermScroll>* scroll_list;  // scrolls for the next frame
     static FChar            term_attribute;
     static FChar            next_attribute;
     static FChar            s_ch;      // shadow character
@@ -490,12 +572,17 @@ class FVTerm
     static bool             terminal_update_pending;
     static bool             force_terminal_update;
     static bool             stop_terminal_updates;
+    static bool             direct_color_sweep;
     static int              skipped_terminal_update;
+    static uInt             max_frames_per_second;  // 0 = unlimited
+    static uInt64           frame_interval;   // adaptive, in microseconds
+    static timeval          last_frame_time;
     static uInt             erase_char_length;
     static uInt             repeat_char_length;
     static uInt             clr_bol_length;
     static uInt             clr_eol_length;
     static uInt             cursor_address_length;
+    static uInt             cursor_move_length;
 };
 
 
@@ -557,6 +644,34 @@ inline FVTerm& FVTerm::operator << (fc::SpecialCharacter c)
   return *this;
 }
 
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (wchar_t c)
+{
+  print (FStringView(&c, 1));  // Control characters are interpreted
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (const wchar_t string[])
+{
+  print (string);
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (const char string[])
+{
+  print (string);
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (const std::wstring& string)
+{
+  print (string);
+  return *this;
+}
+
 //----------------------------------------------------------------------
 inline FVTerm& FVTerm::operator << (const std::string& string)
 {
@@ -564,6 +679,20 @@ inline FVTerm& FVTerm::operator << (const std::string& string)
   return *this;
 }
 
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (const FString& string)
+{
+  print (string);
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FVTerm& FVTerm::operator << (const FStringView& string)
+{
+  print (string);
+  return *this;
+}
+
 //----------------------------------------------------------------------
 inline FVTerm& FVTerm::operator << \
     (const std::vector<FChar>& termString)
@@ -638,6 +767,10 @@ inline char* FVTerm::getTermType()
 inline char* FVTerm::getTermFileName()
 { return FTerm::getTermFileName(); }
 
+//----------------------------------------------------------------------
+inline uInt FVTerm::getMaxFramesPerSecond()
+{ return max_frames_per_second; }
+
 //----------------------------------------------------------------------
 inline FTerm& FVTerm::getFTerm()
 { return *fterm; }
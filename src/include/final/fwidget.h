@@ -99,6 +99,7 @@
 #include "final/fpoint.h"
 #include "final/frect.h"
 #include "final/fsize.h"
+#include "final/ftruecolor.h"
 #include "final/ftypes.h"
 
 // Callback macros
@@ -167,7 +168,8 @@ class FWidget : public FVTerm, public FObject
       uInt32 always_on_top  : 1;
       uInt32 flat           : 1;
       uInt32 no_underline   : 1;
-      uInt32                : 14;  // padding bits
+      uInt32 backing_store  : 1;
+      uInt32                : 13;  // padding bits
     };
 
     // Constructor
@@ -255,6 +257,9 @@ class FWidget : public FVTerm, public FObject
     virtual bool            unsetFocus();
     void                    setFocusable();
     void                    unsetFocusable();
+    bool                    setBackingStore (bool);  // keep a copy of the
+    bool                    setBackingStore();       // drawn character cells
+    bool                    unsetBackingStore();
     bool                    ignorePadding (bool);    // ignore padding from
     bool                    ignorePadding();         // the parent widget
     bool                    acceptPadding();
@@ -304,6 +309,7 @@ class FWidget : public FVTerm, public FObject
     bool                    hasVisibleCursor() const;
     bool                    hasFocus() const;
     bool                    acceptFocus() const;  // is focusable
+    bool                    hasBackingStore() const;
     bool                    isPaddingIgnored();
 
     // Methods
@@ -321,12 +327,13 @@ class FWidget : public FVTerm, public FObject
     void                    delCallback (FCallback);
     void                    delCallback (FWidget*);
     void                    delCallbacks();
-    void                    emitCallback (const FString&);
+    void                    emitCallback (const FStringView&);
     void                    addAccelerator (FKey);
     virtual void            addAccelerator (FKey, FWidget*);
     void                    delAccelerator ();
     virtual void            delAccelerator (FWidget*);
     virtual void            redraw();
+    void                    invalidate();
     virtual void            resize();
     virtual void            show();
     virtual void            hide();
@@ -414,6 +421,9 @@ class FWidget : public FVTerm, public FObject
     virtual void            draw();
     void                    drawWindows();
     void                    drawChildren();
+    FRect                   getBackingStoreBox (const FTermArea*) const;
+    bool                    restoreBackingStore();
+    void                    saveBackingStore();
     static void             setColorTheme();
     void                    setStatusbarText (bool);
 
@@ -465,6 +475,20 @@ class FWidget : public FVTerm, public FObject
       int right{0};
     } padding{};
 
+    struct widget_backing_store
+    {
+      widget_backing_store() = default;
+      ~widget_backing_store() = default;
+
+      std::vector<FChar> data{};      // Saved character cells
+      const FTermArea*   area{nullptr};
+      FRect              box{};        // Position in the print area
+      uInt               generation{0};
+      uInt               glyph_generation{0};
+      bool               dirty{true};  // Needs to be drawn again
+      bool               orphaned{false};  // The parent is destroyed
+    } backing_store{};
+
     struct FWidgetFlags     flags{};
     bool                    ignore_padding{false};
 
@@ -504,6 +528,7 @@ class FWidget : public FVTerm, public FObject
     static FWidgetList*     close_widget;
     static FWidgetColors    wcolors;
     static uInt             modal_dialog_counter;
+    static uInt             backing_store_generation;
     static bool             init_desktop;
     static bool             hideable;
 
@@ -815,6 +840,14 @@ inline void FWidget::setFocusable()
 inline void FWidget::unsetFocusable()
 { flags.focusable = false; }
 
+//----------------------------------------------------------------------
+inline bool FWidget::setBackingStore()
+{ return setBackingStore(true); }
+
+//----------------------------------------------------------------------
+inline bool FWidget::unsetBackingStore()
+{ return setBackingStore(false); }
+
 //----------------------------------------------------------------------
 inline bool FWidget::ignorePadding (bool enable)
 { return (ignore_padding = enable); }
@@ -830,17 +863,23 @@ inline bool FWidget::acceptPadding()
 //----------------------------------------------------------------------
 inline void FWidget::setForegroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     foreground_color = color;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
 inline void FWidget::setBackgroundColor (FColor color)
 {
-  // valid colors -1..254
-  if ( color == fc::Default || color >> 8 == 0 )
+  // Valid colors: fc::Default, the palette and the direct colors
+  if ( color == fc::Default || color >> 8 == 0
+    || FTrueColor::isDirectColor(color) )
     background_color = color;
+
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -861,6 +900,7 @@ inline void FWidget::setShadowSize (const FSize& size)
 {
   // width = right shadow  /  height = bottom shadow
   wshadow.setSize (size);
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -958,6 +998,10 @@ inline bool FWidget::hasFocus() const
 inline bool FWidget::acceptFocus() const  // is focusable
 { return flags.focusable; }
 
+//----------------------------------------------------------------------
+inline bool FWidget::hasBackingStore() const
+{ return flags.backing_store; }
+
 //----------------------------------------------------------------------
 inline bool FWidget::isPaddingIgnored()
 { return ignore_padding; }
@@ -0,0 +1,243 @@
+/***********************************************************************
+* fglyphstore-test.cpp - FGlyphStore unit tests                        *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FGlyphStoreTest
+//----------------------------------------------------------------------
+
+class FGlyphStoreTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FGlyphStoreTest()
+    { }
+
+    void setUp();
+
+  protected:
+    void classNameTest();
+    void singleCodePointTest();
+    void internTest();
+    void extendTest();
+    void combineTest();
+    void compactionTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FGlyphStoreTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (singleCodePointTest);
+    CPPUNIT_TEST (internTest);
+    CPPUNIT_TEST (extendTest);
+    CPPUNIT_TEST (combineTest);
+    CPPUNIT_TEST (compactionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::setUp()
+{
+  finalcut::FGlyphStore::clear();
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::classNameTest()
+{
+  const finalcut::FGlyphStore store;
+  const finalcut::FString& classname = store.getClassName();
+  CPPUNIT_ASSERT ( classname == "FGlyphStore" );
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::singleCodePointTest()
+{
+  // Single code points are stored inline
+  const wchar_t a[] = L"a";
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::intern(a, 1) == L'a' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::intern(L"", 0) == L'\0' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::intern(nullptr, 2) == L'\0' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 0 );
+
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isCluster(L'a') );
+#if WCHAR_MAX > 0xffff
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isCluster(wchar_t(0x10ffff)) );
+#endif
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getBaseCharacter(L'a') == L'a' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(L'a') == L"a" );
+
+  std::size_t length{99};
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::getCodePoints(L'a', length) );
+  CPPUNIT_ASSERT ( length == 0 );
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::internTest()
+{
+  const std::wstring e_acute(L"e\x0301");   // e + combining acute accent
+  const std::wstring a_ring(L"a\x030a");    // a + combining ring above
+  const wchar_t g1 = finalcut::FGlyphStore::intern(e_acute.data(), 2);
+  const wchar_t g2 = finalcut::FGlyphStore::intern(a_ring.data(), 2);
+  const wchar_t g3 = finalcut::FGlyphStore::intern(e_acute.data(), 2);
+
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isCluster(g1) );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isCluster(g2) );
+  CPPUNIT_ASSERT ( g1 != g2 );
+  CPPUNIT_ASSERT ( g1 == g3 );  // Identical clusters share the same id
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 2 );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getArenaSize() == 4 );
+
+  std::size_t length{0};
+  const wchar_t* code_points = \
+      finalcut::FGlyphStore::getCodePoints(g2, length);
+  CPPUNIT_ASSERT ( length == 2 );
+  CPPUNIT_ASSERT ( code_points[0] == L'a' );
+  CPPUNIT_ASSERT ( code_points[1] == L'\x030a' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getBaseCharacter(g1) == L'e' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(g1) == e_acute );
+
+  // Unknown ids
+  const wchar_t unknown = wchar_t(g2 + 100);
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isCluster(unknown) );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getBaseCharacter(unknown)
+                   == L'\xfffd' );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(unknown) == L"\xfffd" );
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::extendTest()
+{
+  // Combining marks and variation selectors
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(L'\x0301') );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(L'\xfe0f') );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(L'\x200d') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'a') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\t') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\x4e00') );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(L'\x20dd') );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(L'\xfe00') );
+
+#if WCHAR_MAX > 0xffff
+  // Emoji modifiers and supplementary variation selectors
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(wchar_t(0x1f3fd)) );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::isExtendingCharacter(wchar_t(0xe0100)) );
+#endif
+
+  // Format characters of width 0 stand alone
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\x200b') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\x200e') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\x202a') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\x2060') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::isExtendingCharacter(L'\xfeff') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::extendsGlyph(L'e', L'\x200b') );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\x200b') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\x0301') == 0 );
+
+  // As with wcwidth(), unassigned code points and
+  // the line and paragraph separators have no width
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\x0378') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\x2028') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\x2029') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\xfa6e') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\xfffe') == 0 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\xe000') == 1 );
+  CPPUNIT_ASSERT ( finalcut::fc::getCharacterWidth(L'\xfa6d') == 2 );
+
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::extendsGlyph(L'e', L'\x0301') );
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::extendsGlyph(L'e', L'f') );
+
+  // Control characters have no cluster
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::extendsGlyph(L'\n', L'\x0301') );
+
+#if WCHAR_MAX > 0xffff
+  // The character after a zero width joiner belongs to the cluster
+  const wchar_t man = wchar_t(0x1f468);
+  const wchar_t girl = wchar_t(0x1f467);
+  const wchar_t g = finalcut::FGlyphStore::combine(man, L'\x200d');
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::extendsGlyph(g, girl) );
+  const wchar_t family = finalcut::FGlyphStore::combine(g, girl);
+  CPPUNIT_ASSERT ( ! finalcut::FGlyphStore::extendsGlyph(family, girl) );
+#endif
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::combineTest()
+{
+  const wchar_t g1 = finalcut::FGlyphStore::combine(L'o', L'\x0302');
+  const wchar_t g2 = finalcut::FGlyphStore::combine(g1, L'\x0323');
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(g1) == L"o\x0302" );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(g2)
+                   == L"o\x0302\x0323" );
+
+  const std::wstring s(L"o\x0302");
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::intern(s.data(), 2) == g1 );
+}
+
+//----------------------------------------------------------------------
+void FGlyphStoreTest::compactionTest()
+{
+  const wchar_t g1 = finalcut::FGlyphStore::combine(L'a', L'\x0300');
+  finalcut::FGlyphStore::combine(L'b', L'\x0300');
+  const wchar_t g3 = finalcut::FGlyphStore::combine(L'c', L'\x0300');
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 3 );
+
+  // Only the clusters g3 and g1 are still in use
+  const uInt generation = finalcut::FGlyphStore::getGeneration();
+  finalcut::FGlyphStore::startCompaction();
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getGeneration() != generation );
+  const wchar_t n3 = finalcut::FGlyphStore::relocate(g3);
+  const wchar_t n1 = finalcut::FGlyphStore::relocate(g1);
+  const wchar_t n3b = finalcut::FGlyphStore::relocate(g3);
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::relocate(L'x') == L'x' );
+  finalcut::FGlyphStore::finishCompaction();
+
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 2 );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getArenaSize() == 4 );
+  CPPUNIT_ASSERT ( n3 == n3b );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(n1) == L"a\x0300" );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getString(n3) == L"c\x0300" );
+
+  finalcut::FGlyphStore::clear();
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 0 );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getArenaSize() == 0 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FGlyphStoreTest);
+
+// The general unit test main part
+#include <main-test.inc>
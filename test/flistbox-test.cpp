@@ -0,0 +1,303 @@
+/***********************************************************************
+* flistbox-test.cpp - FListBox unit tests                              *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+#include <keypress.h>
+
+namespace
+{
+
+//----------------------------------------------------------------------
+void rowProvider (finalcut::FListBoxItem& item, std::size_t index)
+{
+  // Row 0 is "row 0", row 999 is "row 999"
+  item.setText (finalcut::FString() << "row " << index);
+}
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+// class FListBoxTest
+//----------------------------------------------------------------------
+
+class FListBoxTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FListBoxTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void virtualItemTest();
+    void virtualInsertTest();
+    void virtualSearchTest();
+    void virtualSelectionTest();
+    void scrollTest();
+    void mergedScrollTest();
+
+  private:
+    // Data members
+    finalcut::FListBox* listbox{nullptr};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FListBoxTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (virtualItemTest);
+    CPPUNIT_TEST (virtualInsertTest);
+    CPPUNIT_TEST (virtualSearchTest);
+    CPPUNIT_TEST (virtualSelectionTest);
+    CPPUNIT_TEST (scrollTest);
+    CPPUNIT_TEST (mergedScrollTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FListBoxTest::setUp()
+{
+  // Ten rows are loaded at once
+  listbox = new finalcut::FListBox(&test::getApplication());
+  listbox->setGeometry (finalcut::FPoint(1, 1), finalcut::FSize(20, 12));
+  listbox->setRowProvider (1000, rowProvider);
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::tearDown()
+{
+  delete listbox;
+  listbox = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::classNameTest()
+{
+  const finalcut::FString& classname = listbox->getClassName();
+  CPPUNIT_ASSERT ( classname == "FListBox" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualItemTest()
+{
+  CPPUNIT_ASSERT ( listbox->getCount() == 1000 );
+  CPPUNIT_ASSERT ( listbox->getItem(1).getText() == "row 0" );
+  CPPUNIT_ASSERT ( listbox->getItem(500).getText() == "row 499" );
+  CPPUNIT_ASSERT ( ! listbox->isSelected(1000) );
+
+  // Rows outside the loaded page are also available via const access
+  const finalcut::FListBox& const_listbox = *listbox;
+  finalcut::FListBoxItem item = const_listbox.getItem(1000);
+  CPPUNIT_ASSERT ( item.getText() == "row 999" );
+  item = const_listbox.getItem(2);
+  CPPUNIT_ASSERT ( item.getText() == "row 1" );
+  item = const_listbox.getItem(750);
+  CPPUNIT_ASSERT ( item.getText() == "row 749" );
+
+  // A returned row remains valid when other pages are loaded
+  finalcut::FListBoxItem& row = listbox->getItem(900);
+  CPPUNIT_ASSERT ( ! listbox->isSelected(20) );
+  CPPUNIT_ASSERT ( ! listbox->isSelected(600) );
+  CPPUNIT_ASSERT ( row.getText() == "row 899" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualInsertTest()
+{
+  // The rows come from the provider only
+  listbox->insert (finalcut::FListBoxItem("extra"));
+  listbox->insert (L"extra");
+  CPPUNIT_ASSERT ( listbox->getCount() == 1000 );
+  CPPUNIT_ASSERT ( listbox->getItem(1).getText() == "row 0" );
+
+  // clear() ends the virtual mode
+  listbox->clear();
+  CPPUNIT_ASSERT ( listbox->getCount() == 0 );
+  listbox->insert (L"extra");
+  CPPUNIT_ASSERT ( listbox->getCount() == 1 );
+  CPPUNIT_ASSERT ( listbox->getItem(1).getText() == "extra" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualSearchTest()
+{
+  CPPUNIT_ASSERT ( listbox->currentItem() == 1 );
+
+  // The incremental search also finds rows that are not loaded
+  test::pressKey (*listbox, 'r');
+  test::pressKey (*listbox, 'o');
+  test::pressKey (*listbox, 'w');
+  test::pressKey (*listbox, ' ');
+  test::pressKey (*listbox, '8');
+  test::pressKey (*listbox, '7');
+  test::pressKey (*listbox, '6');
+  CPPUNIT_ASSERT ( listbox->currentItem() == 877 );
+  CPPUNIT_ASSERT ( listbox->getItem(877).getText() == "row 876" );
+
+  // Characters without a match are ignored
+  test::pressKey (*listbox, 'x');
+  CPPUNIT_ASSERT ( listbox->currentItem() == 877 );
+
+  // The backspace key shortens the search text
+  test::pressKey (*listbox, finalcut::fc::Fkey_backspace);
+  CPPUNIT_ASSERT ( listbox->currentItem() == 88 );
+  CPPUNIT_ASSERT ( listbox->getItem(88).getText() == "row 87" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualSelectionTest()
+{
+  listbox->selectItem(5);
+  CPPUNIT_ASSERT ( listbox->isSelected(5) );
+
+  // The selection remains after scrolling past the loaded page
+  for (int n{0}; n < 30; n++)
+    test::pressKey (*listbox, finalcut::fc::Fkey_npage);
+
+  CPPUNIT_ASSERT ( listbox->currentItem() > 200 );
+  CPPUNIT_ASSERT ( listbox->isSelected(5) );
+  CPPUNIT_ASSERT ( ! listbox->isSelected(6) );
+  CPPUNIT_ASSERT ( listbox->getRowItem(5).isSelected() );
+  CPPUNIT_ASSERT ( listbox->getRowItem(5).getText() == "row 4" );
+
+  test::pressKey (*listbox, finalcut::fc::Fkey_home);
+  CPPUNIT_ASSERT ( listbox->isSelected(5) );
+  CPPUNIT_ASSERT ( listbox->getItem(5).isSelected() );
+
+  // A row that is not loaded can be selected
+  listbox->selectItem(900);
+  listbox->unselectItem(5);
+  CPPUNIT_ASSERT ( ! listbox->isSelected(5) );
+  CPPUNIT_ASSERT ( ! listbox->getItem(5).isSelected() );
+  listbox->setCurrentItem(900);
+  CPPUNIT_ASSERT ( listbox->isSelected(900) );
+  CPPUNIT_ASSERT ( listbox->getItem(900).isSelected() );
+
+  // Rows beyond a new row count lose their selection
+  listbox->setRowCount(500);
+  listbox->setRowCount(1000);
+  CPPUNIT_ASSERT ( ! listbox->isSelected(900) );
+
+  // The space bar toggles the current row in multi-selection mode
+  listbox->setMultiSelection();
+  listbox->setCurrentItem(42);
+  test::pressKey (*listbox, finalcut::fc::Fkey_space);
+  test::pressKey (*listbox, finalcut::fc::Fkey_end);
+  CPPUNIT_ASSERT ( listbox->isSelected(42) );
+  CPPUNIT_ASSERT ( listbox->getRowItem(42).isSelected() );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::scrollTest()
+{
+  // Five visible rows on terminal lines 3 to 7
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  listbox->setGeometry (finalcut::FPoint(3, 2), finalcut::FSize(20, 7));
+  listbox->show();
+
+  for (int n{0}; n < 4; n++)
+    test::pressKey (*listbox, finalcut::fc::Fkey_down);
+
+  CPPUNIT_ASSERT ( listbox->currentItem() == 5 );
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  test::pressKey (*listbox, finalcut::fc::Fkey_down);
+  listbox->updateTerminal();
+  const std::string output = emulator.getRecording();
+  emulator.setRecording(false);
+
+  // The terminal moves the rows inside the scroll region...
+  CPPUNIT_ASSERT ( output.find("\033[3;7r") != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("row 1") == std::string::npos );
+  CPPUNIT_ASSERT ( output.find("row 2") == std::string::npos );
+  CPPUNIT_ASSERT ( output.find("row 3") == std::string::npos );
+
+  // ...and only the exposed row is printed
+  CPPUNIT_ASSERT ( output.find("row 5") != std::string::npos );
+
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes(L"┌") );
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("row 1") );
+  CPPUNIT_ASSERT ( emulator.getLine(3).includes("row 2") );
+  CPPUNIT_ASSERT ( emulator.getLine(4).includes("row 3") );
+  CPPUNIT_ASSERT ( emulator.getLine(5).includes("row 4") );
+  CPPUNIT_ASSERT ( emulator.getLine(6).includes("row 5") );
+  CPPUNIT_ASSERT ( emulator.getLine(7).includes(L"└") );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::mergedScrollTest()
+{
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  listbox->setGeometry (finalcut::FPoint(3, 2), finalcut::FSize(20, 7));
+  listbox->show();
+
+  for (int n{0}; n < 4; n++)
+    test::pressKey (*listbox, finalcut::fc::Fkey_down);
+
+  // The scrolls between two frames are sent as one scroll
+  listbox->updateTerminal();
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  finalcut::FVTerm::setMaxFramesPerSecond(1);
+
+  for (int n{0}; n < 3; n++)
+    test::pressKey (*listbox, finalcut::fc::Fkey_down);
+
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  listbox->updateTerminal();
+  const std::string output = emulator.getRecording();
+  emulator.setRecording(false);
+
+  CPPUNIT_ASSERT ( output.find("\033[3;7r") != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("\033[3;7r")
+                   == output.rfind("\033[3;7r") );
+  CPPUNIT_ASSERT ( output.find("\033[3S") != std::string::npos );
+  CPPUNIT_ASSERT ( listbox->currentItem() == 8 );
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("row 3") );
+  CPPUNIT_ASSERT ( emulator.getLine(4).includes("row 5") );
+  CPPUNIT_ASSERT ( emulator.getLine(6).includes("row 7") );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FListBoxTest);
+
+// The general unit test main part
+#include <main-test.inc>
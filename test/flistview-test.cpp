@@ -0,0 +1,241 @@
+/***********************************************************************
+* flistview-test.cpp - FListView unit tests                            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+
+namespace
+{
+
+//----------------------------------------------------------------------
+finalcut::FListViewItem* getItem (finalcut::FObject::iterator iter)
+{
+  return static_cast<finalcut::FListViewItem*>(*iter);
+}
+
+//----------------------------------------------------------------------
+finalcut::FStringList getLine (const finalcut::FString& name)
+{
+  return finalcut::FStringList{ name, "1" };
+}
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+// class FListViewTest
+//----------------------------------------------------------------------
+
+class FListViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FListViewTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void countTest();
+    void treeCountTest();
+    void scrollTest();
+
+  private:
+    // Method
+    const std::string scroll (int);
+
+    // Data members
+    finalcut::FListView* listview{nullptr};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FListViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (countTest);
+    CPPUNIT_TEST (treeCountTest);
+    CPPUNIT_TEST (scrollTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FListViewTest::setUp()
+{
+  listview = new finalcut::FListView(&test::getApplication());
+  listview->setGeometry (finalcut::FPoint(1, 1), finalcut::FSize(30, 10));
+  listview->addColumn ("Name", 20);
+  listview->addColumn ("Size");
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::tearDown()
+{
+  delete listview;
+  listview = nullptr;
+}
+
+//----------------------------------------------------------------------
+const std::string FListViewTest::scroll (int wheel)
+{
+  // Returns the bytes of the terminal update after a wheel turn
+
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  finalcut::FWheelEvent ev (finalcut::fc::MouseWheel_Event
+                           , finalcut::FPoint(2, 2), wheel);
+  listview->onWheel (&ev);
+  const std::string output = emulator.getRecording();
+  emulator.setRecording(false);
+  return output;
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::classNameTest()
+{
+  const finalcut::FString& classname = listview->getClassName();
+  CPPUNIT_ASSERT ( classname == "FListView" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::countTest()
+{
+  CPPUNIT_ASSERT ( listview->getCount() == 0 );
+
+  for (int n{0}; n < 10000; n++)
+    listview->insert (getLine(finalcut::FString("row ") << n));
+
+  CPPUNIT_ASSERT ( listview->getCount() == 10000 );
+
+  // The counted lines are updated on insert
+  listview->insert (getLine("last"));
+  CPPUNIT_ASSERT ( listview->getCount() == 10001 );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::treeCountTest()
+{
+  listview->setTreeView();
+  const auto& folder_iter = listview->insert (getLine("folder"));
+  const auto& sub_iter = listview->insert (getLine("subfolder"), folder_iter);
+  listview->insert (getLine("file 1"), sub_iter);
+  listview->insert (getLine("file 2"), sub_iter);
+  listview->insert (getLine("file 3"), folder_iter);
+  listview->insert (getLine("other"));
+  auto folder = getItem(folder_iter);
+  auto subfolder = getItem(sub_iter);
+
+  // Collapsed items
+  CPPUNIT_ASSERT ( listview->getCount() == 2 );
+
+  folder->expand();
+  CPPUNIT_ASSERT ( listview->getCount() == 4 );
+
+  // A nested expansion changes the parents
+  subfolder->expand();
+  CPPUNIT_ASSERT ( listview->getCount() == 6 );
+
+  // Insertion into an expanded item
+  listview->insert (getLine("file 4"), sub_iter);
+  CPPUNIT_ASSERT ( listview->getCount() == 7 );
+
+  subfolder->collapse();
+  CPPUNIT_ASSERT ( listview->getCount() == 4 );
+
+  folder->collapse();
+  CPPUNIT_ASSERT ( listview->getCount() == 2 );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::scrollTest()
+{
+  // Eight rows on the terminal lines 2 to 9
+  for (int n{0}; n < 50; n++)
+    listview->insert (getLine(finalcut::FString("row ") << n));
+
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  listview->show();
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+
+  // The terminal moves the unchanged rows
+  std::string output = scroll(finalcut::fc::WheelDown);
+  CPPUNIT_ASSERT ( output.find("\033[2;9r") != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("row 5") == std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 4") );
+
+  // Sorting rebuilds all rows
+  listview->setColumnSort (1, finalcut::fc::descending);
+  listview->sort();
+  output = scroll(finalcut::fc::WheelDown);
+  CPPUNIT_ASSERT ( output.find("\033[2;9r") == std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 5") );
+
+  // Also an insertion
+  listview->insert (getLine("new row"));
+  output = scroll(finalcut::fc::WheelUp);
+  CPPUNIT_ASSERT ( output.find("\033[2;9r") == std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 9") );
+
+  // Also a resize
+  listview->setSize (finalcut::FSize(30, 9));
+  output = scroll(finalcut::fc::WheelDown);
+  CPPUNIT_ASSERT ( output.find("\033[2;8r") == std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 5") );
+
+  // Scrolling while the list view is hidden
+  listview->hide();
+  scroll(finalcut::fc::WheelDown);
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  listview->show();
+  listview->updateTerminal();
+  output = emulator.getRecording();
+  emulator.setRecording(false);
+  CPPUNIT_ASSERT ( output.find("\033[2;8r") == std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 46") );
+
+  // The terminal moves the rows again
+  output = scroll(finalcut::fc::WheelUp);
+  CPPUNIT_ASSERT ( output.find("\033[2;8r") != std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(1).includes("row 5") );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FListViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
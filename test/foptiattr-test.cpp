@@ -73,6 +73,7 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     void ansiTest();
     void vt100Test();
     void xtermTest();
+    void trueColorTest();
     void rxvtTest();
     void linuxTest();
     void cygwinTest();
@@ -96,6 +97,7 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (ansiTest);
     CPPUNIT_TEST (vt100Test);
     CPPUNIT_TEST (xtermTest);
+    CPPUNIT_TEST (trueColorTest);
     CPPUNIT_TEST (rxvtTest);
     CPPUNIT_TEST (linuxTest);
     CPPUNIT_TEST (cygwinTest);
@@ -1804,6 +1806,81 @@ void FOptiAttrTest::xtermTest()
   delete from;
 }
 
+//----------------------------------------------------------------------
+void FOptiAttrTest::trueColorTest()
+{
+  // Simulate a xterm-256color terminal with 24-bit colors
+
+  finalcut::FStartOptions::getFStartOptions().sgr_optimizer = false;
+  finalcut::FTrueColor::clear();
+  finalcut::FOptiAttr oa;
+  oa.setDefaultColorSupport();  // ANSI default color
+  oa.setMaxColor (256);
+  oa.setNoColorVideo (0);
+  oa.set_exit_attribute_mode (C_STR(CSI "0m"));
+  oa.set_a_foreground_color (C_STR(CSI "%?%p1%{8}%<"
+                                       "%t3%p1%d"
+                                       "%e%p1%{16}%<"
+                                       "%t9%p1%{8}%-%d"
+                                       "%e38;5;%p1%d%;m"));
+  oa.set_a_background_color (C_STR(CSI "%?%p1%{8}%<"
+                                       "%t4%p1%d"
+                                       "%e%p1%{16}%<"
+                                       "%t10%p1%{8}%-%d"
+                                       "%e48;5;%p1%d%;m"));
+  oa.set_orig_pair (C_STR(CSI "39;49m"));
+  oa.setTrueColor();
+  oa.initialize();
+
+  finalcut::FChar* from = new finalcut::FChar();
+  finalcut::FChar* to = new finalcut::FChar();
+  from->fg_color = finalcut::fc::Default;
+  from->bg_color = finalcut::fc::Default;
+
+  // Direct foreground and background color
+  to->fg_color = finalcut::FTrueColor::rgb(0x12, 0x34, 0x56);
+  to->bg_color = finalcut::FTrueColor::rgb(0xff, 0x80, 0x00);
+  CPPUNIT_ASSERT ( *from != *to );
+  CPPUNIT_ASSERT_CSTRING ( oa.changeAttribute(from, to)
+                         , C_STR(CSI "38;2;18;52;86m" CSI "48;2;255;128;0m") );
+  CPPUNIT_ASSERT ( *from == *to );
+
+  // The neighboring cell has the same colors
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to) == 0 );
+
+  // Only the background color changes
+  to->bg_color = finalcut::FTrueColor::rgb(0x12, 0x34, 0x56);
+  CPPUNIT_ASSERT_CSTRING ( oa.changeAttribute(from, to)
+                         , C_STR(CSI "48;2;18;52;86m") );
+  CPPUNIT_ASSERT ( *from == *to );
+
+  // Palette color after a direct color
+  to->fg_color = finalcut::fc::Red;
+  CPPUNIT_ASSERT_CSTRING ( oa.changeAttribute(from, to)
+                         , C_STR(CSI "31m") );
+  CPPUNIT_ASSERT ( *from == *to );
+
+  // Without 24-bit colors the nearest palette color is used
+  oa.unsetTrueColor();
+  to->fg_color = finalcut::FTrueColor::rgb(0xff, 0x00, 0x00);
+  to->bg_color = finalcut::FTrueColor::rgb(0x00, 0x00, 0xff);
+  CPPUNIT_ASSERT_CSTRING ( oa.changeAttribute(from, to)
+                         , C_STR(CSI "38;5;196m" CSI "48;5;21m") );
+  CPPUNIT_ASSERT ( to->fg_color == 196 );
+  CPPUNIT_ASSERT ( to->bg_color == 21 );
+  CPPUNIT_ASSERT ( *from == *to );
+
+  // A neighboring cell with the same approximation
+  to->fg_color = finalcut::FTrueColor::rgb(0xfe, 0x01, 0x01);
+  to->bg_color = finalcut::FTrueColor::rgb(0x01, 0x02, 0xfd);
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to) == 0 );
+  CPPUNIT_ASSERT ( *from == *to );
+
+  delete to;
+  delete from;
+  finalcut::FTrueColor::clear();
+}
+
 //----------------------------------------------------------------------
 void FOptiAttrTest::rxvtTest()
 {
@@ -0,0 +1,225 @@
+/***********************************************************************
+* fstring-bench.cpp - FString micro-benchmark                          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <chrono>
+#include <clocale>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <final/final.h>
+
+namespace
+{
+
+// Global variable
+volatile std::size_t sink{0};  // keeps the results alive
+
+//----------------------------------------------------------------------
+inline std::size_t getLength (const finalcut::FString& s)
+{ return s.getLength(); }
+
+//----------------------------------------------------------------------
+inline std::size_t getLength (const std::wstring& s)
+{ return s.length(); }
+
+//----------------------------------------------------------------------
+inline void insertAt ( finalcut::FString& s
+                     , const finalcut::FString& ins, std::size_t pos )
+{ s.insert (ins, pos); }
+
+//----------------------------------------------------------------------
+inline void insertAt ( std::wstring& s
+                     , const std::wstring& ins, std::size_t pos )
+{ s.insert (pos, ins); }
+
+//----------------------------------------------------------------------
+inline void removeAt (finalcut::FString& s, std::size_t pos, std::size_t len)
+{ s.remove (pos, len); }
+
+//----------------------------------------------------------------------
+inline void removeAt (std::wstring& s, std::size_t pos, std::size_t len)
+{ s.erase (pos, len); }
+
+//----------------------------------------------------------------------
+template <typename Func>
+double measure (Func&& func)
+{
+  // Returns the best time of one run in nanoseconds
+
+  constexpr int repetitions = 7;
+  constexpr int runs = 200;
+  double best{0.0};
+
+  for (int r{0}; r < repetitions; r++)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i{0}; i < runs; i++)
+      func();
+
+    const auto end = std::chrono::steady_clock::now();
+    const std::chrono::duration<double, std::nano> time = end - start;
+    const double ns = time.count() / runs;
+
+    if ( r == 0 || ns < best )
+      best = ns;
+  }
+
+  return best;
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void appendChar()
+{
+  StringT str{};
+
+  for (int i{0}; i < 1000; i++)
+    str += L'x';
+
+  sink = sink + getLength(str);
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void appendWord()
+{
+  StringT str{};
+
+  for (int i{0}; i < 200; i++)
+    str += L"word ";
+
+  sink = sink + getLength(str);
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void concatChain()
+{
+  const StringT a(L"abcdefgh");
+  const StringT b(L"ijklmnop");
+
+  for (int i{0}; i < 100; i++)
+  {
+    StringT str = a + b + a + b + L'.';
+    sink = sink + getLength(str);
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void insertFront()
+{
+  StringT str(500, L'-');
+  const StringT ins(L"ab");
+
+  for (int i{0}; i < 100; i++)
+    insertAt (str, ins, 0);
+
+  sink = sink + getLength(str);
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void removeFront()
+{
+  StringT str(1000, L'-');
+
+  while ( getLength(str) > 0 )
+    removeAt (str, 0, 1);
+
+  sink = sink + getLength(str);
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void vectorGrowth()
+{
+  const StringT line(30, L'=');
+  std::vector<StringT> list{};
+
+  for (int i{0}; i < 1000; i++)
+    list.push_back(line);
+
+  sink = sink + list.size();
+}
+
+//----------------------------------------------------------------------
+template <typename StringT>
+void shortCopy()
+{
+  const StringT label(L"clicked");
+
+  for (int i{0}; i < 1000; i++)
+  {
+    StringT copy(label);
+    sink = sink + getLength(copy);
+  }
+}
+
+//----------------------------------------------------------------------
+void printResult ( const char name[]
+                 , double fstring_ns
+                 , double wstring_ns )
+{
+  std::printf ( "%-14s %12.0f %12.0f %8.2f\n"
+              , name, fstring_ns, wstring_ns, fstring_ns / wstring_ns );
+}
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+int main()
+{
+  std::setlocale (LC_CTYPE, "");
+
+  // Machine-readable output: one scenario per line
+  std::printf ( "%-14s %12s %12s %8s\n"
+              , "# scenario", "fstring_ns", "wstring_ns", "ratio" );
+
+  printResult ( "append_char"
+              , measure(appendChar<finalcut::FString>)
+              , measure(appendChar<std::wstring>) );
+  printResult ( "append_word"
+              , measure(appendWord<finalcut::FString>)
+              , measure(appendWord<std::wstring>) );
+  printResult ( "concat_chain"
+              , measure(concatChain<finalcut::FString>)
+              , measure(concatChain<std::wstring>) );
+  printResult ( "insert_front"
+              , measure(insertFront<finalcut::FString>)
+              , measure(insertFront<std::wstring>) );
+  printResult ( "remove_front"
+              , measure(removeFront<finalcut::FString>)
+              , measure(removeFront<std::wstring>) );
+  printResult ( "vector_growth"
+              , measure(vectorGrowth<finalcut::FString>)
+              , measure(vectorGrowth<std::wstring>) );
+  printResult ( "short_copy"
+              , measure(shortCopy<finalcut::FString>)
+              , measure(shortCopy<std::wstring>) );
+  return 0;
+}
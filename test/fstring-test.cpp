@@ -28,6 +28,7 @@
 #include <clocale>
 #include <iomanip>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
@@ -57,6 +58,7 @@ class FStringTest : public CPPUNIT_NS::TestFixture
     void classNameTest();
     void noArgumentTest();
     void initLengthTest();
+    void bufferTest();
     void copyConstructorTest();
     void assignmentTest();
     void additionAssignmentTest();
@@ -85,6 +87,7 @@ class FStringTest : public CPPUNIT_NS::TestFixture
     void removeTest();
     void includesTest();
     void controlCodesTest();
+    void stringViewTest();
 
   private:
     finalcut::FString* s{0};
@@ -96,6 +99,7 @@ class FStringTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (classNameTest);
     CPPUNIT_TEST (noArgumentTest);
     CPPUNIT_TEST (initLengthTest);
+    CPPUNIT_TEST (bufferTest);
     CPPUNIT_TEST (copyConstructorTest);
     CPPUNIT_TEST (assignmentTest);
     CPPUNIT_TEST (additionAssignmentTest);
@@ -124,6 +128,7 @@ class FStringTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (removeTest);
     CPPUNIT_TEST (includesTest);
     CPPUNIT_TEST (controlCodesTest);
+    CPPUNIT_TEST (stringViewTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -223,13 +228,13 @@ void FStringTest::initLengthTest()
   constexpr std::size_t x2 = 10;
   const finalcut::FString s2(x1);
   CPPUNIT_ASSERT ( s2.getLength() == 10 );
-  CPPUNIT_ASSERT ( s2.capacity() == 25 );
+  CPPUNIT_ASSERT ( s2.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s2.isNull() );
   CPPUNIT_ASSERT ( s2.isEmpty() );
 
   const finalcut::FString s3(x2);
   CPPUNIT_ASSERT ( s3.getLength() == 10 );
-  CPPUNIT_ASSERT ( s3.capacity() == 25 );
+  CPPUNIT_ASSERT ( s3.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s3.isNull() );
   CPPUNIT_ASSERT ( s3.isEmpty() );
 
@@ -258,29 +263,146 @@ void FStringTest::initLengthTest()
 
   const finalcut::FString s8(x2, '-');
   CPPUNIT_ASSERT ( s8.getLength() == 10 );
-  CPPUNIT_ASSERT ( s8.capacity() == 25 );
+  CPPUNIT_ASSERT ( s8.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s8.isNull() );
   CPPUNIT_ASSERT ( ! s8.isEmpty() );
 
   const finalcut::FString s9(x1, L'-');
   CPPUNIT_ASSERT ( s9.getLength() == 10 );
-  CPPUNIT_ASSERT ( s9.capacity() == 25 );
+  CPPUNIT_ASSERT ( s9.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s9.isNull() );
   CPPUNIT_ASSERT ( ! s9.isEmpty() );
 
   const finalcut::FString s10(x2, L'-');
   CPPUNIT_ASSERT ( s10.getLength() == 10 );
-  CPPUNIT_ASSERT ( s10.capacity() == 25 );
+  CPPUNIT_ASSERT ( s10.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s10.isNull() );
   CPPUNIT_ASSERT ( ! s10.isEmpty() );
 
   const finalcut::FString s11(x2, wchar_t(0));
   CPPUNIT_ASSERT ( s11.getLength() == 10 );
-  CPPUNIT_ASSERT ( s11.capacity() == 25 );
+  CPPUNIT_ASSERT ( s11.capacity() == 15 );
   CPPUNIT_ASSERT ( ! s11.isNull() );
   CPPUNIT_ASSERT ( s11.isEmpty() );
 }
 
+//----------------------------------------------------------------------
+void FStringTest::bufferTest()
+{
+  // Short strings are stored inside the object
+  finalcut::FString s1("123456789012345");
+  CPPUNIT_ASSERT ( s1.getLength() == 15 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
+
+  // Longer strings are stored on the heap and grow geometrically
+  s1 << '6';
+  CPPUNIT_ASSERT ( s1 == L"1234567890123456" );
+  CPPUNIT_ASSERT ( s1.getLength() == 16 );
+  CPPUNIT_ASSERT ( s1.capacity() == 45 );
+
+  // Removing a few characters keeps the buffer
+  s1.remove(0, 2);
+  CPPUNIT_ASSERT ( s1 == L"34567890123456" );
+  CPPUNIT_ASSERT ( s1.capacity() == 45 );
+
+  // A mostly unused buffer is reduced
+  s1.remove(0, 12);
+  CPPUNIT_ASSERT ( s1 == L"56" );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
+  finalcut::FString s7(200, L'x');
+  s7.remove(10, 150);
+  CPPUNIT_ASSERT ( s7 == finalcut::FString(50, L'x') );
+  CPPUNIT_ASSERT ( s7.capacity() == 65 );
+
+  // The move constructor takes over the buffer
+  finalcut::FString s4(40, L'.');
+  const wchar_t* buffer = s4.wc_str();
+  finalcut::FString s5(std::move(s4));
+  CPPUNIT_ASSERT ( s5.wc_str() == buffer );
+  CPPUNIT_ASSERT ( s5.getLength() == 40 );
+  CPPUNIT_ASSERT ( s4.isNull() );
+
+  // Short strings are copied on move
+  finalcut::FString s6("short");
+  s4 = std::move(s6);
+  CPPUNIT_ASSERT ( s4 == L"short" );
+  CPPUNIT_ASSERT ( s6.isNull() );
+
+  // Appending to a temporary and to a copy
+  s4 = std::move(s5) + s1 + L'!' + '?';
+  CPPUNIT_ASSERT ( s4.getLength() == 44 );
+  CPPUNIT_ASSERT ( s4.right(4) == L"56!?" );
+  CPPUNIT_ASSERT ( s1 + L'!' == L"56!" );
+  const finalcut::FString& const_s1 = s1;
+  CPPUNIT_ASSERT ( const_s1 + '?' == L"56?" );
+
+  // Inserting a part of the own string
+  s1 = "abcdef";
+  s1.insert(s1.mid(3, 2), 1);
+  CPPUNIT_ASSERT ( s1 == L"acdbcdef" );
+  s1 += s1;
+  CPPUNIT_ASSERT ( s1 == L"acdbcdefacdbcdef" );
+
+  const finalcut::FString s2(20, L'-');
+  CPPUNIT_ASSERT ( s2.getLength() == 20 );
+  CPPUNIT_ASSERT ( s2.capacity() == 35 );
+
+  // The c-string conversion is cached until the next modification
+  finalcut::FString s3("ascii");
+  const char* cstr = s3.c_str();
+  CPPUNIT_ASSERT ( std::strcmp(cstr, "ascii") == 0 );
+  CPPUNIT_ASSERT ( s3.c_str() == cstr );
+  s3 << L" ¼";
+  CPPUNIT_ASSERT ( std::strcmp(s3.c_str(), "ascii ¼") == 0 );
+  s3[0] = L'A';
+  CPPUNIT_ASSERT ( std::strcmp(s3.c_str(), "Ascii ¼") == 0 );
+  s3 = "¼ ascii";
+  CPPUNIT_ASSERT ( s3.getLength() == 7 );
+  CPPUNIT_ASSERT ( std::strcmp(s3.c_str(), "¼ ascii") == 0 );
+
+  // No cache after handing out a pointer, an iterator or a reference
+  finalcut::FString s8("abc");
+  wchar_t* wstr = s8.wc_str();
+  CPPUNIT_ASSERT ( std::strcmp(s8.c_str(), "abc") == 0 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(s8) == 3 );
+  wstr[0] = L'¼';
+  CPPUNIT_ASSERT ( std::strcmp(s8.c_str(), "¼bc") == 0 );
+  finalcut::FString s9(L"abc");
+  auto iter = s9.begin();
+  wchar_t& ch = s9[2];
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(s9) == 3 );
+
+  if ( finalcut::hasFullWidthSupports() )
+  {
+    *iter = L'日';
+    CPPUNIT_ASSERT ( finalcut::getColumnWidth(s9) == 4 );
+    ch = L'本';
+    CPPUNIT_ASSERT ( finalcut::getColumnWidth(s9) == 5 );
+  }
+
+  // A copy is cached again
+  const finalcut::FString s10(s9);
+  CPPUNIT_ASSERT ( s10 == s9 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(s10)
+                   == finalcut::getColumnWidth(s9) );
+
+  // A modification invalidates the pointers handed out before,
+  // so the caches are used again. The write through the old
+  // pointer is not allowed and only shows the cached values.
+  finalcut::FString s11("abc");
+  wchar_t* old_wstr = s11.wc_str();
+  s11 = "xyz";
+  CPPUNIT_ASSERT ( std::strcmp(s11.c_str(), "xyz") == 0 );
+  old_wstr[0] = L'w';
+  CPPUNIT_ASSERT ( std::strcmp(s11.c_str(), "xyz") == 0 );
+  s11.wc_str();
+  s11.clear();
+  s11.setString("abc");
+  CPPUNIT_ASSERT ( std::strcmp(s11.c_str(), "abc") == 0 );
+  s11.wc_str()[0] = L'x';
+  CPPUNIT_ASSERT ( std::strcmp(s11.c_str(), "xbc") == 0 );
+}
+
 //----------------------------------------------------------------------
 void FStringTest::copyConstructorTest()
 {
@@ -288,7 +410,7 @@ void FStringTest::copyConstructorTest()
   const finalcut::FString s2(s1);
   CPPUNIT_ASSERT ( s2 == L"abc" );
   CPPUNIT_ASSERT ( s2.getLength() == 3 );
-  CPPUNIT_ASSERT ( s2.capacity() == 18 );
+  CPPUNIT_ASSERT ( s2.capacity() == 15 );
 }
 
 //----------------------------------------------------------------------
@@ -335,49 +457,49 @@ void FStringTest::assignmentTest()
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"abc" );
   CPPUNIT_ASSERT ( s1.getLength() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   const std::wstring s3(L"def");
   s1 = s3;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"def" );
   CPPUNIT_ASSERT ( s1.getLength() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   const std::string s4("ghi");
   s1 = s4;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"ghi" );
   CPPUNIT_ASSERT ( s1.getLength() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   constexpr wchar_t s5[] = L"abc";
   s1 = s5;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"abc" );
   CPPUNIT_ASSERT ( s1.getLength() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   constexpr char s6[] = "def";
   s1 = s6;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"def" );
   CPPUNIT_ASSERT ( s1.getLength() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   constexpr wchar_t s7 = L'#';
   s1 = s7;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"#" );
   CPPUNIT_ASSERT ( s1.getLength() == 1 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   constexpr char s8 = '%';
   s1 = s8;
   CPPUNIT_ASSERT ( s1 );
   CPPUNIT_ASSERT ( s1 == L"%" );
   CPPUNIT_ASSERT ( s1.getLength() == 1 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
 
   s1.setString("A character string");
   CPPUNIT_ASSERT ( s1 );
@@ -482,7 +604,7 @@ void FStringTest::additionAssignmentTest()
 //----------------------------------------------------------------------
 void FStringTest::additionTest()
 {
-  // finalcut::FString member operator
+  // Constant finalcut::FString on the left side
   const finalcut::FString s1("abc");
   CPPUNIT_ASSERT ( s1 + finalcut::FString("def") == L"abcdef" );
   CPPUNIT_ASSERT ( s1 + std::wstring(L"def") == L"abcdef" );
@@ -492,7 +614,7 @@ void FStringTest::additionTest()
   CPPUNIT_ASSERT ( s1 + wchar_t(L'd') == L"abcd" );
   CPPUNIT_ASSERT ( s1 + char('d') == L"abcd" );
 
-  // finalcut::FString non-member operator
+  // Non-constant finalcut::FString on the left side
   finalcut::FString s2("abc");
   CPPUNIT_ASSERT ( s2 + finalcut::FString("def") == L"abcdef" );
   CPPUNIT_ASSERT ( s2 + std::wstring(L"def") == L"abcdef" );
@@ -521,6 +643,32 @@ void FStringTest::additionTest()
   constexpr char c2 = 'a';
   CPPUNIT_ASSERT ( c2 + s5 == "aabc" );
   CPPUNIT_ASSERT ( c2 + finalcut::FString("def") == L"adef" );
+
+  // Null string operands
+  const finalcut::FString null_str{};
+  CPPUNIT_ASSERT ( null_str + finalcut::FString("def") == L"def" );
+  CPPUNIT_ASSERT ( null_str + wchar_t(L'd') == L"d" );
+  CPPUNIT_ASSERT ( null_str + char('d') == L"d" );
+  CPPUNIT_ASSERT ( s2 + null_str == L"abc" );
+  CPPUNIT_ASSERT ( s3 + null_str == L"abc" );
+  CPPUNIT_ASSERT ( c1 + null_str == L"a" );
+  CPPUNIT_ASSERT ( (null_str + null_str).isNull() );
+
+  // Temporary finalcut::FString operands
+  CPPUNIT_ASSERT ( finalcut::FString("abc") + s1 == L"abcabc" );
+  CPPUNIT_ASSERT ( s1 + finalcut::FString("def") == L"abcdef" );
+  CPPUNIT_ASSERT ( finalcut::FString("a") + finalcut::FString("b") == L"ab" );
+  CPPUNIT_ASSERT ( finalcut::FString("ab") + wchar_t(L'c') == L"abc" );
+  CPPUNIT_ASSERT ( finalcut::FString("ab") + char('c') == L"abc" );
+  CPPUNIT_ASSERT ( s2 + std::move(s2) == L"abcabc" );
+
+  // A chained concatenation appends to the buffer of the left operand
+  finalcut::FString s7("0123456789abcdefghij");  // Heap buffer
+  const wchar_t* buffer = static_cast<const finalcut::FString&>(s7).wc_str();
+  const finalcut::FString s8 = std::move(s7) + "-" + L'x' + 'y'
+                             + finalcut::FString("z");
+  CPPUNIT_ASSERT ( s8 == L"0123456789abcdefghij-xyz" );
+  CPPUNIT_ASSERT ( s8.wc_str() == buffer );
 }
 
 //----------------------------------------------------------------------
@@ -553,7 +701,7 @@ void FStringTest::equalTest()
   CPPUNIT_ASSERT ( one_char == ch );
   CPPUNIT_ASSERT ( ch == one_char.c_str()[0] );
   CPPUNIT_ASSERT ( one_char.getLength() == 1 );
-  CPPUNIT_ASSERT ( one_char.capacity() == 16 );
+  CPPUNIT_ASSERT ( one_char.capacity() == 15 );
 
   constexpr wchar_t wch = L'a';
   CPPUNIT_ASSERT ( one_char == wch );
@@ -568,7 +716,7 @@ void FStringTest::equalTest()
   CPPUNIT_ASSERT ( str == cstr );
   CPPUNIT_ASSERT ( str.getLength() == 3 );
   CPPUNIT_ASSERT ( str.getUTF8length() == 3 );
-  CPPUNIT_ASSERT ( str.capacity() == 18 );
+  CPPUNIT_ASSERT ( str.capacity() == 15 );
   CPPUNIT_ASSERT ( strncmp(cstr, str.c_str(), 3) == 0 );
 
   constexpr wchar_t wcstr[] = L"abc";
@@ -589,7 +737,7 @@ void FStringTest::equalTest()
 
   CPPUNIT_ASSERT ( s->c_str()[0] == 'c');
   CPPUNIT_ASSERT ( s->getLength() == 1 );
-  CPPUNIT_ASSERT ( s->capacity() == 16 );
+  CPPUNIT_ASSERT ( s->capacity() == 15 );
 }
 
 //----------------------------------------------------------------------
@@ -600,7 +748,7 @@ void FStringTest::notEqualTest()
   CPPUNIT_ASSERT ( one_char != ch );
   CPPUNIT_ASSERT ( ch != one_char.c_str()[0] );
   CPPUNIT_ASSERT ( one_char.getLength() == 1 );
-  CPPUNIT_ASSERT ( one_char.capacity() == 16 );
+  CPPUNIT_ASSERT ( one_char.capacity() == 15 );
 
   constexpr wchar_t wch = L'_';
   CPPUNIT_ASSERT ( one_char != wch );
@@ -618,8 +766,8 @@ void FStringTest::notEqualTest()
   CPPUNIT_ASSERT ( strlen(s2.c_str()) == 6 );
   CPPUNIT_ASSERT ( s1.getUTF8length() == 3 );
   CPPUNIT_ASSERT ( s2.getUTF8length() == 3 );
-  CPPUNIT_ASSERT ( s1.capacity() == 18 );
-  CPPUNIT_ASSERT ( s2.capacity() == 18 );
+  CPPUNIT_ASSERT ( s1.capacity() == 15 );
+  CPPUNIT_ASSERT ( s2.capacity() == 15 );
   CPPUNIT_ASSERT ( strncmp(cstr, s1.c_str(), 3) != 0 );
 
   constexpr wchar_t wcstr[] = L"abc";
@@ -1903,6 +2051,75 @@ void FStringTest::controlCodesTest()
   CPPUNIT_ASSERT ( cc.replaceControlCodes() == "t␈␈Tes␡Tt" );
 }
 
+//----------------------------------------------------------------------
+void FStringTest::stringViewTest()
+{
+  const finalcut::FStringView null_view{};
+  CPPUNIT_ASSERT ( null_view.getClassName() == "FStringView" );
+  CPPUNIT_ASSERT ( null_view.isNull() );
+  CPPUNIT_ASSERT ( null_view.isEmpty() );
+  CPPUNIT_ASSERT ( null_view.getSize() == 0 );
+  CPPUNIT_ASSERT ( null_view.begin() == null_view.end() );
+  CPPUNIT_ASSERT ( finalcut::FString(null_view).isNull() );
+
+  const finalcut::FString str(L"Hello");
+  const finalcut::FStringView wide_view(str);
+  CPPUNIT_ASSERT ( ! wide_view.isNull() );
+  CPPUNIT_ASSERT ( ! wide_view.isEmpty() );
+  CPPUNIT_ASSERT ( wide_view.isWide() );
+  CPPUNIT_ASSERT ( wide_view.getSize() == 5 );
+  CPPUNIT_ASSERT ( wide_view.getWideData() == str.wc_str() );
+  CPPUNIT_ASSERT ( str == wide_view );
+  CPPUNIT_ASSERT ( str == finalcut::FStringView(L"Hello") );
+  CPPUNIT_ASSERT ( str != finalcut::FStringView(L"Hell") );
+  CPPUNIT_ASSERT ( str != finalcut::FStringView(L"Hello!") );
+  CPPUNIT_ASSERT ( str == finalcut::FStringView(L"Hello world", 5) );
+  CPPUNIT_ASSERT ( finalcut::FString(wide_view) == L"Hello" );
+
+  const std::wstring wstr(L"world");
+  const finalcut::FStringView wstr_view(wstr);
+  CPPUNIT_ASSERT ( wstr_view.getWideData() == wstr.c_str() );
+  CPPUNIT_ASSERT ( finalcut::FString(wstr_view) == L"world" );
+
+  // Multibyte views are decoded while iterating
+  const finalcut::FStringView mb_view("Größe ½");
+  CPPUNIT_ASSERT ( ! mb_view.isWide() );
+  CPPUNIT_ASSERT ( mb_view.getSize() == 10 );
+  CPPUNIT_ASSERT ( finalcut::FString("Größe ½") == mb_view );
+  CPPUNIT_ASSERT ( finalcut::FString(mb_view) == L"Größe ½" );
+  CPPUNIT_ASSERT ( finalcut::FString(mb_view).getLength() == 7 );
+
+  std::size_t count{0};
+
+  for (auto&& ch : mb_view)
+  {
+    CPPUNIT_ASSERT ( ch == L"Größe ½"[count] );
+    count++;
+  }
+
+  CPPUNIT_ASSERT ( count == 7 );
+
+  const std::string utf8_str("abc");
+  const finalcut::FStringView str_view(utf8_str);
+  CPPUNIT_ASSERT ( str_view.getMultibyteData() == utf8_str.c_str() );
+  CPPUNIT_ASSERT ( finalcut::FString(str_view) == L"abc" );
+  CPPUNIT_ASSERT ( finalcut::FString(finalcut::FStringView("abcdef", 3))
+                   == L"abc" );
+
+  // An invalid byte sequence results in a replacement character
+  const finalcut::FStringView invalid_view("a\xff" "b");
+  CPPUNIT_ASSERT ( finalcut::FString(invalid_view) == L"a\xfffd" L"b" );
+
+  const finalcut::FStringView empty_view("");
+  CPPUNIT_ASSERT ( ! empty_view.isNull() );
+  CPPUNIT_ASSERT ( empty_view.isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FString(empty_view).isEmpty() );
+  CPPUNIT_ASSERT ( ! finalcut::FString(empty_view).isNull() );
+  CPPUNIT_ASSERT ( finalcut::FString("") == empty_view );
+  CPPUNIT_ASSERT ( finalcut::FString() != empty_view );
+  CPPUNIT_ASSERT ( finalcut::FString() == null_view );
+}
+
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FStringTest);
 
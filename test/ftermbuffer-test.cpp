@@ -0,0 +1,121 @@
+/***********************************************************************
+* ftermbuffer-test.cpp - FTermBuffer unit tests                        *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermBufferTest
+//----------------------------------------------------------------------
+
+class FTermBufferTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermBufferTest()
+    { }
+
+  protected:
+    void classNameTest();
+    void writeTest();
+    void compactionTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermBufferTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (writeTest);
+    CPPUNIT_TEST (compactionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTermBufferTest::classNameTest()
+{
+  const finalcut::FTermBuffer buffer;
+  const finalcut::FString& classname = buffer.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermBuffer" );
+}
+
+//----------------------------------------------------------------------
+void FTermBufferTest::writeTest()
+{
+  finalcut::FTermBuffer buffer;
+  CPPUNIT_ASSERT ( buffer.isEmpty() );
+  buffer << "ab" << L"e\x0301";
+  CPPUNIT_ASSERT ( buffer.getLength() == 3 );
+  CPPUNIT_ASSERT ( buffer.toString() == L"abe\x0301" );
+
+  // Copies have their own cells
+  finalcut::FTermBuffer copy(buffer);
+  finalcut::FTermBuffer assigned;
+  assigned = copy;
+  copy.clear();
+  CPPUNIT_ASSERT ( copy.isEmpty() );
+  CPPUNIT_ASSERT ( assigned.toString() == L"abe\x0301" );
+  CPPUNIT_ASSERT ( buffer.toString() == L"abe\x0301" );
+}
+
+//----------------------------------------------------------------------
+void FTermBufferTest::compactionTest()
+{
+  // Compaction needs an application without a terminal
+  int argc{2};
+  char arg0[] = "ftermbuffer-test";
+  char arg1[] = "--headless";
+  char* argv[] = { arg0, arg1, nullptr };
+  finalcut::FApplication app(argc, argv);
+
+  // The first cluster is not used anywhere
+  finalcut::FGlyphStore::combine(L'b', L'\x0300');
+  finalcut::FTermBuffer buffer;
+  buffer << L"e\x0301";
+  const finalcut::FTermBuffer copy(buffer);
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 2 );
+
+  // Clearing the desktop releases the unused clusters
+  const uInt generation = finalcut::FGlyphStore::getGeneration();
+  app.redraw();
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getGeneration() != generation );
+  CPPUNIT_ASSERT ( finalcut::FGlyphStore::getCount() == 1 );
+
+  // The cells of the term buffers have been relocated
+  CPPUNIT_ASSERT ( buffer.toString() == L"e\x0301" );
+  CPPUNIT_ASSERT ( copy.toString() == L"e\x0301" );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermBufferTest);
+
+// The general unit test main part
+#include <main-test.inc>
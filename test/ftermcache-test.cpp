@@ -0,0 +1,258 @@
+/***********************************************************************
+* ftermcache-test.cpp - FTermCache unit tests                          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermCacheTest
+//----------------------------------------------------------------------
+
+class FTermCacheTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermCacheTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void fileNameTest();
+    void saveLoadTest();
+    void keyTest();
+    void sessionTest();
+    void noReplyTest();
+    void expiryTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermCacheTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (fileNameTest);
+    CPPUNIT_TEST (saveLoadTest);
+    CPPUNIT_TEST (keyTest);
+    CPPUNIT_TEST (sessionTest);
+    CPPUNIT_TEST (noReplyTest);
+    CPPUNIT_TEST (expiryTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data members
+    std::string cache_home{};
+};
+
+
+//----------------------------------------------------------------------
+void FTermCacheTest::setUp()
+{
+  char dir_template[] = "/tmp/ftermcache-test.XXXXXX";
+  const char* dir = mkdtemp(dir_template);
+  CPPUNIT_ASSERT ( dir != nullptr );
+  cache_home = dir;
+  setenv ("XDG_CACHE_HOME", cache_home.c_str(), 1);
+  setenv ("TERM", "xterm-256color", 1);
+  finalcut::FTermCache::clear();
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::tearDown()
+{
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+
+  if ( ! filename.isEmpty() )
+    std::remove (filename.c_str());
+
+  rmdir ((cache_home + "/finalcut").c_str());
+  rmdir (cache_home.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::classNameTest()
+{
+  const finalcut::FTermCache cache;
+  const finalcut::FString& classname = cache.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermCache" );
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::fileNameTest()
+{
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+  const finalcut::FString directory(cache_home + "/finalcut/terminal-");
+  CPPUNIT_ASSERT ( filename.left(directory.getLength()) == directory );
+  CPPUNIT_ASSERT ( filename.right(6) == ".cache" );
+
+  // Relative cache directories are ignored
+  setenv ("XDG_CACHE_HOME", "relative/path", 1);
+  setenv ("HOME", "/home/user", 1);
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getFileName().left(23)
+                   == "/home/user/.cache/final" );
+  setenv ("XDG_CACHE_HOME", cache_home.c_str(), 1);
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::saveLoadTest()
+{
+  // Nothing was stored yet
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::isLoaded() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getMaxColor() == -1 );
+
+  finalcut::FTermCache::setAnswerback ("PuTTY");
+  finalcut::FTermCache::setPrimaryDA ("\033[?6c");
+  finalcut::FTermCache::setSecondaryDA ("\033[>0;136;0c");
+  finalcut::FTermCache::setMaxColor (256);
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+
+  finalcut::FTermCache::clear();
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getAnswerback().isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::isLoaded() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getAnswerback() == "PuTTY" );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getPrimaryDA() == "\033[?6c" );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getSecondaryDA()
+                   == "\033[>0;136;0c" );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getMaxColor() == 256 );
+
+  // Control characters and backslashes are escaped in the file
+  finalcut::FTermCache::setAnswerback ("a\\x1b\nb");
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getAnswerback() == "a\\x1b\nb" );
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::keyTest()
+{
+  finalcut::FTermCache::setPrimaryDA ("\033[?62;22c");
+  finalcut::FTermCache::setSecondaryDA ("\033[>41;351;0c");
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+
+  // Another terminal uses another cache file
+  setenv ("TERM", "rxvt", 1);
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getFileName() != filename );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getSecondaryDA().isEmpty() );
+
+  setenv ("TERM", "xterm-256color", 1);
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getSecondaryDA()
+                   == "\033[>41;351;0c" );
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::sessionTest()
+{
+  finalcut::FTermCache::setPrimaryDA ("\033[?62;22c");
+  finalcut::FTermCache::setSecondaryDA ("\033[>41;351;0c");
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+
+  // A new terminal on the same device or another terminal size
+  // does not use the entry
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+  std::FILE* fp = std::fopen(filename.c_str(), "a");
+  CPPUNIT_ASSERT ( fp != nullptr );
+  std::fputs ("session=1;132x43\n", fp);
+  std::fclose (fp);
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::isLoaded() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getSecondaryDA().isEmpty() );
+
+  // The new replies overwrite the same file
+  finalcut::FTermCache::setPrimaryDA ("\033[?1;2c");
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getFileName() == filename );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getPrimaryDA() == "\033[?1;2c" );
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::noReplyTest()
+{
+  // A terminal that answers no query is not stored
+  finalcut::FTermCache::setMaxColor (16);
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+
+  finalcut::FTermCache::setSecondaryDA ("\033[>41;351;0c");
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+
+  // An old cache file without the primary device attributes
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+  finalcut::FTermCache::setPrimaryDA ("\033[?62;22c");
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  std::FILE* fp = std::fopen(filename.c_str(), "a");
+  CPPUNIT_ASSERT ( fp != nullptr );
+  std::fputs ("primary_da=\n", fp);
+  std::fclose (fp);
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::isLoaded() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getMaxColor() == -1 );
+}
+
+//----------------------------------------------------------------------
+void FTermCacheTest::expiryTest()
+{
+  finalcut::FTermCache::setPrimaryDA ("\033[?62;22c");
+  finalcut::FTermCache::setMaxColor (16);
+  CPPUNIT_ASSERT ( finalcut::FTermCache::save() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::load() );
+
+  // A cache file older than one week is ignored
+  const finalcut::FString filename = finalcut::FTermCache::getFileName();
+  struct utimbuf times{};
+  times.actime = std::time(nullptr) - 8 * 24 * 60 * 60;
+  times.modtime = times.actime;
+  CPPUNIT_ASSERT ( utime(filename.c_str(), &times) == 0 );
+  CPPUNIT_ASSERT ( ! finalcut::FTermCache::load() );
+  CPPUNIT_ASSERT ( finalcut::FTermCache::getMaxColor() == -1 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermCacheTest);
+
+// The general unit test main part
+#include <main-test.inc>
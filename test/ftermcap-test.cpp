@@ -0,0 +1,334 @@
+/***********************************************************************
+* ftermcap-test.cpp - FTermcap unit tests                              *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <unistd.h>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <final/final.h>
+
+#define CPPUNIT_ASSERT_CSTRING(expected, actual) \
+            check_c_string (expected, actual, CPPUNIT_SOURCELINE())
+
+//----------------------------------------------------------------------
+void check_c_string ( const char* s1
+                    , const char* s2
+                    , CppUnit::SourceLine sourceLine )
+{
+  if ( s1 == 0 && s2 == 0 )  // Strings are equal
+    return;
+
+  if ( s1 && s2 && std::strcmp (s1, s2) == 0 )  // Strings are equal
+      return;
+
+  ::CppUnit::Asserter::fail ("Strings are not equal", sourceLine);
+}
+
+//----------------------------------------------------------------------
+namespace test
+{
+
+// Capabilities that are compared with the terminfo database
+static const finalcut::fc::termcaps compared_caps[] =
+{
+  finalcut::fc::t_bell,
+  finalcut::fc::t_clear_screen,
+  finalcut::fc::t_clr_eol,
+  finalcut::fc::t_cursor_home,
+  finalcut::fc::t_cursor_address,
+  finalcut::fc::t_cursor_up,
+  finalcut::fc::t_parm_up_cursor,
+  finalcut::fc::t_change_scroll_region,
+  finalcut::fc::t_enter_bold_mode,
+  finalcut::fc::t_enter_reverse_mode,
+  finalcut::fc::t_exit_attribute_mode,
+  finalcut::fc::t_orig_pair
+};
+
+//----------------------------------------------------------------------
+void initTermcap (const char termtype[])
+{
+  // Reads the capabilities of the terminal type
+
+  finalcut::FTermData& data = *finalcut::FTerm::getFTermData();
+  data.setTermType (termtype);
+  finalcut::FTermcap::max_color = 1;  // Only raised by init()
+  finalcut::FTermcap::init();
+}
+
+//----------------------------------------------------------------------
+const char* getTerminfoDir (const char termtype[])
+{
+  // Returns the terminfo directory with the terminal type or nullptr
+
+  static const char* const dirs[] =
+  {
+    "/etc/terminfo",
+    "/lib/terminfo",
+    "/usr/share/terminfo",
+    "/usr/lib/terminfo",
+    nullptr
+  };
+
+  for (std::size_t i{0}; dirs[i]; i++)
+  {
+    const std::string file = std::string(dirs[i]) + "/"
+                           + termtype[0] + "/" + termtype;
+
+    if ( access(file.c_str(), R_OK) == 0 )
+      return dirs[i];
+  }
+
+  return nullptr;
+}
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FTermcapTest
+//----------------------------------------------------------------------
+
+class FTermcapTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermcapTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void flagTest();
+    void numberTest();
+    void stringTest();
+    void baseEntryTest();
+    void terminfoTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermcapTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (flagTest);
+    CPPUNIT_TEST (numberTest);
+    CPPUNIT_TEST (stringTest);
+    CPPUNIT_TEST (baseEntryTest);
+    CPPUNIT_TEST (terminfoTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTermcapTest::setUp()
+{
+  // The built-in entries are not used with an explicit database
+  unsetenv("TERMINFO");
+  unsetenv("TERMCAP");
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::tearDown()
+{
+  unsetenv("TERMINFO");
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::classNameTest()
+{
+  const finalcut::FTermcap tcap;
+  const finalcut::FString& classname = tcap.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermcap" );
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::flagTest()
+{
+  test::initTermcap ("xterm");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::background_color_erase );
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::can_change_color_palette );
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::automatic_left_margin );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::automatic_right_margin );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::eat_nl_glitch );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::ansi_default_color );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::osc_support );
+
+  test::initTermcap ("ansi");
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::background_color_erase );
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::can_change_color_palette );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::automatic_right_margin );
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::eat_nl_glitch );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::ansi_default_color );
+  CPPUNIT_ASSERT ( ! finalcut::FTermcap::osc_support );
+
+  test::initTermcap ("putty");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::can_change_color_palette );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::automatic_left_margin );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::no_utf8_acs_chars );
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::numberTest()
+{
+  test::initTermcap ("xterm");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 8 );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::tabstop == 8 );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::attr_without_color == -1 );
+  CPPUNIT_ASSERT ( ! finalcut::FTerm::getFTermData()->isMonochron() );
+
+  test::initTermcap ("xterm-16color");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 16 );
+
+  test::initTermcap ("xterm-88color");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 88 );
+
+  test::initTermcap ("xterm-256color");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 256 );
+
+  test::initTermcap ("ansi");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 8 );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::attr_without_color == 3 );
+
+  test::initTermcap ("gnome");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::attr_without_color == 16 );
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::stringTest()
+{
+  const finalcut::FTermcap::tcap_map* caps = finalcut::FTermcap::strings;
+
+  test::initTermcap ("xterm");
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_clear_screen].string
+                         , C_STR(CSI "H" CSI "2J") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_erase_chars].string
+                         , C_STR(CSI "%p1%dX") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_cursor_address].string
+                         , C_STR(CSI "%i%p1%d;%p2%dH") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_change_scroll_region].string
+                         , C_STR(CSI "%i%p1%d;%p2%dr") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_set_a_foreground].string
+                         , C_STR(CSI "3%p1%dm") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_enter_alt_charset_mode].string
+                         , C_STR(ESC "(0") );
+  CPPUNIT_ASSERT ( caps[finalcut::fc::t_set_foreground].string );
+
+  test::initTermcap ("ansi");
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_clear_screen].string
+                         , C_STR(CSI "H" CSI "J") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_enter_alt_charset_mode].string
+                         , C_STR(CSI "11m") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_change_scroll_region].string
+                         , 0 );
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::baseEntryTest()
+{
+  const finalcut::FTermcap::tcap_map* caps = finalcut::FTermcap::strings;
+
+  // xterm-256color -> xterm-88color -> xterm-16color -> xterm
+  test::initTermcap ("xterm-256color");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::can_change_color_palette );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::eat_nl_glitch );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::tabstop == 8 );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_clear_screen].string
+                         , C_STR(CSI "H" CSI "2J") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_set_a_foreground].string
+                         , C_STR(CSI "%?%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9"
+                                     "%p1%{8}%-%d%e38;5;%p1%d%;m") );
+  CPPUNIT_ASSERT ( caps[finalcut::fc::t_orig_colors].string );
+
+  // Cancelled in xterm-88color
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_set_foreground].string
+                         , 0 );
+
+  // konsole-256color -> konsole -> gnome -> xterm
+  test::initTermcap ("konsole-256color");
+  CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == 256 );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::ansi_default_color );
+  CPPUNIT_ASSERT ( finalcut::FTermcap::attr_without_color == -1 );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_enter_alt_charset_mode].string
+                         , C_STR("\016") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_enter_ca_mode].string
+                         , C_STR(ESC "7" CSI "?47h") );
+  CPPUNIT_ASSERT_CSTRING ( caps[finalcut::fc::t_cursor_address].string
+                         , C_STR(CSI "%i%p1%d;%p2%dH") );
+}
+
+//----------------------------------------------------------------------
+void FTermcapTest::terminfoTest()
+{
+  // The built-in entries match the system terminfo database
+
+  static const char* const termtypes[] = { "xterm-256color", "ansi" };
+
+  for (auto&& termtype : termtypes)
+  {
+    const char* dir = test::getTerminfoDir(termtype);
+
+    if ( ! dir )
+      continue;  // Not installed on this system
+
+    const finalcut::FTermcap::tcap_map* caps = finalcut::FTermcap::strings;
+    test::initTermcap (termtype);
+    const int builtin_colors = finalcut::FTermcap::max_color;
+    const bool builtin_am = finalcut::FTermcap::automatic_right_margin;
+    std::vector<std::string> builtin_caps{};
+
+    for (auto&& cap : test::compared_caps)
+      builtin_caps.push_back(caps[cap].string ? caps[cap].string : "");
+
+    setenv("TERMINFO", dir, 1);
+    test::initTermcap (termtype);
+    unsetenv("TERMINFO");
+    CPPUNIT_ASSERT ( finalcut::FTermcap::max_color == builtin_colors );
+    CPPUNIT_ASSERT ( finalcut::FTermcap::automatic_right_margin == builtin_am );
+    std::size_t n{0};
+
+    for (auto&& cap : test::compared_caps)
+    {
+      const char* str = caps[cap].string ? caps[cap].string : "";
+      CPPUNIT_ASSERT_CSTRING ( builtin_caps[n].c_str(), str );
+      n++;
+    }
+  }
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermcapTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -105,6 +105,11 @@ static tcap_map tcap[] =
   { 0, "Ss" },  // set cursor style
   { 0, "sf" },  // scroll_forward
   { 0, "sr" },  // scroll_reverse
+  { 0, "cs" },  // change_scroll_region
+  { 0, "SF" },  // parm_index
+  { 0, "SR" },  // parm_rindex
+  { 0, "ML" },  // set_lr_margin
+  { 0, "MC" },  // clear_margins
   { 0, "ti" },  // enter_ca_mode
   { 0, "te" },  // exit_ca_mode
   { 0, "eA" },  // enable_acs
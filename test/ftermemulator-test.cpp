@@ -0,0 +1,361 @@
+/***********************************************************************
+* ftermemulator-test.cpp - FTermEmulator unit tests                    *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermEmulatorTest
+//----------------------------------------------------------------------
+
+class FTermEmulatorTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermEmulatorTest()
+    { }
+
+  protected:
+    void classNameTest();
+    void textTest();
+    void cursorTest();
+    void eraseTest();
+    void attributeTest();
+    void characterTest();
+    void scrollTest();
+    void modeTest();
+    void replyTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermEmulatorTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (textTest);
+    CPPUNIT_TEST (cursorTest);
+    CPPUNIT_TEST (eraseTest);
+    CPPUNIT_TEST (attributeTest);
+    CPPUNIT_TEST (characterTest);
+    CPPUNIT_TEST (scrollTest);
+    CPPUNIT_TEST (modeTest);
+    CPPUNIT_TEST (replyTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::classNameTest()
+{
+  const finalcut::FTermEmulator emulator;
+  const finalcut::FString& classname = emulator.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermEmulator" );
+  CPPUNIT_ASSERT ( emulator.getWidth() == 80 );
+  CPPUNIT_ASSERT ( emulator.getHeight() == 24 );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::textTest()
+{
+  finalcut::FTermEmulator emulator(10, 3);
+  emulator.write ("Hello\r\nWorld");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "Hello" );
+  CPPUNIT_ASSERT ( emulator.getLine(1) == "World" );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(5, 1) );
+  CPPUNIT_ASSERT ( emulator.getText() == "Hello\nWorld\n" );
+  CPPUNIT_ASSERT ( emulator.getByteCount() == 12 );
+
+  // The automatic margin wraps on the next character
+  emulator.write ("\r\n0123456789");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(9, 2) );
+  emulator.write ("A");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "World" );
+  CPPUNIT_ASSERT ( emulator.getLine(1) == "0123456789" );
+  CPPUNIT_ASSERT ( emulator.getLine(2) == "A" );
+
+  // Tabulator and backspace
+  emulator.write ("\r\tB\b\bC");
+  CPPUNIT_ASSERT ( emulator.getLine(2) == "A      CB" );
+
+  // Recording of the output bytes
+  emulator.setRecording (true);
+  emulator.write ("\033[m");
+  CPPUNIT_ASSERT ( emulator.getRecording() == "\033[m" );
+  emulator.clearRecording();
+  CPPUNIT_ASSERT ( emulator.getRecording().empty() );
+  CPPUNIT_ASSERT ( emulator.getSequenceCount() == 1 );
+  emulator.resetCounters();
+  CPPUNIT_ASSERT ( emulator.getByteCount() == 0 );
+  CPPUNIT_ASSERT ( emulator.getSequenceCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::cursorTest()
+{
+  finalcut::FTermEmulator emulator(20, 10);
+  emulator.write ("\033[5;10H");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(9, 4) );
+  emulator.write ("\033[2A");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(9, 2) );
+  emulator.write ("\033[3B\033[4C");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(13, 5) );
+  emulator.write ("\033[20D");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(0, 5) );
+  emulator.write ("\033[7G\033[2d");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(6, 1) );
+
+  // The cursor stays on the screen
+  emulator.write ("\033[99;99H");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(19, 9) );
+  emulator.write ("\033[H");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(0, 0) );
+
+  // Save and restore the cursor
+  emulator.write ("\033[3;4H\0337\033[H\0338");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(3, 2) );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::eraseTest()
+{
+  finalcut::FTermEmulator emulator(10, 3);
+  emulator.write ("abcdefghij\r\nabcdefghij\r\nabcdefghij");
+
+  emulator.write ("\033[1;5H\033[K");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "abcd" );
+  emulator.write ("\033[2;3H\033[1K");
+  CPPUNIT_ASSERT ( emulator.getLine(1) == "   defghij" );
+  emulator.write ("\033[3;2H\033[3X");
+  CPPUNIT_ASSERT ( emulator.getLine(2) == "a   efghij" );
+  emulator.write ("\033[2P");
+  CPPUNIT_ASSERT ( emulator.getLine(2) == "a efghij" );
+  emulator.write ("\033[2@");
+  CPPUNIT_ASSERT ( emulator.getLine(2) == "a   efghij" );
+
+  // Repeat the preceding character
+  emulator.write ("\033[1;1Hx\033[3b");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "xxxx" );
+
+  emulator.write ("\033[2J");
+  CPPUNIT_ASSERT ( emulator.getText() == "\n\n" );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::attributeTest()
+{
+  finalcut::FTermEmulator emulator(10, 2);
+  emulator.write ("\033[1;4;31;42mA\033[22;24;39;49mB");
+  const finalcut::FChar& a = emulator.getChar(0, 0);
+  const finalcut::FChar& b = emulator.getChar(1, 0);
+  CPPUNIT_ASSERT ( a.ch == L'A' );
+  CPPUNIT_ASSERT ( a.attr.bit.bold );
+  CPPUNIT_ASSERT ( a.attr.bit.underline );
+  CPPUNIT_ASSERT ( a.fg_color == 1 );
+  CPPUNIT_ASSERT ( a.bg_color == 2 );
+  CPPUNIT_ASSERT ( ! b.attr.bit.bold );
+  CPPUNIT_ASSERT ( ! b.attr.bit.underline );
+  CPPUNIT_ASSERT ( b.fg_color == finalcut::fc::Default );
+  CPPUNIT_ASSERT ( b.bg_color == finalcut::fc::Default );
+
+  // Bright and 256 colors
+  emulator.write ("\033[97;104mC\033[38;5;208;48;5;17mD\033[0mE");
+  CPPUNIT_ASSERT ( emulator.getChar(2, 0).fg_color == 15 );
+  CPPUNIT_ASSERT ( emulator.getChar(2, 0).bg_color == 12 );
+  CPPUNIT_ASSERT ( emulator.getChar(3, 0).fg_color == 208 );
+  CPPUNIT_ASSERT ( emulator.getChar(3, 0).bg_color == 17 );
+  CPPUNIT_ASSERT ( emulator.getChar(4, 0).fg_color == finalcut::fc::Default );
+
+  // Erased cells get the background color
+  emulator.write ("\033[44m\033[2K");
+  CPPUNIT_ASSERT ( emulator.getChar(0, 0).ch == L' ' );
+  CPPUNIT_ASSERT ( emulator.getChar(0, 0).bg_color == 4 );
+  CPPUNIT_ASSERT ( emulator.getChar(0, 1).bg_color == finalcut::fc::Default );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::characterTest()
+{
+  finalcut::FTermEmulator emulator(6, 2);
+
+  // UTF-8
+  emulator.write ("\303\244\342\224\200");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == L"ä─" );
+
+  // Full-width character
+  emulator.write ("\r\n\344\270\255x");
+  CPPUNIT_ASSERT ( emulator.getChar(0, 1).ch == L'中' );
+  CPPUNIT_ASSERT ( emulator.getChar(0, 1).attr.bit.char_width == 2 );
+  CPPUNIT_ASSERT ( emulator.getChar(1, 1).attr.bit.fullwidth_padding );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(3, 1) );
+  CPPUNIT_ASSERT ( emulator.getLine(1) == L"中x" );
+
+  // Overwriting one half removes the full-width character
+  emulator.write ("\033[2;2Hy");
+  CPPUNIT_ASSERT ( emulator.getLine(1) == L" yx" );
+
+  // Combining character
+  emulator.write ("\033[Hn\314\203");
+  CPPUNIT_ASSERT ( emulator.getCharString(0, 0) == L"n\x0303" );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(1, 0) );
+
+  // A zero width space does not combine and takes no cell
+  emulator.write ("\033[Ha\342\200\213b");
+  CPPUNIT_ASSERT ( emulator.getCharString(0, 0) == L"a" );
+  CPPUNIT_ASSERT ( emulator.getChar(1, 0).ch == L'b' );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(2, 0) );
+
+  // vt100 line drawing characters
+  emulator.write ("\033[H\033(0lqk\033(Bq");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == L"┌─┐q" );
+  emulator.write ("\033[H\033)0\016x\017x");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == L"│x┐q" );
+
+  // Invalid UTF-8
+  emulator.write ("\033[H\303A");
+  CPPUNIT_ASSERT ( emulator.getLine(0) == L"\xfffd" L"A┐q" );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::scrollTest()
+{
+  finalcut::FTermEmulator emulator(5, 4);
+  emulator.write ("1\r\n2\r\n3\r\n4\n");
+  CPPUNIT_ASSERT ( emulator.getText() == "2\n3\n4\n" );
+
+  // Scrolling region
+  emulator.write ("\033[2J\033[HA\r\nB\r\nC\r\nD");
+  emulator.write ("\033[2;3r\033[3;1H\n");
+  CPPUNIT_ASSERT ( emulator.getText() == "A\nC\n\nD" );
+  emulator.write ("\033[2;1H\033M");
+  CPPUNIT_ASSERT ( emulator.getText() == "A\n\nC\nD" );
+
+  // Insert and delete lines
+  emulator.write ("\033[r\033[1;1H\033[L");
+  CPPUNIT_ASSERT ( emulator.getText() == "\nA\n\nC" );
+  emulator.write ("\033[2M");
+  CPPUNIT_ASSERT ( emulator.getText() == "\nC\n\n" );
+
+  // Left and right margins (DECLRMM and DECSLRM)
+  emulator.write ("\033[2J\033[Habcde\r\nfghij\r\nklmno\r\npqrst");
+  emulator.write ("\033[?69h\033[2;4s");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(0, 0) );
+  emulator.write ("\033[1;3r\033[3;2H\033D");
+  CPPUNIT_ASSERT ( emulator.getText() == "aghie\nflmnj\nk   o\npqrst" );
+  emulator.write ("\033[1;2H\033[T");
+  CPPUNIT_ASSERT ( emulator.getText() == "a   e\nfghij\nklmno\npqrst" );
+
+  // Outside of the margins nothing is scrolled
+  emulator.write ("\033[3;1H\n");
+  CPPUNIT_ASSERT ( emulator.getText() == "a   e\nfghij\nklmno\npqrst" );
+
+  // Without the margin mode, CSI s saves the cursor
+  emulator.write ("\033[?69l\033[r\033[3;4H\033[s\033[H\033[u");
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(3, 2) );
+  emulator.write ("\033[4;1H\n");
+  CPPUNIT_ASSERT ( emulator.getText() == "fghij\nklmno\npqrst\n" );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::modeTest()
+{
+  finalcut::FTermEmulator emulator(10, 3);
+  emulator.write ("normal");
+
+  // Alternate screen
+  CPPUNIT_ASSERT ( ! emulator.isAlternateScreen() );
+  emulator.write ("\033[?1049h");
+  CPPUNIT_ASSERT ( emulator.isAlternateScreen() );
+  CPPUNIT_ASSERT ( emulator.getLine(0).isEmpty() );
+  emulator.write ("\033[Halternate");
+  emulator.write ("\033[?1049l");
+  CPPUNIT_ASSERT ( ! emulator.isAlternateScreen() );
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "normal" );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(6, 0) );
+
+  // Cursor visibility and mouse tracking
+  CPPUNIT_ASSERT ( emulator.isCursorVisible() );
+  emulator.write ("\033[?25l");
+  CPPUNIT_ASSERT ( ! emulator.isCursorVisible() );
+  CPPUNIT_ASSERT ( ! emulator.isMouseTracking() );
+  emulator.write ("\033[?1000h\033[?1006h");
+  CPPUNIT_ASSERT ( emulator.isMouseTracking() );
+  emulator.write ("\033[?1000l");
+  CPPUNIT_ASSERT ( ! emulator.isMouseTracking() );
+
+  // Window title
+  emulator.write ("\033]2;Title\007");
+  CPPUNIT_ASSERT ( emulator.getTitle() == "Title" );
+  emulator.write ("\033]0;Another title\033\\");
+  CPPUNIT_ASSERT ( emulator.getTitle() == "Another title" );
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "normal" );
+
+  // Resize keeps the upper left content
+  emulator.setSize (4, 2);
+  CPPUNIT_ASSERT ( emulator.getWidth() == 4 );
+  CPPUNIT_ASSERT ( emulator.getHeight() == 2 );
+  CPPUNIT_ASSERT ( emulator.getLine(0) == "norm" );
+  CPPUNIT_ASSERT ( emulator.getCursorPos() == finalcut::FPoint(3, 0) );
+
+  // Full reset
+  emulator.write ("\033c");
+  CPPUNIT_ASSERT ( emulator.getLine(0).isEmpty() );
+  CPPUNIT_ASSERT ( emulator.isCursorVisible() );
+}
+
+//----------------------------------------------------------------------
+void FTermEmulatorTest::replyTest()
+{
+  finalcut::FTermEmulator emulator(80, 25);
+  CPPUNIT_ASSERT ( ! emulator.hasReply() );
+
+  // Cursor position report
+  emulator.write ("\033[12;34H\033[6n");
+  CPPUNIT_ASSERT ( emulator.hasReply() );
+  CPPUNIT_ASSERT ( emulator.takeReply() == "\033[12;34R" );
+  CPPUNIT_ASSERT ( ! emulator.hasReply() );
+
+  // Device attributes and the text area size
+  emulator.write ("\033[c\033[>c\033[18t");
+  CPPUNIT_ASSERT ( emulator.takeReply()
+                   == "\033[?1;2c\033[>0;0;0c\033[8;25;80t" );
+
+  // Device control strings are ignored
+  emulator.write ("\033P+q436f\033\\x");
+  CPPUNIT_ASSERT ( emulator.getLine(11) == std::string(33, ' ') + "x" );
+  CPPUNIT_ASSERT ( ! emulator.hasReply() );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermEmulatorTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -2206,6 +2206,12 @@ void FTermLinuxTest::linuxFontTest()
     CPPUNIT_ASSERT ( font.data[249 * 32 + 14] == 0x00 );
     CPPUNIT_ASSERT ( font.data[249 * 32 + 15] == 0x00 );
 
+    // Loading the same font again is skipped
+    font.op = KD_FONT_OP_GET;
+    linux.loadNewFont();
+    CPPUNIT_ASSERT ( font.op == KD_FONT_OP_GET );
+    CPPUNIT_ASSERT ( linux.isNewFontUsed() );
+
     linux.loadOldFont();
     CPPUNIT_ASSERT ( ! linux.isVGAFontUsed() );
     CPPUNIT_ASSERT ( ! linux.isNewFontUsed() );
@@ -2228,6 +2234,15 @@ void FTermLinuxTest::linuxFontTest()
     CPPUNIT_ASSERT ( font.data[249 * 32 + 14] == 0x00 );
     CPPUNIT_ASSERT ( font.data[249 * 32 + 15] == 0x00 );
 
+    // The saved font remains available for further font changes
+    linux.loadNewFont();
+    CPPUNIT_ASSERT ( linux.isNewFontUsed() );
+    CPPUNIT_ASSERT ( font.data[249 * 32 + 4] == 0x38 );
+    linux.loadOldFont();
+    CPPUNIT_ASSERT ( ! linux.isNewFontUsed() );
+    CPPUNIT_ASSERT ( font.data[249 * 32 + 4] == 0x00 );
+    CPPUNIT_ASSERT ( font.data[249 * 32 + 7] == 0x18 );
+
     linux.finish();
 
     closeConEmuStdStreams();
@@ -0,0 +1,272 @@
+/***********************************************************************
+* ftermoutput-test.cpp - FTermOutput unit tests                        *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermOutputTest
+//----------------------------------------------------------------------
+
+class FTermOutputTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermOutputTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void openTest();
+    void writeTest();
+    void backPressureTest();
+    void discardTest();
+
+  private:
+    // Methods
+    void put (const std::string&);
+    void putFrame (const std::string&);
+    std::string readPipe();
+
+    // Data members
+    int pipe_fd[2]{-1, -1};
+    finalcut::FString device{};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermOutputTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (openTest);
+    CPPUNIT_TEST (writeTest);
+    CPPUNIT_TEST (backPressureTest);
+    CPPUNIT_TEST (discardTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTermOutputTest::setUp()
+{
+  // A pipe has a limited capacity like a stalled terminal
+  CPPUNIT_ASSERT ( pipe(pipe_fd) == 0 );
+  fcntl (pipe_fd[0], F_SETFL, O_NONBLOCK);
+  device.sprintf("/proc/self/fd/%d", pipe_fd[1]);
+  finalcut::FTermOutput::setThreshold(65536);
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::tearDown()
+{
+  // Empties the pipe, so that close() does not wait
+
+  while ( ! finalcut::FTermOutput::write() )
+    readPipe();
+
+  finalcut::FTermOutput::close();
+  close (pipe_fd[0]);
+  close (pipe_fd[1]);
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::classNameTest()
+{
+  const finalcut::FTermOutput output;
+  const finalcut::FString& classname = output.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermOutput" );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::openTest()
+{
+  using finalcut::FTermOutput;
+
+  CPPUNIT_ASSERT ( ! FTermOutput::isActive() );
+
+  // Without a file descriptor, there are no frames
+  FTermOutput::beginFrame();
+  CPPUNIT_ASSERT ( ! FTermOutput::isFrameActive() );
+  FTermOutput::endFrame();
+
+  CPPUNIT_ASSERT ( ! FTermOutput::open("") );
+  CPPUNIT_ASSERT ( ! FTermOutput::open("/nonexistent/tty") );
+  CPPUNIT_ASSERT ( ! FTermOutput::isActive() );
+
+  CPPUNIT_ASSERT ( FTermOutput::open(device) );
+  CPPUNIT_ASSERT ( FTermOutput::isActive() );
+
+  // The non-blocking mode does not affect the original descriptor
+  const int flags = fcntl (pipe_fd[1], F_GETFL);
+  CPPUNIT_ASSERT ( (flags & O_NONBLOCK) == 0 );
+
+  FTermOutput::close();
+  CPPUNIT_ASSERT ( ! FTermOutput::isActive() );
+  CPPUNIT_ASSERT ( ! FTermOutput::hasPendingData() );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::writeTest()
+{
+  using finalcut::FTermOutput;
+
+  CPPUNIT_ASSERT ( FTermOutput::open(device) );
+  CPPUNIT_ASSERT ( FTermOutput::putchar('H') == 'H' );
+  CPPUNIT_ASSERT ( FTermOutput::putchar(0xe2) == 0xe2 );
+  put ("ello");
+  CPPUNIT_ASSERT ( FTermOutput::getPendingSize() == 6 );
+  CPPUNIT_ASSERT ( FTermOutput::hasPendingData() );
+
+  // Nothing is written before write() is called
+  CPPUNIT_ASSERT ( readPipe().empty() );
+
+  CPPUNIT_ASSERT ( FTermOutput::write() );
+  CPPUNIT_ASSERT ( ! FTermOutput::hasPendingData() );
+  CPPUNIT_ASSERT ( readPipe() == "H\xe2" "ello" );
+
+  // Without pending data, write() has nothing to do
+  CPPUNIT_ASSERT ( FTermOutput::write() );
+  CPPUNIT_ASSERT ( FTermOutput::drain() );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::backPressureTest()
+{
+  using finalcut::FTermOutput;
+
+  CPPUNIT_ASSERT ( FTermOutput::open(device) );
+  CPPUNIT_ASSERT ( FTermOutput::getThreshold() == 65536 );
+  FTermOutput::setThreshold(1000);
+  CPPUNIT_ASSERT ( FTermOutput::getThreshold() == 1000 );
+
+  // The pipe takes less than 1 MiB without blocking
+  const std::size_t size = 1024 * 1024;
+  put (std::string(size, 'x'));
+  CPPUNIT_ASSERT ( ! FTermOutput::write() );
+  CPPUNIT_ASSERT ( FTermOutput::hasPendingData() );
+  CPPUNIT_ASSERT ( FTermOutput::getPendingSize() < size );
+  CPPUNIT_ASSERT ( FTermOutput::isOverloaded() );
+
+  // The rest follows as soon as the reader has emptied the pipe
+  std::size_t received{0};
+
+  while ( ! FTermOutput::write() )
+    received += readPipe().size();
+
+  received += readPipe().size();
+  CPPUNIT_ASSERT ( received == size );
+  CPPUNIT_ASSERT ( ! FTermOutput::isOverloaded() );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::discardTest()
+{
+  using finalcut::FTermOutput;
+
+  CPPUNIT_ASSERT ( FTermOutput::open(device) );
+
+  // The first frame does not fit into the pipe
+  const std::size_t size = 1024 * 1024;
+  putFrame (std::string(size, 'a'));
+  putFrame ("bbb");
+  putFrame ("ccc");
+  CPPUNIT_ASSERT ( ! FTermOutput::isFrameActive() );
+  CPPUNIT_ASSERT ( ! FTermOutput::write() );
+  const std::size_t pending = FTermOutput::getPendingSize();
+
+  // The started frame is kept, the waiting frames are dropped
+  CPPUNIT_ASSERT ( FTermOutput::discardFrames() );
+  CPPUNIT_ASSERT ( FTermOutput::getPendingSize() == pending - 6 );
+  CPPUNIT_ASSERT ( ! FTermOutput::discardFrames() );
+
+  // Frames followed by other output are not discarded
+  putFrame ("ddd");
+  put ("e");
+  CPPUNIT_ASSERT ( ! FTermOutput::discardFrames() );
+
+  // A frame is only discarded after its end
+  FTermOutput::beginFrame();
+  put ("fff");
+  CPPUNIT_ASSERT ( FTermOutput::isFrameActive() );
+  CPPUNIT_ASSERT ( ! FTermOutput::discardFrames() );
+  FTermOutput::endFrame();
+  CPPUNIT_ASSERT ( FTermOutput::discardFrames() );
+  putFrame ("ggg");
+
+  std::string received{};
+
+  while ( ! FTermOutput::write() )
+    received += readPipe();
+
+  received += readPipe();
+  CPPUNIT_ASSERT ( received.size() == size + 7 );
+  CPPUNIT_ASSERT ( received.substr(size) == "dddeggg" );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::put (const std::string& str)
+{
+  for (auto&& ch : str)
+    finalcut::FTermOutput::putchar(ch);
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::putFrame (const std::string& str)
+{
+  finalcut::FTermOutput::beginFrame();
+  put (str);
+  finalcut::FTermOutput::endFrame();
+}
+
+//----------------------------------------------------------------------
+std::string FTermOutputTest::readPipe()
+{
+  std::string data{};
+  char buffer[4096];
+  ssize_t bytes;
+
+  while ( (bytes = read(pipe_fd[0], buffer, sizeof(buffer))) > 0 )
+    data.append (buffer, std::size_t(bytes));
+
+  return data;
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermOutputTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,180 @@
+/***********************************************************************
+* ftermquery-test.cpp - FTermQuery unit tests                          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <unistd.h>
+
+#include <cstring>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermQueryTest
+//----------------------------------------------------------------------
+
+class FTermQueryTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermQueryTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void replyTest();
+    void timeoutTest();
+    void unterminatedTest();
+    void clearTest();
+
+  private:
+    // Simulates the terminal answer on stdin
+    void terminalAnswer (const char[]);
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermQueryTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (replyTest);
+    CPPUNIT_TEST (timeoutTest);
+    CPPUNIT_TEST (unterminatedTest);
+    CPPUNIT_TEST (clearTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data members
+    int stdin_copy{-1};
+    int fd[2]{-1, -1};
+};
+
+
+//----------------------------------------------------------------------
+void FTermQueryTest::setUp()
+{
+  stdin_copy = dup(STDIN_FILENO);
+
+  if ( pipe(fd) == 0 )
+    dup2 (fd[0], STDIN_FILENO);
+
+  finalcut::FTermios::init();
+  finalcut::FTermQuery::clear();
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::tearDown()
+{
+  dup2 (stdin_copy, STDIN_FILENO);
+  close (stdin_copy);
+  close (fd[0]);
+  close (fd[1]);
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::terminalAnswer (const char answer[])
+{
+  CPPUNIT_ASSERT ( write (fd[1], answer, std::strlen(answer))
+                   == ssize_t(std::strlen(answer)) );
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::classNameTest()
+{
+  const finalcut::FTermQuery query;
+  const finalcut::FString& classname = query.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermQuery" );
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::replyTest()
+{
+  // Answerback, SEC_DA, color, title and the DA1 sentinel
+  terminalAnswer ( "PuTTY"
+                   "\033[>0;136;0c"
+                   "\033]4;0;rgb:0000/0000/0000\a"
+                   "\033]lTITLE\033\\"
+                   "\033[?6c" );
+
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::readReplies(500000) );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::hasSentinelReply() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getAnswerback() == "PuTTY" );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getSecondaryDA()
+                   == "\033[>0;136;0c" );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getPrimaryDA() == "\033[?6c" );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getOSCString("4;0;")
+                   == "rgb:0000/0000/0000" );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getOSCString("4;255;").isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getOSCString("l") == "TITLE" );
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::timeoutTest()
+{
+  // Without a sentinel reply, the waiting ends with the timeout
+  terminalAnswer ("\033[>19;312;0c");
+
+  CPPUNIT_ASSERT ( ! finalcut::FTermQuery::readReplies(50000) );
+  CPPUNIT_ASSERT ( ! finalcut::FTermQuery::hasSentinelReply() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getAnswerback().isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getSecondaryDA()
+                   == "\033[>19;312;0c" );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getPrimaryDA().isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::unterminatedTest()
+{
+  // An unterminated title (urxvt) must not hide the sentinel reply
+  terminalAnswer ("\033]l\033[?1;2c");
+
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::readReplies(500000) );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getOSCString("l").isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getPrimaryDA() == "\033[?1;2c" );
+}
+
+//----------------------------------------------------------------------
+void FTermQueryTest::clearTest()
+{
+  terminalAnswer ("xterm\033[?1;2c");
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::readReplies(500000) );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getAnswerback() == "xterm" );
+
+  finalcut::FTermQuery::clear();
+  CPPUNIT_ASSERT ( ! finalcut::FTermQuery::hasSentinelReply() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getAnswerback().isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FTermQuery::getPrimaryDA().isEmpty() );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermQueryTest);
+
+// The general unit test main part
+#include <main-test.inc>
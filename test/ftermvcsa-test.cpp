@@ -0,0 +1,329 @@
+/***********************************************************************
+* ftermvcsa-test.cpp - FTermVcsa unit tests                            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTermVcsaTest
+//----------------------------------------------------------------------
+
+class FTermVcsaTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermVcsaTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void devicePathTest();
+    void openTest();
+    void writeTest();
+    void attributeTest();
+    void fontPositionTest();
+
+  private:
+    // Methods
+    void createFakeVcsa (uInt8, uInt8);
+    std::vector<uInt8> readFakeVcsa();
+    finalcut::FChar getChar (wchar_t, FColor, FColor);
+
+    // Data members
+    std::string filename{};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermVcsaTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (devicePathTest);
+    CPPUNIT_TEST (openTest);
+    CPPUNIT_TEST (writeTest);
+    CPPUNIT_TEST (attributeTest);
+    CPPUNIT_TEST (fontPositionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::setUp()
+{
+  char name[] = "/tmp/fvcsa-XXXXXX";
+  const int fd = mkstemp(name);
+
+  if ( fd >= 0 )
+    close(fd);
+
+  filename = name;
+  finalcut::FTermVcsa::clearFontPositions();
+  finalcut::FTermVcsa::setGlyphCount(256);
+  finalcut::FTermVcsa::setMaxColor(16);
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::tearDown()
+{
+  finalcut::FTermVcsa::close();
+  unlink (filename.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::classNameTest()
+{
+  const finalcut::FTermVcsa vcsa;
+  const finalcut::FString& classname = vcsa.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermVcsa" );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::devicePathTest()
+{
+  using finalcut::FTermVcsa;
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath("/dev/tty1") == "/dev/vcsa1" );
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath("/dev/tty12") == "/dev/vcsa12" );
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath("/dev/tty").isEmpty() );
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath("/dev/ttyS0").isEmpty() );
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath("/dev/pts/3").isEmpty() );
+  CPPUNIT_ASSERT ( FTermVcsa::getDevicePath(nullptr).isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::openTest()
+{
+  using finalcut::FTermVcsa;
+
+  // An empty file has no header
+  CPPUNIT_ASSERT ( ! FTermVcsa::open(filename.c_str()) );
+  CPPUNIT_ASSERT ( ! FTermVcsa::isActive() );
+  CPPUNIT_ASSERT ( ! FTermVcsa::open("/nonexistent/vcsa1") );
+  CPPUNIT_ASSERT ( ! FTermVcsa::open("") );
+
+  createFakeVcsa (3, 10);
+  CPPUNIT_ASSERT ( FTermVcsa::open(filename.c_str()) );
+  CPPUNIT_ASSERT ( FTermVcsa::isActive() );
+  CPPUNIT_ASSERT ( FTermVcsa::getLines() == 3 );
+  CPPUNIT_ASSERT ( FTermVcsa::getColumns() == 10 );
+
+  // The console size is read again from the header
+  createFakeVcsa (4, 20);
+  CPPUNIT_ASSERT ( FTermVcsa::readHeader() );
+  CPPUNIT_ASSERT ( FTermVcsa::getLines() == 4 );
+  CPPUNIT_ASSERT ( FTermVcsa::getColumns() == 20 );
+
+  FTermVcsa::close();
+  CPPUNIT_ASSERT ( ! FTermVcsa::isActive() );
+  CPPUNIT_ASSERT ( FTermVcsa::getColumns() == 0 );
+  CPPUNIT_ASSERT ( ! FTermVcsa::readHeader() );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::writeTest()
+{
+  using finalcut::FTermVcsa;
+  namespace fc = finalcut::fc;
+
+  createFakeVcsa (3, 10);
+  CPPUNIT_ASSERT ( FTermVcsa::open(filename.c_str()) );
+
+  const finalcut::FChar cells[3] =
+  {
+    getChar(L'A', fc::White, fc::Blue),
+    getChar(L'b', fc::Default, fc::Default),
+    getChar(L'C', fc::Red, fc::LightGray)
+  };
+
+  CPPUNIT_ASSERT ( FTermVcsa::write(2, 1, cells, 3) );
+  auto data = readFakeVcsa();
+  CPPUNIT_ASSERT ( data.size() == 4 + 2 * 3 * 10 );
+
+  // Header and untouched cells remain unchanged
+  CPPUNIT_ASSERT ( data[0] == 3 && data[1] == 10 );
+  CPPUNIT_ASSERT ( data[4 + 2 * 11] == 0 && data[4 + 2 * 11 + 1] == 0 );
+  CPPUNIT_ASSERT ( data[4 + 2 * 15] == 0 && data[4 + 2 * 15 + 1] == 0 );
+
+  const std::size_t offset = 4 + 2 * (1 * 10 + 2);
+  CPPUNIT_ASSERT ( data[offset] == 'A' );
+  CPPUNIT_ASSERT ( data[offset + 1] == 0x1f );
+  CPPUNIT_ASSERT ( data[offset + 2] == 'b' );
+  CPPUNIT_ASSERT ( data[offset + 3] == 0x07 );
+  CPPUNIT_ASSERT ( data[offset + 4] == 'C' );
+  CPPUNIT_ASSERT ( data[offset + 5] == 0x74 );
+
+  // Cells behind the end of the line are cut off
+  CPPUNIT_ASSERT ( FTermVcsa::write(8, 2, cells, 3) );
+  data = readFakeVcsa();
+  CPPUNIT_ASSERT ( data.size() == 4 + 2 * 3 * 10 );
+  CPPUNIT_ASSERT ( data[4 + 2 * 28] == 'A' );
+  CPPUNIT_ASSERT ( data[4 + 2 * 29] == 'b' );
+
+  // Positions outside the screen
+  CPPUNIT_ASSERT ( ! FTermVcsa::write(10, 0, cells, 1) );
+  CPPUNIT_ASSERT ( ! FTermVcsa::write(0, 3, cells, 1) );
+
+  FTermVcsa::close();
+  CPPUNIT_ASSERT ( ! FTermVcsa::write(0, 0, cells, 1) );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::attributeTest()
+{
+  using finalcut::FTermVcsa;
+  namespace fc = finalcut::fc;
+
+  auto ch = getChar(L'x', fc::Yellow, fc::Red);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x4e78 );
+
+  ch.attr.bit.reverse = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0xe478 );
+
+  ch = getChar(L'x', fc::Green, fc::Black);
+  ch.attr.bit.bold = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x0a78 );
+
+  ch = getChar(L'x', fc::LightGray, fc::Blue);
+  ch.attr.bit.dim = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x1878 );
+
+  ch = getChar(L'x', fc::White, fc::Cyan);
+  ch.attr.bit.invisible = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x3378 );
+
+  // 256 colors and direct colors get the nearest VGA color
+  ch = getChar(L'x', fc::Red1, fc::Grey0);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x0478 );
+  ch = getChar(L'x', finalcut::FTrueColor::rgb(0x00, 0x00, 0xb0), fc::Black);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x0178 );
+  finalcut::FTrueColor::clear();
+
+  // With 8 colors, bit 7 of the attribute byte means blink
+  FTermVcsa::setMaxColor(8);
+  ch = getChar(L'x', fc::White, fc::LightBlue);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x1f78 );
+  ch.attr.bit.blink = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(ch) == 0x9f78 );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::fontPositionTest()
+{
+  using finalcut::FTermVcsa;
+  namespace fc = finalcut::fc;
+
+  // Without a unicode map, the cp437 font positions are used
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'│', 0, 0)) == 0xb3 );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'█', 0, 0)) == 0xdb );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'€', 0, 0)) == '?' );
+
+  // Padding characters are written as space
+  auto padding = getChar(L'\0', 0, 0);
+  padding.attr.bit.fullwidth_padding = true;
+  CPPUNIT_ASSERT ( FTermVcsa::encode(padding) == ' ' );
+
+  // Font positions from the unicode map of the console
+  FTermVcsa::setFontPosition (L'A', 0x41);
+  FTermVcsa::setFontPosition (L'│', 0x10);
+  FTermVcsa::setFontPosition (L'│', 0x20);  // Ignored duplicate
+  FTermVcsa::setFontPosition (L'?', 0x3f);
+  FTermVcsa::setFontPosition (L'▶', 0x90);
+  FTermVcsa::setFontPosition (L'€', 0x1a0);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'A', 0, 0)) == 0x41 );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'│', 0, 0)) == 0x10 );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'█', 0, 0)) == 0x3f );
+
+  // Missing characters can use the glyph of a substitute
+  FTermVcsa::setCharSubstitution (L'►', L'▶');
+  FTermVcsa::setCharSubstitution (L'A', L'▶');  // Has its own glyph
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'►', 0, 0)) == 0x90 );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'A', 0, 0)) == 0x41 );
+
+  // A font with 512 glyphs uses the intensity bit as 9th glyph bit
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'€', fc::Blue, 0)) == 0x01a0 );
+  FTermVcsa::setGlyphCount(512);
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'€', fc::Blue, 0)) == 0x09a0 );
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'A', fc::White, 0)) == 0x0741 );
+
+  FTermVcsa::clearFontPositions();
+  CPPUNIT_ASSERT ( FTermVcsa::encode(getChar(L'│', 0, 0)) == 0xb3 );
+}
+
+//----------------------------------------------------------------------
+void FTermVcsaTest::createFakeVcsa (uInt8 height, uInt8 width)
+{
+  // Writes a header and an empty screen
+  std::vector<uInt8> data(4 + 2 * std::size_t(height) * width, 0);
+  data[0] = height;
+  data[1] = width;
+  FILE* file = std::fopen(filename.c_str(), "wb");
+  CPPUNIT_ASSERT ( file != nullptr );
+  std::fwrite (data.data(), 1, data.size(), file);
+  std::fclose (file);
+}
+
+//----------------------------------------------------------------------
+std::vector<uInt8> FTermVcsaTest::readFakeVcsa()
+{
+  std::vector<uInt8> data{};
+  FILE* file = std::fopen(filename.c_str(), "rb");
+  CPPUNIT_ASSERT ( file != nullptr );
+  int c;
+
+  while ( (c = std::fgetc(file)) != EOF )
+    data.push_back(uInt8(c));
+
+  std::fclose (file);
+  return data;
+}
+
+//----------------------------------------------------------------------
+finalcut::FChar FTermVcsaTest::getChar (wchar_t ch, FColor fg, FColor bg)
+{
+  finalcut::FChar fchar{};
+  fchar.ch = ch;
+  fchar.fg_color = fg;
+  fchar.bg_color = bg;
+  fchar.attr.bit.char_width = 1;
+  return fchar;
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermVcsaTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,152 @@
+/***********************************************************************
+* ftextview-test.cpp - FTextView unit tests                            *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+#include <keypress.h>
+
+//----------------------------------------------------------------------
+// class FTextViewTest
+//----------------------------------------------------------------------
+
+class FTextViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTextViewTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void scrollTest();
+    void maxLinesTest();
+
+  private:
+    // Data members
+    finalcut::FTextView* textview{nullptr};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTextViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (scrollTest);
+    CPPUNIT_TEST (maxLinesTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTextViewTest::setUp()
+{
+  // Five text lines on terminal lines 3 to 7
+  textview = new finalcut::FTextView(&test::getApplication());
+  textview->setGeometry (finalcut::FPoint(3, 2), finalcut::FSize(30, 7));
+
+  for (int n{0}; n < 50; n++)
+    textview->append (finalcut::FString() << "line " << n);
+
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  textview->show();
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::tearDown()
+{
+  delete textview;
+  textview = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::classNameTest()
+{
+  const finalcut::FString& classname = textview->getClassName();
+  CPPUNIT_ASSERT ( classname == "FTextView" );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::scrollTest()
+{
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("line 0") );
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  test::pressKey (*textview, finalcut::fc::Fkey_down);
+  test::pressKey (*textview, finalcut::fc::Fkey_down);
+  textview->updateTerminal();
+  std::string output = emulator.getRecording();
+
+  // The terminal moves the unchanged lines
+  CPPUNIT_ASSERT ( output.find("\033[3;7r") != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("line 3") == std::string::npos );
+  CPPUNIT_ASSERT ( output.find("line 6") != std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("line 2") );
+  CPPUNIT_ASSERT ( emulator.getLine(4).includes("line 4") );
+  CPPUNIT_ASSERT ( emulator.getLine(6).includes("line 6") );
+
+  // Scrolling back down again
+  emulator.clearRecording();
+  test::pressKey (*textview, finalcut::fc::Fkey_up);
+  textview->updateTerminal();
+  output = emulator.getRecording();
+  emulator.setRecording(false);
+
+  CPPUNIT_ASSERT ( output.find("\033[3;7r") != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("line 3") == std::string::npos );
+  CPPUNIT_ASSERT ( output.find("line 1") != std::string::npos );
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("line 1") );
+  CPPUNIT_ASSERT ( emulator.getLine(6).includes("line 5") );
+  CPPUNIT_ASSERT ( emulator.getLine(7).includes(L"└") );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::maxLinesTest()
+{
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  textview->scrollToY (10);
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("line 10") );
+
+  // The trimmed lines are removed from the screen immediately
+  textview->setMaxLines (20);
+  CPPUNIT_ASSERT ( textview->getRows() == 20 );
+  CPPUNIT_ASSERT ( emulator.getLine(2).includes("line 30") );
+  CPPUNIT_ASSERT ( emulator.getLine(6).includes("line 34") );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTextViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
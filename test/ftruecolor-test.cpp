@@ -0,0 +1,338 @@
+/***********************************************************************
+* ftruecolor-test.cpp - FTrueColor unit tests                          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+
+//----------------------------------------------------------------------
+// class FTrueColorTest
+//----------------------------------------------------------------------
+
+class FTrueColorTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTrueColorTest()
+    { }
+
+    void setUp();
+
+  protected:
+    void classNameTest();
+    void rgbTest();
+    void paletteColorTest();
+    void quantizeTest();
+    void perceptualTest();
+    void fullStoreTest();
+    void sweepTest();
+    void redrawTest();
+    void exhaustionTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTrueColorTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (rgbTest);
+    CPPUNIT_TEST (paletteColorTest);
+    CPPUNIT_TEST (quantizeTest);
+    CPPUNIT_TEST (perceptualTest);
+    CPPUNIT_TEST (fullStoreTest);
+    CPPUNIT_TEST (sweepTest);
+    CPPUNIT_TEST (redrawTest);
+    CPPUNIT_TEST (exhaustionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FTrueColorTest::setUp()
+{
+  finalcut::FTrueColor::clear();
+  finalcut::FTrueColor::setPerceptual(false);
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::classNameTest()
+{
+  const finalcut::FTrueColor truecolor;
+  const finalcut::FString& classname = truecolor.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTrueColor" );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::rgbTest()
+{
+  const FColor c1 = finalcut::FTrueColor::rgb(0x12, 0x34, 0x56);
+  const FColor c2 = finalcut::FTrueColor::rgb(0xff, 0x80, 0x00);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 2 );
+  CPPUNIT_ASSERT ( c1 >= 256 );
+  CPPUNIT_ASSERT ( c1 != c2 );
+  CPPUNIT_ASSERT ( c1 != finalcut::fc::Default );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(c1) );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(c2) );
+
+  // Equal colors get the same color number
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::rgb(0x12, 0x34, 0x56) == c1 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 2 );
+
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c1) == 0x123456 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c2) == 0xff8000 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRed(c2) == 0xff );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getGreen(c2) == 0x80 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getBlue(c2) == 0x00 );
+
+  // Unknown color number
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(c2 + 1)) == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::paletteColorTest()
+{
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isDirectColor(finalcut::fc::Black) );
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isDirectColor(finalcut::fc::White) );
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isDirectColor(finalcut::fc::Grey93) );
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isDirectColor(finalcut::fc::Default) );
+
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(finalcut::fc::Default) == 0 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(finalcut::fc::Blue) == 0x0000aa );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(finalcut::fc::White) == 0xffffff );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(16)) == 0x000000 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(67)) == 0x5f87af );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(231)) == 0xffffff );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(232)) == 0x080808 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(FColor(255)) == 0xeeeeee );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::quantizeTest()
+{
+  // 256 colors
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0, 0, 0, 256) == 16 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 255, 255, 256) == 231 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 0, 0, 256) == 196 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0, 0, 255, 256) == 21 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x5f, 0x87, 0xaf, 256) == 67 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x80, 0x80, 0x80, 256) == 102 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x30, 0x30, 0x30, 256) == 236 );
+
+  // 16 colors
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0, 0, 0, 16)
+                   == finalcut::fc::Black );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 0, 0, 16)
+                   == finalcut::fc::Red );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0xff, 0x55, 0x55, 16)
+                   == finalcut::fc::LightRed );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 255, 255, 16)
+                   == finalcut::fc::White );
+
+  // 8 colors
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0xff, 0x20, 0x20, 8)
+                   == finalcut::fc::Red );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 255, 255, 8)
+                   == finalcut::fc::LightGray );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 255, 255, 2)
+                   == finalcut::fc::LightGray );
+
+  // Direct colors
+  const FColor orange = finalcut::FTrueColor::rgb(0xff, 0x80, 0x00);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(orange, 256) == 208 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(orange, 16)
+                   == finalcut::fc::LightRed );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(finalcut::fc::Blue, 16)
+                   == finalcut::fc::Blue );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(finalcut::fc::Default, 16)
+                   == finalcut::fc::Default );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::perceptualTest()
+{
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isPerceptual() );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x00, 0x20, 0xff, 16)
+                   == finalcut::fc::Blue );
+
+  // The eye is less sensitive to differences in blue
+  finalcut::FTrueColor::setPerceptual();
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isPerceptual() );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x00, 0x20, 0xff, 16)
+                   == finalcut::fc::LightBlue );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(255, 0, 0, 256) == 196 );
+
+  finalcut::FTrueColor::setPerceptual(false);
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isPerceptual() );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::quantize(0x00, 0x20, 0xff, 16)
+                   == finalcut::fc::Blue );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::fullStoreTest()
+{
+  const FColor c1 = finalcut::FTrueColor::rgb(1, 2, 3);
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isFull() );
+  uInt value{0x010204};
+
+  while ( ! finalcut::FTrueColor::isFull() )
+  {
+    finalcut::FTrueColor::rgb (uInt8(value >> 16), uInt8(value >> 8)
+                              , uInt8(value));
+    value++;
+  }
+
+  // Without a sweep, a full store quantizes
+  // new colors to the 256-color palette
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::rgb(0xff, 0xff, 0xfe) == 231 );
+
+  // The color numbers that were handed out remain valid
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::rgb(1, 2, 3) == c1 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c1) == 0x010203 );
+
+  finalcut::FTrueColor::clear();
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::sweepTest()
+{
+  const FColor c1 = finalcut::FTrueColor::rgb(1, 2, 3);
+  const FColor c2 = finalcut::FTrueColor::rgb(4, 5, 6);
+  const FColor c3 = finalcut::FTrueColor::rgb(7, 8, 9);
+  uInt value{0x0a0b0c};
+
+  while ( ! finalcut::FTrueColor::isFull() )
+  {
+    finalcut::FTrueColor::rgb (uInt8(value >> 16), uInt8(value >> 8)
+                              , uInt8(value));
+    value++;
+  }
+
+  const std::size_t count = finalcut::FTrueColor::getCount();
+
+  // Only the marked color numbers remain
+  finalcut::FTrueColor::startSweep();
+  finalcut::FTrueColor::mark (c1);
+  finalcut::FTrueColor::mark (c3);
+  finalcut::FTrueColor::mark (finalcut::fc::Red);
+  finalcut::FTrueColor::mark (finalcut::fc::Default);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::finishSweep() == count - 2 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 2 );
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isFull() );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c1) == 0x010203 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c2) == 0 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c3) == 0x070809 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::rgb(1, 2, 3) == c1 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::rgb(7, 8, 9) == c3 );
+
+  // Released color numbers are handed out again
+  const FColor c4 = finalcut::FTrueColor::rgb(0xff, 0xff, 0xfe);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(c4) );
+  CPPUNIT_ASSERT ( c4 != c1 && c4 != c3 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c4) == 0xfffffe );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 3 );
+
+  // A color that is not marked again is released by the next sweep
+  finalcut::FTrueColor::startSweep();
+  finalcut::FTrueColor::mark (c4);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::finishSweep() == 2 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 1 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c1) == 0 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(c4) == 0xfffffe );
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::redrawTest()
+{
+  auto& app = test::getApplication();
+  finalcut::FTermcap::true_color = true;
+
+  // A color number kept outside of the cells (e.g. a widget color)
+  app.rgb2Color (0x10, 0x20, 0x30);
+  const FColor orange = app.rgb2Color(0xff, 0x80, 0x00);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(orange) );
+
+  // Clearing the desktop does not renumber the colors
+  app.redraw();
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(orange) == 0xff8000 );
+  CPPUNIT_ASSERT ( app.rgb2Color(0xff, 0x80, 0x00) == orange );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() == 2 );
+
+  finalcut::FTermcap::true_color = false;
+}
+
+//----------------------------------------------------------------------
+void FTrueColorTest::exhaustionTest()
+{
+  auto& app = test::getApplication();
+  finalcut::FTermcap::true_color = true;
+
+  // A widget color and a printed color
+  finalcut::FDialog dialog(&app);
+  dialog.setGeometry (finalcut::FPoint(1, 1), finalcut::FSize(20, 5));
+  const FColor widget_color = app.rgb2Color(0x12, 0x34, 0x56);
+  dialog.setForegroundColor (widget_color);
+  const FColor cell_color = app.rgb2Color(0xfe, 0xdc, 0xba);
+  dialog.print() << finalcut::FColorPair(cell_color, finalcut::fc::Black)
+                 << finalcut::FPoint(2, 2) << "RGB";
+
+  // Colors that are only requested fill the store
+  uInt value{0};
+
+  while ( ! finalcut::FTrueColor::isFull() )
+  {
+    app.rgb2Color (uInt8(value >> 16), uInt8(value >> 8), uInt8(value));
+    value++;
+  }
+
+  // The next color releases the unused color numbers
+  // instead of falling back to the 256-color palette
+  const FColor new_color = app.rgb2Color(0xff, 0xff, 0xfe);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(new_color) );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(new_color) == 0xfffffe );
+  CPPUNIT_ASSERT ( ! finalcut::FTrueColor::isFull() );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getCount() < 16 );
+
+  // Colors in use keep their numbers
+  CPPUNIT_ASSERT ( dialog.getForegroundColor() == widget_color );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(widget_color) == 0x123456 );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(cell_color) == 0xfedcba );
+  CPPUNIT_ASSERT ( app.rgb2Color(0x12, 0x34, 0x56) == widget_color );
+  CPPUNIT_ASSERT ( app.rgb2Color(0xfe, 0xdc, 0xba) == cell_color );
+
+  finalcut::FTermcap::true_color = false;
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTrueColorTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,585 @@
+/***********************************************************************
+* fvterm-bench.cpp - Render benchmark for the terminal output          *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Every scenario runs in its own process with a headless terminal
+ *  of a fixed size and a fixed locale, so that the workloads are
+ *  reproducible and do not depend on the terminal of the caller.
+ *  The output of FVTerm, FOptiAttr and FOptiMove is interpreted by
+ *  FTermEmulator, its parsing time is included in the frame time.
+ */
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <final/final.h>
+
+namespace fc = finalcut::fc;
+using finalcut::FPoint;
+using finalcut::FSize;
+using finalcut::FString;
+
+
+// Global variable
+std::size_t allocation_count{0};  // operator new calls
+
+// All replaceable forms of new and delete are defined, so that every
+// allocation is paired with its deallocation. malloc() and free() are
+// not inlined, otherwise -Wmismatched-new-delete pairs them with the
+// calls of the operators.
+//----------------------------------------------------------------------
+#if defined(__clang__) || defined(__GNUC__)
+  __attribute__((noinline))
+#endif
+void* operator new (std::size_t size)
+{
+  // Counts all allocations of the program and the library
+
+  allocation_count++;
+  void* ptr = std::malloc(( size > 0 ) ? size : 1);
+
+  if ( ! ptr )
+    throw std::bad_alloc();
+
+  return ptr;
+}
+
+//----------------------------------------------------------------------
+void* operator new[] (std::size_t size)
+{
+  return operator new (size);
+}
+
+//----------------------------------------------------------------------
+#if defined(__clang__) || defined(__GNUC__)
+  __attribute__((noinline))
+#endif
+void operator delete (void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+//----------------------------------------------------------------------
+void operator delete[] (void* ptr) noexcept
+{
+  operator delete (ptr);
+}
+
+//----------------------------------------------------------------------
+void operator delete (void* ptr, std::size_t) noexcept
+{
+  operator delete (ptr);
+}
+
+//----------------------------------------------------------------------
+void operator delete[] (void* ptr, std::size_t) noexcept
+{
+  operator delete (ptr);
+}
+
+
+namespace
+{
+
+//----------------------------------------------------------------------
+// class Measurement
+//----------------------------------------------------------------------
+
+class Measurement final
+{
+  public:
+    // Constructor
+    Measurement() = default;
+
+    // Accessors
+    uInt64 getFrames() const;
+    double getFrameTime() const;
+    double getBytesPerFrame() const;
+    double getAllocationsPerFrame() const;
+    double getSequencesPerCell() const;
+
+    // Method
+    template <typename Func>
+    void run (int, Func&&);
+
+  private:
+    // Data members
+    uInt64 frames{0};
+    double nanoseconds{0.0};
+    uInt64 bytes{0};
+    uInt64 allocations{0};
+    uInt64 sequences{0};
+    uInt64 cells{0};
+};
+
+//----------------------------------------------------------------------
+inline uInt64 Measurement::getFrames() const
+{ return frames; }
+
+//----------------------------------------------------------------------
+inline double Measurement::getFrameTime() const
+{ return ( frames > 0 ) ? nanoseconds / double(frames) : 0.0; }
+
+//----------------------------------------------------------------------
+inline double Measurement::getBytesPerFrame() const
+{ return ( frames > 0 ) ? double(bytes) / double(frames) : 0.0; }
+
+//----------------------------------------------------------------------
+inline double Measurement::getAllocationsPerFrame() const
+{ return ( frames > 0 ) ? double(allocations) / double(frames) : 0.0; }
+
+//----------------------------------------------------------------------
+inline double Measurement::getSequencesPerCell() const
+{ return ( cells > 0 ) ? double(sequences) / double(cells) : 0.0; }
+
+//----------------------------------------------------------------------
+template <typename Func>
+void Measurement::run (int count, Func&& frame)
+{
+  // Calls frame(n) count times after one frame for warming up
+
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  frame(0);
+  emulator.resetCounters();
+  allocation_count = 0;
+  const auto start = std::chrono::steady_clock::now();
+
+  for (int n{1}; n <= count; n++)
+    frame(n);
+
+  const auto end = std::chrono::steady_clock::now();
+  allocations = allocation_count;
+  const std::chrono::duration<double, std::nano> time = end - start;
+  nanoseconds = time.count();
+  frames = uInt64(count);
+  bytes = emulator.getByteCount();
+  sequences = emulator.getSequenceCount();
+  cells = frames * emulator.getWidth() * emulator.getHeight();
+}
+
+
+//----------------------------------------------------------------------
+// class Canvas
+//----------------------------------------------------------------------
+
+class Canvas final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit Canvas (finalcut::FWidget* = nullptr);
+
+    // Mutators
+    void setFrame (int);
+    void setColorful (bool);
+    void setSymbols (bool);
+
+  private:
+    // Method
+    void draw() override;
+
+    // Data members
+    int  frame{0};
+    bool colorful{false};
+    bool symbols{false};
+};
+
+//----------------------------------------------------------------------
+Canvas::Canvas (finalcut::FWidget* parent)
+  : finalcut::FDialog(parent)
+{ }
+
+//----------------------------------------------------------------------
+inline void Canvas::setFrame (int n)
+{ frame = n; }
+
+//----------------------------------------------------------------------
+inline void Canvas::setColorful (bool enable)
+{ colorful = enable; }
+
+//----------------------------------------------------------------------
+inline void Canvas::setSymbols (bool enable)
+{ symbols = enable; }
+
+//----------------------------------------------------------------------
+void Canvas::draw()
+{
+  // Changes every cell from one frame to the next
+
+  // Symbols that are translated by the character map
+  static const wchar_t symbol_list[] =
+  {
+    fc::BoxDrawingsHorizontal, fc::BoxDrawingsVertical,
+    fc::BoxDrawingsDownAndRight, fc::BoxDrawingsCross,
+    fc::MediumShade, fc::FullBlock, fc::BlackDiamondSuit, fc::Bullet
+  };
+
+  const int width = int(getWidth());
+  const int height = int(getHeight());
+
+  for (int y{1}; y <= height; y++)
+  {
+    print() << FPoint(1, y);
+
+    for (int x{1}; x <= width; x++)
+    {
+      const int n = x + y + frame;
+
+      if ( colorful )
+      {
+        // Same character, different colors and attributes
+        setColor (FColor(n % 16), FColor((n / 3) % 8));
+        setBold (n % 3 == 0);
+        setUnderline (n % 5 == 0);
+        setReverse (n % 7 == 0);
+        print (wchar_t(L'a' + (x + y) % 26));
+      }
+      else if ( symbols )
+      {
+        setColor (fc::White, fc::Blue);
+        print (symbol_list[n % 8]);
+      }
+      else
+      {
+        setColor (fc::White, fc::Blue);
+        print (wchar_t(L'A' + n % 26));
+      }
+    }
+  }
+
+  unsetBold();
+  unsetUnderline();
+  unsetReverse();
+}
+
+
+// Scenarios
+//----------------------------------------------------------------------
+inline FSize getDesktopSize (finalcut::FApplication& app)
+{ return FSize(app.getDesktopWidth(), app.getDesktopHeight()); }
+
+//----------------------------------------------------------------------
+void repaint ( finalcut::FApplication& app, int frames
+             , Measurement& measurement )
+{
+  // Full-screen repaint with new characters in every cell
+
+  Canvas canvas(&app);
+  canvas.setGeometry (FPoint(1, 1), getDesktopSize(app));
+  canvas.show();
+
+  measurement.run ( frames, [&canvas] (int n)
+                    {
+                      canvas.setFrame(n);
+                      canvas.redraw();
+                    } );
+}
+
+//----------------------------------------------------------------------
+void symbolRepaint ( finalcut::FApplication& app, int frames
+                   , Measurement& measurement )
+{
+  // Full-screen repaint with line drawing and block symbols in
+  // every cell, which pass through the character map lookup
+
+  Canvas canvas(&app);
+  canvas.setSymbols (true);
+  canvas.setGeometry (FPoint(1, 1), getDesktopSize(app));
+  canvas.show();
+
+  measurement.run ( frames, [&canvas] (int n)
+                    {
+                      canvas.setFrame(n);
+                      canvas.redraw();
+                    } );
+}
+
+//----------------------------------------------------------------------
+void attributeChurn ( finalcut::FApplication& app, int frames
+                    , Measurement& measurement )
+{
+  // Full-screen repaint with new colors and attributes in every cell
+
+  Canvas canvas(&app);
+  canvas.setColorful (true);
+  canvas.setGeometry (FPoint(1, 1), getDesktopSize(app));
+  canvas.show();
+
+  measurement.run ( frames, [&canvas] (int n)
+                    {
+                      canvas.setFrame(n);
+                      canvas.redraw();
+                    } );
+}
+
+//----------------------------------------------------------------------
+void listScroll ( finalcut::FApplication& app, int frames
+                , Measurement& measurement )
+{
+  // Scrolls through a list with 100000 rows line by line
+
+  finalcut::FDialog dialog(&app);
+  dialog.setText ("List");
+  dialog.setGeometry (FPoint(1, 1), getDesktopSize(app));
+  finalcut::FListView list(&dialog);
+  list.setGeometry ( FPoint(2, 1)
+                   , FSize(dialog.getClientWidth() - 2
+                         , dialog.getClientHeight() - 1) );
+  list.addColumn ("Name", 20);
+  list.addColumn ("Size");
+  list.addColumn ("Type");
+
+  for (int n{0}; n < 100000; n++)
+  {
+    const finalcut::FStringList line{ FString("Entry ") << n
+                                    , FString() << n * 512
+                                    , "File" };
+    list.insert (line);
+  }
+
+  dialog.show();
+  list.setFocus();
+
+  // Moves the cursor to the last visible line
+  for (std::size_t i{0}; i < list.getHeight(); i++)
+  {
+    finalcut::FKeyEvent ev(fc::KeyPress_Event, fc::Fkey_down);
+    list.onKeyPress(&ev);
+  }
+
+  measurement.run ( frames, [&list] (int)
+                    {
+                      finalcut::FKeyEvent ev(fc::KeyPress_Event, fc::Fkey_down);
+                      list.onKeyPress(&ev);
+                    } );
+}
+
+//----------------------------------------------------------------------
+void dialogDrag ( finalcut::FApplication& app, int frames
+                , Measurement& measurement )
+{
+  // Drags a dialog across 10 overlapping windows
+
+  std::vector<finalcut::FDialog*> windows{};
+
+  for (int i{0}; i < 10; i++)
+  {
+    auto win = new finalcut::FDialog(&app);
+    win->setText (FString("Window ") << i);
+    win->setGeometry (FPoint(2 + i * 5, 2 + i), FSize(30, 10));
+    auto label = new finalcut::FLabel(FString("Content of window ") << i, win);
+    label->setGeometry (FPoint(2, 2), FSize(24, 1));
+    win->show();
+    windows.push_back(win);
+  }
+
+  finalcut::FDialog drag(&app);
+  drag.setText ("Drag");
+  drag.setGeometry (FPoint(1, 4), FSize(24, 8));
+  drag.setShadow();
+  drag.show();
+  const int max_x = int(app.getDesktopWidth() - drag.getWidth()) + 1;
+  int dx{1};
+
+  measurement.run ( frames, [&drag, &dx, max_x] (int)
+                    {
+                      if ( drag.getX() + dx < 1 || drag.getX() + dx > max_x )
+                        dx = -dx;
+
+                      drag.move (FPoint(dx, 0));
+                      finalcut::FVTerm::flush();
+                    } );
+
+  for (auto&& win : windows)
+    delete win;
+}
+
+//----------------------------------------------------------------------
+void labelUpdate ( finalcut::FApplication& app, int frames
+                 , Measurement& measurement )
+{
+  // Updates the text of 40 labels with formatted numbers
+
+  finalcut::FDialog dialog(&app);
+  dialog.setText ("Labels");
+  dialog.setGeometry (FPoint(1, 1), getDesktopSize(app));
+  std::vector<finalcut::FLabel*> labels{};
+  const std::size_t column_width = (dialog.getClientWidth() - 4) / 2;
+
+  for (int i{0}; i < 40; i++)
+  {
+    auto label = new finalcut::FLabel(&dialog);
+    label->setGeometry ( FPoint(2 + (i % 2) * int(column_width + 2), 1 + i / 2)
+                       , FSize(column_width, 1) );
+    labels.push_back(label);
+  }
+
+  dialog.show();
+
+  measurement.run ( frames, [&dialog, &labels] (int n)
+                    {
+                      int i{0};
+
+                      for (auto&& label : labels)
+                      {
+                        label->setText ( FString("Value ") << i << ": "
+                                         << (n * 7919 + i * 104729) % 100000
+                                         << " (" << n << ")" );
+                        i++;
+                      }
+
+                      dialog.redraw();
+                    } );
+}
+
+
+//----------------------------------------------------------------------
+// Scenario table
+//----------------------------------------------------------------------
+
+typedef void (*Workload)(finalcut::FApplication&, int, Measurement&);
+
+struct Scenario
+{
+  const char* name;
+  std::size_t width;
+  std::size_t height;
+  int         frames;
+  Workload    workload;
+  const char* encoding;  // nullptr: the encoding of the locale
+};
+
+const Scenario scenarios[] =
+{
+  { "repaint",          80,  24, 300, repaint,        nullptr },
+  { "repaint",         200,  60, 100, repaint,        nullptr },
+  { "repaint",         400, 120,  30, repaint,        nullptr },
+  { "symbol_repaint",   80,  24, 300, symbolRepaint,  nullptr },
+  { "symbol_repaint",   80,  24, 300, symbolRepaint,  "pc" },
+  { "list_scroll",      80,  24, 300, listScroll,     nullptr },
+  { "dialog_drag",      80,  24, 300, dialogDrag,     nullptr },
+  { "attribute_churn",  80,  24, 300, attributeChurn, nullptr },
+  { "label_update",     80,  24, 300, labelUpdate,    nullptr }
+};
+
+//----------------------------------------------------------------------
+void runScenario (const Scenario& scenario)
+{
+  // Runs the workload in a headless terminal and prints the result
+
+  setenv ("COLUMNS", std::to_string(scenario.width).c_str(), 1);
+  setenv ("LINES", std::to_string(scenario.height).c_str(), 1);
+  Measurement measurement{};
+  std::string encoding{};
+
+  {
+    int argc{2};
+    char arg0[] = "fvterm-bench";
+    char arg1[] = "--headless";
+    std::string arg2{"--encoding="};
+    char* argv[] = { arg0, arg1, nullptr, nullptr };
+
+    if ( scenario.encoding )
+    {
+      arg2 += scenario.encoding;
+      argv[argc++] = &arg2[0];
+    }
+
+    finalcut::FApplication app(argc, argv);
+    finalcut::FVTerm::setMaxFramesPerSecond(0);  // Every frame is written
+    encoding = finalcut::FTerm::getEncodingString();
+    scenario.workload (app, scenario.frames, measurement);
+  }
+
+  std::printf ( "%-16s %4zux%-4zu %-8s %6llu %12.0f %12.1f %10.1f %10.4f\n"
+              , scenario.name, scenario.width, scenario.height
+              , encoding.c_str()
+              , static_cast<unsigned long long>(measurement.getFrames())
+              , measurement.getFrameTime()
+              , measurement.getBytesPerFrame()
+              , measurement.getAllocationsPerFrame()
+              , measurement.getSequencesPerCell() );
+}
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+int main()
+{
+  // The byte counts depend on the character encoding, so the
+  // caller's locale is not used. C.UTF-8 is missing on some systems.
+  static const char* const locales[] = { "C.UTF-8", "en_US.UTF-8", "C" };
+  const char* locale{"unknown"};
+
+  for (auto&& name : locales)
+  {
+    if ( std::setlocale(LC_ALL, name) )
+    {
+      // FTerm sets the locale again from the environment
+      locale = name;
+      setenv ("LC_ALL", name, 1);
+      unsetenv ("XTERM_LOCALE");
+      break;
+    }
+  }
+
+  // Machine-readable output: one scenario per line
+  std::printf ("# locale: %s\n", locale);
+  std::printf ( "%-16s %9s %-8s %6s %12s %12s %10s %10s\n"
+              , "# scenario", "size", "encoding", "frames", "ns_per_frame"
+              , "bytes/frame", "allocs/fr", "esc/cell" );
+
+  for (auto&& scenario : scenarios)
+  {
+    std::fflush (stdout);
+    const pid_t pid = fork();
+
+    if ( pid == 0 )
+    {
+      runScenario (scenario);
+      std::fflush (stdout);
+      _exit (0);
+    }
+
+    int status{0};
+
+    if ( pid < 0
+      || waitpid(pid, &status, 0) != pid
+      || ! WIFEXITED(status)
+      || WEXITSTATUS(status) != 0 )
+    {
+      std::fprintf (stderr, "%s: scenario failed\n", scenario.name);
+      return 1;
+    }
+  }
+
+  return 0;
+}
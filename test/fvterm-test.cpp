@@ -0,0 +1,301 @@
+/***********************************************************************
+* fvterm-test.cpp - FVTerm unit tests                                  *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+
+namespace
+{
+
+//----------------------------------------------------------------------
+// class Canvas
+//----------------------------------------------------------------------
+
+class Canvas : public finalcut::FWidget
+{
+  public:
+    explicit Canvas (finalcut::FWidget* parent)
+      : finalcut::FWidget(parent)
+    { }
+
+    const FTermArea* getVTerm() const
+    { return getVirtualTerminal(); }
+
+  private:
+    void draw() override
+    { }
+};
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+// class FVTermTest
+//----------------------------------------------------------------------
+
+class FVTermTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FVTermTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void gapTest();
+    void repeatTest();
+    void trailingBlankTest();
+    void wideCharacterTest();
+    void colorTest();
+
+  private:
+    // Methods
+    void printLine (int, const finalcut::FString&);
+    const std::string update();
+    void checkScreen();
+
+    // Data members
+    Canvas* canvas{nullptr};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FVTermTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (gapTest);
+    CPPUNIT_TEST (repeatTest);
+    CPPUNIT_TEST (trailingBlankTest);
+    CPPUNIT_TEST (wideCharacterTest);
+    CPPUNIT_TEST (colorTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FVTermTest::setUp()
+{
+  // A canvas on the terminal lines 2 to 6
+  canvas = new Canvas(&test::getApplication());
+  canvas->setGeometry (finalcut::FPoint(1, 2), finalcut::FSize(60, 5));
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  canvas->show();
+  update();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::tearDown()
+{
+  delete canvas;
+  canvas = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::printLine (int y, const finalcut::FString& text)
+{
+  canvas->setColor (finalcut::fc::Black, finalcut::fc::LightGray);
+  canvas->print() << finalcut::FPoint(1, y) << text;
+}
+
+//----------------------------------------------------------------------
+const std::string FVTermTest::update()
+{
+  // Returns the bytes of the terminal update
+
+  auto& emulator = finalcut::FTermHeadless::getEmulator();
+  emulator.setRecording(true);
+  emulator.clearRecording();
+  canvas->updateTerminal();
+  const std::string output = emulator.getRecording();
+  emulator.setRecording(false);
+  return output;
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::checkScreen()
+{
+  // The terminal screen must be identical to the virtual terminal
+
+  const auto& emulator = finalcut::FTermHeadless::getEmulator();
+  const auto vterm = canvas->getVTerm();
+  CPPUNIT_ASSERT ( std::size_t(vterm->width) == emulator.getWidth() );
+  CPPUNIT_ASSERT ( std::size_t(vterm->height) == emulator.getHeight() );
+
+  for (int y{0}; y < vterm->height; y++)
+  {
+    for (int x{0}; x < vterm->width; x++)
+    {
+      const auto& vt_char = vterm->data[y * vterm->width + x];
+
+      if ( vt_char.attr.bit.fullwidth_padding )
+        continue;
+
+      // The terminal uses the ANSI color order
+      const auto& em_char = emulator.getChar(std::size_t(x), std::size_t(y));
+      const FColor fg = finalcut::FOptiAttr::vga2ansi(vt_char.fg_color);
+      const FColor bg = finalcut::FOptiAttr::vga2ansi(vt_char.bg_color);
+      CPPUNIT_ASSERT ( em_char.ch == vt_char.ch );
+      CPPUNIT_ASSERT ( em_char.fg_color == fg );
+      CPPUNIT_ASSERT ( em_char.bg_color == bg );
+      CPPUNIT_ASSERT ( em_char.attr.bit.reverse == vt_char.attr.bit.reverse );
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::classNameTest()
+{
+  const finalcut::FString& classname = canvas->finalcut::FVTerm::getClassName();
+  CPPUNIT_ASSERT ( classname == "FVTerm" );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::gapTest()
+{
+  printLine (1, "abcdefghijklmnopqrstuvwxyz");
+  update();
+  checkScreen();
+
+  // Only two characters change, the gap is skipped
+  canvas->print() << finalcut::FPoint(2, 1) << 'B'
+                  << finalcut::FPoint(25, 1) << 'Y';
+  const std::string output = update();
+  CPPUNIT_ASSERT ( output.find('B') != std::string::npos );
+  CPPUNIT_ASSERT ( output.find('Y') != std::string::npos );
+  CPPUNIT_ASSERT ( output.find("klm") == std::string::npos );
+  checkScreen();
+
+  // A gap of one character
+  canvas->print() << finalcut::FPoint(3, 1) << 'C'
+                  << finalcut::FPoint(5, 1) << 'E';
+  update();
+  checkScreen();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::repeatTest()
+{
+  const finalcut::FString run (40, L'x');
+  printLine (2, run);
+  const std::string output = update();
+
+  // The run is not printed character by character
+  CPPUNIT_ASSERT ( output.find("xxxxxxxxxx") == std::string::npos );
+  CPPUNIT_ASSERT ( std::count(output.begin(), output.end(), 'x') < 40 );
+  checkScreen();
+  CPPUNIT_ASSERT ( finalcut::FTermHeadless::getEmulator().getLine(2)
+                   .includes(run) );
+
+  // A run between other changes
+  printLine (2, finalcut::FString("ab") << finalcut::FString(30, L'-') << "cd");
+  update();
+  checkScreen();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::trailingBlankTest()
+{
+  printLine (3, "The quick brown fox jumps over the lazy dog");
+  update();
+  checkScreen();
+
+  // The blanks up to the end of the canvas are erased
+  printLine (3, finalcut::FString("The") << finalcut::FString(40, L' '));
+  const std::string output = update();
+  CPPUNIT_ASSERT ( output.find("quick") == std::string::npos );
+  CPPUNIT_ASSERT ( output.find("          ") == std::string::npos );
+  checkScreen();
+
+  // Blanks at the beginning of the line
+  printLine (3, finalcut::FString(20, L' ') << "over");
+  update();
+  checkScreen();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::wideCharacterTest()
+{
+  printLine (4, L"ab日本語cd");
+  update();
+  checkScreen();
+
+  // Replace a full-width character in the middle of the line
+  printLine (4, L"ab日X 語cd");
+  update();
+  checkScreen();
+
+  // A full-width character in a run of equal characters
+  printLine (4, finalcut::FString(10, L'=') << L"語" << finalcut::FString(10, L'='));
+  update();
+  checkScreen();
+
+  // Replace the full-width characters with a run of blanks
+  printLine (4, finalcut::FString(30, L' '));
+  update();
+  checkScreen();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::colorTest()
+{
+  printLine (5, finalcut::FString(50, L'#'));
+  update();
+
+  // Blanks with other colors in a run
+  canvas->setColor (finalcut::fc::White, finalcut::fc::Blue);
+  canvas->print() << finalcut::FPoint(11, 5) << finalcut::FString(20, L' ');
+  canvas->setColor (finalcut::fc::Red, finalcut::fc::Blue);
+  canvas->print() << finalcut::FPoint(31, 5) << finalcut::FString(20, L'#');
+  update();
+  checkScreen();
+
+  // Reverse mode in the middle of a run
+  canvas->setColor (finalcut::fc::Black, finalcut::fc::LightGray);
+  canvas->print() << finalcut::FPoint(1, 5) << finalcut::FString(10, L'*');
+  canvas->setReverse(true);
+  canvas->print() << finalcut::FString(10, L'*');
+  canvas->setReverse(false);
+  canvas->print() << finalcut::FString(10, L'*');
+  update();
+  checkScreen();
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FVTermTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,318 @@
+/***********************************************************************
+* fwidget-test.cpp - FWidget unit tests                                *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+#include <headless.h>
+
+namespace
+{
+
+//----------------------------------------------------------------------
+// class Container
+//----------------------------------------------------------------------
+
+class Container : public finalcut::FWidget
+{
+  public:
+    explicit Container (finalcut::FWidget* parent)
+      : finalcut::FWidget(parent)
+    { }
+
+    // Data member
+    int draw_count{0};
+
+  private:
+    void draw() override
+    {
+      // Clears the widget and counts the calls
+      setColor();
+
+      for (int y{1}; y <= int(getHeight()); y++)
+        print() << finalcut::FPoint(1, y) << finalcut::FString(getWidth(), L' ');
+
+      draw_count++;
+    }
+};
+
+//----------------------------------------------------------------------
+finalcut::FString getWindowText (finalcut::FWidget* widget, std::size_t len)
+{
+  // Returns the cells of the widget in the area of its window
+
+  const auto window = finalcut::FWindow::getWindowWidget(widget);
+  const auto area = window->getVWin();
+  const int x = widget->getTermX() - area->offset_left - 1;
+  const int y = widget->getTermY() - area->offset_top - 1;
+  const int line_len = area->width + area->right_shadow;
+  finalcut::FString text{};
+
+  for (std::size_t i{0}; i < len; i++)
+    text += wchar_t(area->data[y * line_len + x + int(i)].ch);
+
+  return text;
+}
+
+//----------------------------------------------------------------------
+const finalcut::FChar& getCell (finalcut::FWidget* widget)
+{
+  // Returns the first cell of the widget in its window area
+
+  const auto window = finalcut::FWindow::getWindowWidget(widget);
+  const auto area = window->getVWin();
+  const int x = widget->getTermX() - area->offset_left - 1;
+  const int y = widget->getTermY() - area->offset_top - 1;
+  const int line_len = area->width + area->right_shadow;
+  return area->data[y * line_len + x];
+}
+
+}  // namespace
+
+
+//----------------------------------------------------------------------
+// class FWidgetTest
+//----------------------------------------------------------------------
+
+class FWidgetTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FWidgetTest()
+    { }
+
+    void setUp();
+    void tearDown();
+
+  protected:
+    void classNameTest();
+    void saveRestoreTest();
+    void stateChangeTest();
+    void addChildTest();
+    void removeChildTest();
+    void directColorTest();
+
+  private:
+    // Data members
+    finalcut::FDialog* dialog{nullptr};
+    Container* container{nullptr};
+    finalcut::FLabel* label{nullptr};
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FWidgetTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (saveRestoreTest);
+    CPPUNIT_TEST (stateChangeTest);
+    CPPUNIT_TEST (addChildTest);
+    CPPUNIT_TEST (removeChildTest);
+    CPPUNIT_TEST (directColorTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FWidgetTest::setUp()
+{
+  // A container with a backing store and a label inside a dialog
+  dialog = new finalcut::FDialog(&test::getApplication());
+  dialog->setGeometry (finalcut::FPoint(2, 2), finalcut::FSize(40, 12));
+  container = new Container(dialog);
+  container->setGeometry (finalcut::FPoint(2, 2), finalcut::FSize(30, 6));
+  container->setBackingStore();
+  label = new finalcut::FLabel("one", container);
+  label->setGeometry (finalcut::FPoint(2, 2), finalcut::FSize(10, 1));
+
+  finalcut::FVTerm::setMaxFramesPerSecond(0);
+  test::getApplication().show();
+  dialog->show();
+
+  // The first redraw draws and saves the cells
+  dialog->redraw();
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::tearDown()
+{
+  delete dialog;  // Deletes the children first
+  dialog = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::classNameTest()
+{
+  const finalcut::FString& classname = container->getClassName();
+  CPPUNIT_ASSERT ( classname == "FWidget" );
+  CPPUNIT_ASSERT ( container->hasBackingStore() );
+  CPPUNIT_ASSERT ( ! label->hasBackingStore() );
+
+  // Windows have their own area
+  CPPUNIT_ASSERT ( ! dialog->setBackingStore() );
+  CPPUNIT_ASSERT ( ! dialog->hasBackingStore() );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::saveRestoreTest()
+{
+  const int count = container->draw_count;
+  CPPUNIT_ASSERT ( getWindowText(label, 3) == "one" );
+
+  // An unchanged container copies back its saved cells
+  dialog->redraw();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count );
+  CPPUNIT_ASSERT ( getWindowText(label, 3) == "one" );
+
+  // A direct redraw always draws
+  container->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 1 );
+
+  // A redraw of the root widget discards all saved cells
+  test::getApplication().redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 2 );
+
+  // Without a backing store the container is always drawn
+  container->unsetBackingStore();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 3 );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::stateChangeTest()
+{
+  const int count = container->draw_count;
+
+  // The new label text marks the container as changed
+  label->setText("two");
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 1 );
+  CPPUNIT_ASSERT ( getWindowText(label, 3) == "two" );
+
+  // Also when the label is hidden at the moment
+  label->hide();
+  dialog->redraw();
+  label->setText("six");
+  label->show();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( getWindowText(label, 3) == "six" );
+
+  // Other widget states
+  auto checkbox = new finalcut::FCheckBox("x", container);
+  checkbox->setGeometry (finalcut::FPoint(2, 4), finalcut::FSize(10, 1));
+  checkbox->show();
+  dialog->redraw();
+  const int count_before_check = container->draw_count;
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count_before_check );
+  checkbox->setChecked();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count_before_check + 1 );
+
+  // A color change
+  label->setForegroundColor (finalcut::fc::Red);
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count_before_check + 2 );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::addChildTest()
+{
+  const int count = container->draw_count;
+
+  auto new_label = new finalcut::FLabel("new", container);
+  new_label->setGeometry (finalcut::FPoint(2, 4), finalcut::FSize(10, 1));
+  new_label->show();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 1 );
+  CPPUNIT_ASSERT ( getWindowText(new_label, 3) == "new" );
+
+  // A child of a child
+  auto button = new finalcut::FButton("ok", new_label);
+  button->setGeometry (finalcut::FPoint(1, 1), finalcut::FSize(4, 1));
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 2 );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::removeChildTest()
+{
+  const int count = container->draw_count;
+  const finalcut::FPoint pos (label->getTermPos());
+
+  // The removed label disappears from the container
+  delete label;
+  label = nullptr;
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 1 );
+
+  const auto area = dialog->getVWin();
+  const int x = pos.getX() - area->offset_left - 1;
+  const int y = pos.getY() - area->offset_top - 1;
+  const int line_len = area->width + area->right_shadow;
+  CPPUNIT_ASSERT ( area->data[y * line_len + x].ch == L' ' );
+
+  // Unchanged again
+  dialog->redraw();
+  CPPUNIT_ASSERT ( container->draw_count == count + 1 );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::directColorTest()
+{
+  const FColor fg = finalcut::FTrueColor::rgb(0x12, 0x34, 0x56);
+  const FColor bg = finalcut::FTrueColor::rgb(0xfe, 0xdc, 0xba);
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::isDirectColor(fg) );
+  container->setForegroundColor (fg);
+  container->setBackgroundColor (bg);
+  CPPUNIT_ASSERT ( container->getForegroundColor() == fg );
+  CPPUNIT_ASSERT ( container->getBackgroundColor() == bg );
+
+  // The direct colors reach the cells of the window area
+  dialog->redraw();
+  const auto& ch = getCell(container);
+  CPPUNIT_ASSERT ( ch.fg_color == fg );
+  CPPUNIT_ASSERT ( ch.bg_color == bg );
+  CPPUNIT_ASSERT ( finalcut::FTrueColor::getRGB(ch.bg_color) == 0xfedcba );
+
+  // Also the button colors
+  auto button = new finalcut::FButton("ok", container);
+  button->setGeometry (finalcut::FPoint(2, 4), finalcut::FSize(6, 1));
+  button->setInactiveBackgroundColor (fg);
+  button->setDisable();
+  button->show();
+  dialog->redraw();
+  CPPUNIT_ASSERT ( getCell(button).bg_color == fg );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FWidgetTest);
+
+// The general unit test main part
+#include <main-test.inc>
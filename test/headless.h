@@ -0,0 +1,46 @@
+/***********************************************************************
+* headless.h - Application without a terminal for widget tests         *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <final/final.h>
+
+namespace test
+{
+
+//----------------------------------------------------------------------
+inline finalcut::FApplication& getApplication()
+{
+  // The widgets need an application without a terminal.
+  // It is created only once, because the terminal is static.
+  static int argc{2};
+  static char arg0[] = "finalcut-test";
+  static char arg1[] = "--headless";
+  static char* argv[] = { arg0, arg1, nullptr };
+  static finalcut::FApplication app(argc, argv);
+  return app;
+}
+
+}  // namespace test
+
+#endif  // HEADLESS_H
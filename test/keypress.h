@@ -0,0 +1,44 @@
+/***********************************************************************
+* keypress.h - Sends key presses to a widget in the tests              *
+*                                                                      *
+* This file is part of the Final Cut widget toolkit                    *
+*                                                                      *
+* Copyright 2026 The Final Cut contributors                            *
+*                                                                      *
+* The Final Cut is free software; you can redistribute it and/or       *
+* modify it under the terms of the GNU Lesser General Public License   *
+* as published by the Free Software Foundation; either version 3 of    *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* The Final Cut is distributed in the hope that it will be useful,     *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of       *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#ifndef KEYPRESS_H
+#define KEYPRESS_H
+
+#include <final/final.h>
+
+namespace test
+{
+
+//----------------------------------------------------------------------
+template <typename WidgetT>
+inline void pressKey (WidgetT& widget, FKey key)
+{
+  // The key handler is public in the widgets, but
+  // protected in FWidget, therefore the widget type
+  // is a template parameter
+  finalcut::FKeyEvent ev (finalcut::fc::KeyPress_Event, key);
+  widget.onKeyPress (&ev);
+}
+
+}  // namespace test
+
+#endif  // KEYPRESS_H